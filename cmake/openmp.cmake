@@ -0,0 +1,6 @@
+# Option to run independent node loops of a rank with several OpenMP threads (hybrid MPI + threads)
+option(OPENMP "Hybrid MPI and OpenMP parallelization" OFF)
+if(OPENMP)
+    find_package(OpenMP REQUIRED)
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+endif(OPENMP)
@@ -69,6 +69,7 @@
 #include <mpi.h>
 #include <fenv.h> // Floating-Point raising exceptions.
 
+#include "communication/mpi_utilities.h"
 #include "instantiation/input_output/instantiation_input_reader.h"
 #include "input_output/log_writer/log_writer.h"
 #include "simulation_runner.h"
@@ -81,10 +82,12 @@ namespace Alpaca {
     */
    void Run( std::string const inputfile ) {
 
-      MPI_Init( NULL, NULL );
+      // Requests the same thread support as the executable (OpenMP or asynchronous output)
+      MpiUtilities::Initialize( nullptr, nullptr );
       //Triggers signals on floating point errors, i.e. prohibits quiet NaNs and alike
 #ifndef PERFORMANCE
       feenableexcept( FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW );
+#endif
 
       //NH Seperate Scope for MPI.
       {
@@ -230,7 +230,7 @@ class UserSpecifications(SpecificationsBase):
                                                           "Weno",
                                                           UserSpecificationFile.numerical_setup,
                                                           "levelset_reinitializer", "LevelsetReinitializers::",
-                                                          ["Min", "Weno", "Explicit"]),
+                                                          ["Min", "Weno", "FastSweeping", "Explicit"]),
             "InterfaceRiemannSolver": UserSpecificationTag(str,
                                                            "Linearized",
                                                            UserSpecificationFile.numerical_setup,
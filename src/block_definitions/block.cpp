@@ -23,6 +23,27 @@
 #include "utilities/buffer_operations.h"
 #include <stdexcept>
 
+namespace {
+/**
+ * @brief Gives the initial buffer in the layout of the other conservative
+ * buffers, i.e. including the halo cells.
+ * @param initials The initial buffer.
+ * @return The initial buffer.
+ * @note Throws if the initial buffer is stored halo-free. Callers reading the
+ * initial buffer in that configuration (e.g. the material field output) access
+ * it through GetInitialBuffer() under CC::HaloFreeInitialBufferActive().
+ */
+template <typename BufferType, typename InitialBufferType>
+BufferType &InitialBufferWithHalos(InitialBufferType &initials) {
+  if constexpr (std::is_same_v<std::remove_const_t<InitialBufferType>,
+                               Conservatives>) {
+    return initials;
+  } else {
+    throw std::logic_error("The initial buffer holds no halo cells");
+  }
+}
+} // namespace
+
 /**
  * @brief Standard constructor, creates a Block of the provided material.
  * Initializes all buffers to zero (important with first touch rule on
@@ -137,7 +158,7 @@ auto Block::GetRightHandSideBuffer(Equation const equation) const
  * @return Reference to Array that is the requested buffer.
  */
 auto Block::GetInitialBuffer(Equation const equation)
-    -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    -> double (&)[CC::IBCX()][CC::IBCY()][CC::IBCZ()] {
   return initials_[equation];
 }
 
@@ -145,7 +166,7 @@ auto Block::GetInitialBuffer(Equation const equation)
  * @brief Const overload.
  */
 auto Block::GetInitialBuffer(Equation const equation) const
-    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+    -> double const (&)[CC::IBCX()][CC::IBCY()][CC::IBCZ()] {
   return initials_[equation];
 }
 
@@ -179,7 +200,8 @@ Block::GetConservativeBuffer<ConservativeBufferType::RightHandSide>() {
  * @return The initial conservative field buffer.
  */
 template <>
-Conservatives &Block::GetConservativeBuffer<ConservativeBufferType::Initial>() {
+InitialConservatives &
+Block::GetConservativeBuffer<ConservativeBufferType::Initial>() {
   return GetInitialBuffer();
 }
 
@@ -205,7 +227,7 @@ Block::GetConservativeBuffer<ConservativeBufferType::RightHandSide>() const {
  * @brief Const overload.
  */
 template <>
-Conservatives const &
+InitialConservatives const &
 Block::GetConservativeBuffer<ConservativeBufferType::Initial>() const {
   return GetInitialBuffer();
 }
@@ -238,17 +260,21 @@ Conservatives const &Block::GetRightHandSideBuffer() const {
  * @brief Gives access to the initial buffer.
  * @return initial buffer struct.
  */
-Conservatives &Block::GetInitialBuffer() { return initials_; }
+InitialConservatives &Block::GetInitialBuffer() { return initials_; }
 
 /**
  * @brief Const overload.
  */
-Conservatives const &Block::GetInitialBuffer() const { return initials_; }
+InitialConservatives const &Block::GetInitialBuffer() const {
+  return initials_;
+}
 
 /**
  * @brief Gives access to the conservative buffer of given type.
  * @param conservative_type Conservative type of the buffer asked for.
  * @return buffer struct of given type.
+ * @note The initial buffer is not available if it is stored halo-free, use
+ * GetInitialBuffer() instead.
  */
 Conservatives &
 Block::GetConservativeBuffer(ConservativeBufferType const conservative_type) {
@@ -260,7 +286,7 @@ Block::GetConservativeBuffer(ConservativeBufferType const conservative_type) {
     return averages_;
   }
   default: { // case ConservativeBufferType::Initial:
-    return initials_;
+    return InitialBufferWithHalos<Conservatives>(initials_);
   }
   }
 }
@@ -278,7 +304,7 @@ Conservatives const &Block::GetConservativeBuffer(
     return averages_;
   }
   default: { // case ConservativeBufferType::Initial:
-    return initials_;
+    return InitialBufferWithHalos<Conservatives const>(initials_);
   }
   }
 }
@@ -26,6 +26,7 @@
 #include "block_definitions/field_material_definitions.h"
 #include "boundary_condition/boundary_specifications.h"
 #include "user_specifications/compile_time_constants.h"
+#include <type_traits>
 
 /**
  * @brief Gives a buffer for the values on the six (in 3D) surfaces of the
@@ -45,6 +46,15 @@ static_assert(sizeof(SurfaceBuffer) ==
                   6 * MF::ANOE() * CC::ICY() * CC::ICZ() * sizeof(double),
               "Surface Struct is not contiguous in Memory");
 
+/**
+ * @brief Gives the field buffer type of the given conservative buffer type.
+ * The initial buffer may be stored without halo cells.
+ */
+template <ConservativeBufferType C>
+using ConservativeBufferOfType =
+    std::conditional_t<C == ConservativeBufferType::Initial,
+                       InitialConservatives, Conservatives>;
+
 /**
  * @brief The Block class holds the data on which the simulation is running.
  * They do NOT manipulate the data themselves, but provide data access to the
@@ -56,7 +66,7 @@ class Block {
   // integration)
   Conservatives averages_;
   Conservatives right_hand_sides_;
-  Conservatives initials_;
+  InitialConservatives initials_;
 
   // buffers for the primestates (e.g. temperature, pressure, velocity)
   PrimeStates prime_states_;
@@ -103,21 +113,22 @@ public:
       -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
 
   auto GetInitialBuffer(Equation const equation)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> double (&)[CC::IBCX()][CC::IBCY()][CC::IBCZ()];
   auto GetInitialBuffer(Equation const equation) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()];
+      -> double const (&)[CC::IBCX()][CC::IBCY()][CC::IBCZ()];
 
-  template <ConservativeBufferType C> Conservatives &GetConservativeBuffer();
+  template <ConservativeBufferType C>
+  ConservativeBufferOfType<C> &GetConservativeBuffer();
 
   template <ConservativeBufferType C>
-  Conservatives const &GetConservativeBuffer() const;
+  ConservativeBufferOfType<C> const &GetConservativeBuffer() const;
 
   Conservatives &GetAverageBuffer();
   Conservatives const &GetAverageBuffer() const;
   Conservatives &GetRightHandSideBuffer();
   Conservatives const &GetRightHandSideBuffer() const;
-  Conservatives &GetInitialBuffer();
-  Conservatives const &GetInitialBuffer() const;
+  InitialConservatives &GetInitialBuffer();
+  InitialConservatives const &GetInitialBuffer() const;
   Conservatives &
   GetConservativeBuffer(ConservativeBufferType const conservative_type);
   Conservatives const &
@@ -0,0 +1,218 @@
+//===------------------------- block_pool.cpp -----------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "block_definitions/block_pool.h"
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace {
+// Alignment of slots and slabs to avoid false sharing of cache lines
+constexpr std::size_t cache_line_size = 64;
+// Size of a transparent huge page on common Linux systems
+constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+/**
+ * @brief Rounds the given size up to the next multiple of the given alignment.
+ * @param size The size to be rounded.
+ * @param alignment The alignment.
+ * @return The rounded size.
+ */
+constexpr std::size_t RoundUp(std::size_t const size,
+                              std::size_t const alignment) {
+  return ((size + alignment - 1) / alignment) * alignment;
+}
+
+/**
+ * @brief Gives the number of slots per slab. Slabs hold at least the children
+ * of one node and fill at least one huge page.
+ * @param slot_size The size of one slot.
+ * @return The number of slots.
+ */
+std::size_t NumberOfSlotsPerSlab(std::size_t const slot_size) {
+  std::size_t const children_size = slot_size * CC::NOC();
+  std::size_t const children_per_slab =
+      RoundUp(huge_page_size, children_size) / children_size;
+  return CC::NOC() * children_per_slab;
+}
+} // namespace
+
+/**
+ * @brief Creates an empty pool. Slabs are only allocated on demand.
+ * @param object_size The size of the objects served by the pool.
+ * @param object_alignment The alignment of the objects served by the pool.
+ */
+SlabPool::SlabPool(std::size_t const object_size,
+                   std::size_t const object_alignment)
+    : slot_size_(RoundUp(object_size,
+                         std::max(object_alignment, cache_line_size))),
+      slots_per_slab_(NumberOfSlotsPerSlab(slot_size_)),
+      slab_size_(RoundUp(slot_size_ * slots_per_slab_,
+                         CC::HugePageBlockPoolsActive() ? huge_page_size
+                                                        : cache_line_size)),
+      slabs_(), free_slots_(), slots_in_use_(0), free_slabs_(0) {}
+
+/**
+ * @brief Returns all slabs to the system.
+ * @note If objects are still alive (e.g. in static objects destroyed after the
+ * pool), the slabs are kept to not invalidate them.
+ */
+SlabPool::~SlabPool() {
+  if (slots_in_use_ > 0) {
+    return;
+  }
+  while (!slabs_.empty()) {
+    ReleaseSlab(slabs_.begin()->first);
+  }
+}
+
+/**
+ * @brief Allocates a new slab and adds its slots to the free slots.
+ * @note On Linux, slabs are mapped directly and aligned to huge pages if
+ * requested, so that the kernel can back them with transparent huge pages.
+ */
+void SlabPool::AddSlab() {
+#ifdef __linux__
+  std::size_t const alignment =
+      CC::HugePageBlockPoolsActive() ? huge_page_size : 0;
+  void *const mapping = mmap(nullptr, slab_size_ + alignment,
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+  char *slab = static_cast<char *>(mapping);
+  if (alignment > 0) {
+    // Trim the mapping to an aligned range
+    std::size_t const address = reinterpret_cast<std::size_t>(mapping);
+    std::size_t const head = RoundUp(address, alignment) - address;
+    slab += head;
+    if (head > 0) {
+      munmap(mapping, head);
+    }
+    if (alignment - head > 0) {
+      munmap(slab + slab_size_, alignment - head);
+    }
+    madvise(slab, slab_size_, MADV_HUGEPAGE);
+  }
+#else
+  char *const slab = static_cast<char *>(
+      ::operator new(slab_size_, std::align_val_t(cache_line_size)));
+#endif
+  slabs_.emplace(slab, 0);
+  free_slabs_++;
+  for (std::size_t slot_index = 0; slot_index < slots_per_slab_;
+       ++slot_index) {
+    free_slots_.insert(slab + slot_index * slot_size_);
+  }
+}
+
+/**
+ * @brief Removes the slots of a slab from the free slots and returns the slab
+ * to the system.
+ * @param slab Start address of the slab. All its slots must be free.
+ */
+void SlabPool::ReleaseSlab(char *const slab) {
+  free_slots_.erase(free_slots_.lower_bound(slab),
+                    free_slots_.lower_bound(slab + slab_size_));
+  slabs_.erase(slab);
+  free_slabs_--;
+#ifdef __linux__
+  munmap(slab, slab_size_);
+#else
+  ::operator delete(slab, std::align_val_t(cache_line_size));
+#endif
+}
+
+/**
+ * @brief Gives a free slot. The free slot with the lowest address is used.
+ * @return Pointer to the uninitialized memory of the slot.
+ */
+void *SlabPool::Allocate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (free_slots_.empty()) {
+    AddSlab();
+  }
+  char *const slot = *free_slots_.begin();
+  free_slots_.erase(free_slots_.begin());
+  slots_in_use_++;
+  // The slab holding the slot is the last one starting at or before it
+  std::size_t &slab_slots_in_use = std::prev(slabs_.upper_bound(slot))->second;
+  if (slab_slots_in_use == 0) {
+    free_slabs_--;
+  }
+  slab_slots_in_use++;
+  return slot;
+}
+
+/**
+ * @brief Returns a slot to the pool for recycling. If this frees a slab while
+ * another slab is free already, the slab is returned to the system.
+ * @param slot Pointer to the slot. The object in it must be destroyed.
+ */
+void SlabPool::Deallocate(void *const slot) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  char *const slot_address = static_cast<char *>(slot);
+  free_slots_.insert(slot_address);
+  slots_in_use_--;
+  auto const slab = std::prev(slabs_.upper_bound(slot_address));
+  if (--slab->second == 0) {
+    free_slabs_++;
+    if (free_slabs_ > 1) {
+      ReleaseSlab(slab->first);
+    }
+  }
+}
+
+/**
+ * @brief Gives the size of one slot including the alignment padding.
+ * @return Slot size in bytes.
+ */
+std::size_t SlabPool::SlotSize() const { return slot_size_; }
+
+/**
+ * @brief Gives the number of slots in one slab.
+ * @return Number of slots.
+ */
+std::size_t SlabPool::SlotsPerSlab() const { return slots_per_slab_; }
+
+/**
+ * @brief Gives the number of slots that are currently allocated.
+ * @return Number of slots in use.
+ */
+std::size_t SlabPool::SlotsInUse() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slots_in_use_;
+}
+
+/**
+ * @brief Gives the number of slabs held by the pool.
+ * @return Number of slabs.
+ */
+std::size_t SlabPool::NumberOfSlabs() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return slabs_.size();
+}
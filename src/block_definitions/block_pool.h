@@ -0,0 +1,139 @@
+//===-------------------------- block_pool.h ------------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+
+#include "user_specifications/compile_time_constants.h"
+
+/**
+ * @brief The SlabPool class provides fixed-size memory slots for large objects
+ * such as blocks and interface blocks. Slots are carved from slabs that hold
+ * (a multiple of) the number of children of one node. Freed slots are recycled
+ * lowest address first, so the children created during one refinement are
+ * placed contiguously whenever a free run of slots exists. A slab whose slots
+ * are all free is returned to the system, except for a single free slab that
+ * is kept to avoid remapping when refinement and coarsening alternate.
+ * @note The memory of a slab is not touched on allocation. Under the default
+ * first-touch policy, its pages are placed on the NUMA domain of the rank
+ * that constructs the objects in it.
+ */
+class SlabPool {
+
+  std::size_t const slot_size_;
+  std::size_t const slots_per_slab_;
+  std::size_t const slab_size_;
+  // Start address of each slab with the number of its slots in use
+  std::map<char *, std::size_t> slabs_;
+  std::set<char *> free_slots_;
+  std::size_t slots_in_use_;
+  std::size_t free_slabs_;
+  std::mutex mutex_;
+
+  void AddSlab();
+  void ReleaseSlab(char *const slab);
+
+public:
+  explicit SlabPool(std::size_t const object_size,
+                    std::size_t const object_alignment);
+  SlabPool() = delete;
+  ~SlabPool();
+  SlabPool(SlabPool const &) = delete;
+  SlabPool &operator=(SlabPool const &) = delete;
+  SlabPool(SlabPool &&) = delete;
+  SlabPool &operator=(SlabPool &&) = delete;
+
+  void *Allocate();
+  void Deallocate(void *const slot);
+
+  std::size_t SlotSize() const;
+  std::size_t SlotsPerSlab() const;
+  std::size_t SlotsInUse();
+  std::size_t NumberOfSlabs();
+};
+
+/**
+ * @brief Gives the pool that serves all objects of the given type.
+ * @tparam T Type of the pooled objects.
+ * @return Pool of the type.
+ */
+template <typename T> SlabPool &PoolOf() {
+  static SlabPool pool(sizeof(T), alignof(T));
+  return pool;
+}
+
+/**
+ * @brief The PooledAllocator class is an allocator for standard containers that
+ * serves single large objects (e.g. the nodes of a map holding blocks) from a
+ * SlabPool. Arrays and small objects (e.g. the buckets of a map) are served by
+ * the standard allocator.
+ * @tparam T Type of the allocated objects.
+ */
+template <typename T> class PooledAllocator {
+
+  // Objects smaller than a memory page are not worth pooling
+  static constexpr bool pooled_ =
+      CC::PooledBlockStorageActive() && sizeof(T) >= 4096;
+
+public:
+  using value_type = T;
+
+  PooledAllocator() noexcept = default;
+  template <typename U>
+  PooledAllocator(PooledAllocator<U> const &) noexcept {}
+
+  T *allocate(std::size_t const n) {
+    if constexpr (pooled_) {
+      if (n == 1) {
+        return static_cast<T *>(PoolOf<T>().Allocate());
+      }
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *const pointer, std::size_t const n) {
+    if constexpr (pooled_) {
+      if (n == 1) {
+        PoolOf<T>().Deallocate(pointer);
+        return;
+      }
+    }
+    std::allocator<T>().deallocate(pointer, n);
+  }
+
+  template <typename U>
+  bool operator==(PooledAllocator<U> const &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(PooledAllocator<U> const &) const noexcept {
+    return false;
+  }
+};
+
+#endif // BLOCK_POOL_H
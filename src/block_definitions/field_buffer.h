@@ -33,17 +33,21 @@
  * @tparam FieldEnum Enumeration type allowing to access the material fields.
  * @tparam int(*const FieldToIndex)(FieldEnum) Function converting the field
  * enumeration to an index in the range [0;N).
+ * @tparam SX, SY, SZ Number of cells per dimension of each field. Defaults to
+ * the total cells of a block (including halos).
  */
 template <std::size_t N, typename FieldEnum,
-          unsigned int (*const FieldToIndex)(FieldEnum)>
+          unsigned int (*const FieldToIndex)(FieldEnum),
+          unsigned int SX = CC::TCX(), unsigned int SY = CC::TCY(),
+          unsigned int SZ = CC::TCZ()>
 struct FieldBuffer {
-  std::array<double[CC::TCX()][CC::TCY()][CC::TCZ()], N> Fields;
+  std::array<double[SX][SY][SZ], N> Fields;
 
   /**
    * @brief Access the buffer corresponding to field f.
    */
   auto operator[](FieldEnum const f)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> double (&)[SX][SY][SZ] {
     return Fields[FieldToIndex(f)];
   }
 
@@ -51,7 +55,7 @@ struct FieldBuffer {
    * @brief Access the buffer corresponding to field f. Const overload.
    */
   auto operator[](FieldEnum const f) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> double const (&)[SX][SY][SZ] {
     return Fields[FieldToIndex(f)];
   }
 
@@ -59,7 +63,7 @@ struct FieldBuffer {
    * @brief Access the buffer at the given index.
    */
   auto operator[](unsigned short const index)
-      -> double (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> double (&)[SX][SY][SZ] {
     return Fields[index];
   }
 
@@ -67,7 +71,7 @@ struct FieldBuffer {
    * @brief Access the buffer at the given index. Const overload.
    */
   auto operator[](unsigned short const index) const
-      -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+      -> double const (&)[SX][SY][SZ] {
     return Fields[index];
   }
 
@@ -139,6 +143,18 @@ static_assert(sizeof(Conservatives) == MF::ANOE() * CC::TCX() * CC::TCY() *
                                            CC::TCZ() * sizeof(double),
               "Conservative Struct is not contiguous in Memory");
 
+/**
+ * @brief Bundles the conservative values of the initial Runge-Kutta stage to
+ * have them contiguous in memory. Holds the internal cells only if the initial
+ * buffer is stored halo-free (identical to Conservatives otherwise).
+ */
+using InitialConservatives =
+    FieldBuffer<MF::ANOE(), Equation, ETI, CC::IBCX(), CC::IBCY(), CC::IBCZ()>;
+static_assert(sizeof(InitialConservatives) == MF::ANOE() * CC::IBCX() *
+                                                  CC::IBCY() * CC::IBCZ() *
+                                                  sizeof(double),
+              "Initial Conservative Struct is not contiguous in Memory");
+
 /**
  * @brief Bundles the prime state values to have them contiguous in memory.
  */
@@ -43,6 +43,18 @@ enum class ConservativeBufferType { Average, RightHandSide, Initial };
  */
 enum class MaterialFieldType { Conservatives, PrimeStates, Parameters };
 
+/**
+ * @brief Converts a material field type identifier to a (C++11 standard
+ * compliant, i. e. positive) array index. "MFTTI = Material Field Type To
+ * Index".
+ * @param t The material field type identifier.
+ * @return Index to be used in Arrays.
+ */
+constexpr std::underlying_type<MaterialFieldType>::type
+MFTTI(MaterialFieldType const t) {
+  return static_cast<typename std::underlying_type<MaterialFieldType>::type>(t);
+}
+
 class MaterialFieldsDefinitions {
 
   // get arrays of the consecutively ordered active fields
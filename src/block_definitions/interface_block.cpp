@@ -97,6 +97,33 @@ InterfaceBlock::InterfaceBlock(double const levelset_initial) {
   }
 }
 
+/**
+ * @brief Allocates the memory of an interface block in the pool of interface
+ * blocks (if pooled block storage is active).
+ * @param size The size of the interface block.
+ * @return Pointer to the uninitialized memory.
+ */
+void *InterfaceBlock::operator new(std::size_t const size) {
+  if constexpr (CC::PooledBlockStorageActive()) {
+    // The class is final, hence the size always equals the slot type
+    return PoolOf<InterfaceBlock>().Allocate();
+  } else {
+    return ::operator new(size);
+  }
+}
+
+/**
+ * @brief Returns the memory of a destroyed interface block to its pool.
+ * @param pointer Pointer to the memory.
+ */
+void InterfaceBlock::operator delete(void *const pointer) {
+  if constexpr (CC::PooledBlockStorageActive()) {
+    PoolOf<InterfaceBlock>().Deallocate(pointer);
+  } else {
+    ::operator delete(pointer);
+  }
+}
+
 /**
  * @brief Gives a reference to the corresponding buffer.
  * @param field_type The interface field type of the buffer.
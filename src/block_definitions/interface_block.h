@@ -22,6 +22,7 @@
 #ifndef INTERFACE_BLOCK_H
 #define INTERFACE_BLOCK_H
 
+#include "block_definitions/block_pool.h"
 #include "block_definitions/field_buffer.h"
 #include "block_definitions/field_interface_definitions.h"
 #include "interface_block_buffer_definitions.h"
@@ -34,7 +35,7 @@
  * velocity) Does NOT manipulate the data itself, but provides access to the
  * data.
  */
-class InterfaceBlock {
+class InterfaceBlock final {
 
   // buffers for the interface description (different buffer types required for
   // the integration)
@@ -63,6 +64,9 @@ public:
   InterfaceBlock(InterfaceBlock &&) = delete;
   InterfaceBlock &operator=(InterfaceBlock &&) = delete;
 
+  static void *operator new(std::size_t const size);
+  static void operator delete(void *const pointer);
+
   // Returning general field buffer
   auto GetFieldBuffer(InterfaceFieldType const field_type,
                       unsigned int const field_index,
@@ -0,0 +1,64 @@
+//===------------------- aggregated_halo_exchange.h -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef AGGREGATED_HALO_EXCHANGE_H
+#define AGGREGATED_HALO_EXCHANGE_H
+
+#include "block_definitions/field_material_definitions.h"
+#include "boundary_condition/boundary_specifications.h"
+#include "topology/node_id_type.h"
+#include <array>
+#include <mpi.h>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Bundles all no-jump halos a rank exchanges with one partner rank.
+ * The halos of all nodes and materials are packed into a single contiguous
+ * buffer per direction, such that only one message per partner rank is needed
+ * in a halo update.
+ * @note Entries are (local node id, location of the halo in the local node)
+ * pairs. The send list of a rank and the receive list of its partner have the
+ * same order, as both are derived from the globally ordered internal boundary
+ * lists in the CommunicationManager.
+ * @note Buffers are kept per material field type. With persistent halo requests
+ * the (send, receive) requests are bound to these buffers and reused until the
+ * exchange is discarded or the message size changes. The tag identifies the
+ * relation list (level or multi-phase halos) the exchange stems from and is
+ * used to derive fixed message tags for the persistent requests.
+ */
+struct AggregatedHaloExchange {
+  static constexpr unsigned int number_of_field_types_ =
+      MFTTI(MaterialFieldType::Parameters) + 1;
+
+  int partner_rank_;
+  int tag_;
+  std::vector<std::tuple<nid_t, BoundaryLocation>> send_halos_;
+  std::vector<std::tuple<nid_t, BoundaryLocation>> recv_halos_;
+  std::array<std::vector<double>, number_of_field_types_> send_buffers_;
+  std::array<std::vector<double>, number_of_field_types_> recv_buffers_;
+  std::array<MPI_Request, number_of_field_types_> send_requests_ = {
+      MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+  std::array<MPI_Request, number_of_field_types_> recv_requests_ = {
+      MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+};
+
+#endif // AGGREGATED_HALO_EXCHANGE_H
@@ -21,7 +21,9 @@
 //===----------------------------------------------------------------------===//
 #include "communication_manager.h"
 
+#include <algorithm>
 #include <bitset>
+#include <map>
 
 #include "boundary_condition/material_boundary_condition.h"
 #include "communication/communication_statistics.h"
@@ -49,11 +51,35 @@ CommunicationManager::CommunicationManager(TopologyManager &topology,
       internal_boundaries_jump_(maximum_level_ + 1),
       internal_boundaries_jump_mpi_(maximum_level_ + 1),
       external_boundaries_(maximum_level_ + 1), external_multi_boundaries_(),
+      aggregated_halos_mpi_(maximum_level_ + 1), aggregated_multi_halos_mpi_(),
+      rank_local_halo_leaves_(maximum_level_ + 1),
+      halo_communicator_(MPI_COMM_NULL),
       boundaries_valid_(maximum_level_ + 1, false) {
   // Initialize cache for Halo Update
   for (unsigned int level = 0; level <= maximum_level_; level++) {
     jump_send_count_.emplace_back(std::array<unsigned int, 3>({0, 0, 0}));
   }
+  if constexpr (CC::PersistentHaloRequestsActive()) {
+    MPI_Comm_dup(MPI_COMM_WORLD, &halo_communicator_);
+  }
+}
+
+/**
+ * @brief Default destructor besides releasing the persistent halo requests and
+ * their communicator.
+ */
+CommunicationManager::~CommunicationManager() {
+  if constexpr (CC::PersistentHaloRequestsActive()) {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (!finalized) {
+      for (auto &exchanges : aggregated_halos_mpi_) {
+        FreePersistentHaloRequests(exchanges);
+      }
+      FreePersistentHaloRequests(aggregated_multi_halos_mpi_);
+      MPI_Comm_free(&halo_communicator_);
+    }
+  }
 }
 
 /**
@@ -197,9 +223,163 @@ void CommunicationManager::GenerateNeighborRelationForHaloUpdate(
     tmp_neighbor_location_vector.clear();
     tmp_external_id_location_vector.clear();
   }
+
+  CollectRankLocalHaloLeaves(level);
+
+  if constexpr (CC::AggregatedHaloExchangeActive()) {
+    // the multi-phase halos get the tag following the one of the finest level
+    FreePersistentHaloRequests(aggregated_halos_mpi_[level]);
+    AggregateHalosPerPartnerRank(internal_boundaries_mpi_[level], level,
+                                 aggregated_halos_mpi_[level]);
+    if (level == maximum_level_) {
+      FreePersistentHaloRequests(aggregated_multi_halos_mpi_);
+      AggregateHalosPerPartnerRank(internal_multi_boundaries_mpi_,
+                                   maximum_level_ + 1,
+                                   aggregated_multi_halos_mpi_);
+    }
+  }
   boundaries_valid_[level] = true;
 }
 
+/**
+ * @brief Groups the mpi no-jump halos of a relation list by the rank of the
+ * communication partner. The order of the halos within one partner is kept,
+ * hence, it is consistent with the order on the partner rank.
+ * @param boundaries The (cached) relation list holding the mpi no-jump
+ * boundaries.
+ * @param tag Identifier of the relation list, identical on all ranks.
+ * @param exchanges Per-partner lists of halos to be sent and received (indirect
+ * return parameter). Sorted by ascending partner rank.
+ */
+void CommunicationManager::AggregateHalosPerPartnerRank(
+    std::vector<std::tuple<nid_t, BoundaryLocation, InternalBoundaryType>> const
+        &boundaries,
+    int const tag, std::vector<AggregatedHaloExchange> &exchanges) const {
+  exchanges.clear();
+  std::map<int, AggregatedHaloExchange> exchanges_per_partner;
+  for (auto const &[id, location, type] : boundaries) {
+    int const partner_rank =
+        topology_.GetRankOfNode(topology_.GetTopologyNeighborId(id, location));
+    AggregatedHaloExchange &exchange = exchanges_per_partner[partner_rank];
+    exchange.partner_rank_ = partner_rank;
+    exchange.tag_ = tag;
+    if (type == InternalBoundaryType::NoJumpBoundaryMpiSend) {
+      exchange.send_halos_.emplace_back(id, location);
+    } else {
+      exchange.recv_halos_.emplace_back(id, location);
+    }
+  }
+  exchanges.reserve(exchanges_per_partner.size());
+  for (auto &[partner_rank, exchange] : exchanges_per_partner) {
+    exchanges.push_back(std::move(exchange));
+  }
+}
+
+/**
+ * @brief Collects the local leaves of a level whose halos are completely filled
+ * by rank-local no-jump copies, i.e. which neither receive nor send mpi
+ * no-jump halos and have no jump or external boundaries. These leaves can be
+ * processed before the mpi part of a halo update has finished.
+ * @param level The level on which the leaves are collected.
+ * @note Must be called after the relation lists of the level are generated.
+ */
+void CommunicationManager::CollectRankLocalHaloLeaves(unsigned int const level) {
+  std::vector<nid_t> excluded_ids;
+  for (auto const &boundary : internal_boundaries_mpi_[level]) {
+    excluded_ids.push_back(std::get<0>(boundary));
+  }
+  for (auto const &boundary : internal_boundaries_jump_[level]) {
+    excluded_ids.push_back(std::get<0>(boundary));
+  }
+  for (auto const &boundary : internal_boundaries_jump_mpi_[level]) {
+    excluded_ids.push_back(std::get<0>(boundary));
+  }
+  for (auto const &boundary : external_boundaries_[level]) {
+    excluded_ids.push_back(std::get<0>(boundary));
+  }
+  std::sort(excluded_ids.begin(), excluded_ids.end());
+
+  rank_local_halo_leaves_[level].clear();
+  for (nid_t const id : topology_.LocalIdsOnLevel(level)) {
+    if (topology_.NodeIsLeaf(id) &&
+        !std::binary_search(excluded_ids.begin(), excluded_ids.end(), id)) {
+      rank_local_halo_leaves_[level].push_back(id);
+    }
+  }
+}
+
+/**
+ * @brief Releases all persistent requests bound to the given aggregated halo
+ * exchanges. The requests must not be active.
+ * @param exchanges The aggregated halo exchanges.
+ */
+void CommunicationManager::FreePersistentHaloRequests(
+    std::vector<AggregatedHaloExchange> &exchanges) const {
+  for (AggregatedHaloExchange &exchange : exchanges) {
+    for (MPI_Request &request : exchange.send_requests_) {
+      if (request != MPI_REQUEST_NULL) {
+        MPI_Request_free(&request);
+      }
+    }
+    for (MPI_Request &request : exchange.recv_requests_) {
+      if (request != MPI_REQUEST_NULL) {
+        MPI_Request_free(&request);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Ensures that the buffers of an aggregated halo exchange for the given
+ * field type have the given sizes and are bound to persistent requests. The
+ * requests are only (re-)created if a size has changed since the last call.
+ * @param exchange The aggregated halo exchange with one partner rank.
+ * @param field_type The field type the buffers are used for.
+ * @param send_size Number of values to be sent to the partner.
+ * @param recv_size Number of values to be received from the partner.
+ * @note The tag of a message is fixed by the relation list and the field type.
+ * Hence, both partners must prepare the requests of the same exchanges, which
+ * holds as halo updates are collective.
+ */
+void CommunicationManager::PreparePersistentHaloRequests(
+    AggregatedHaloExchange &exchange, MaterialFieldType const field_type,
+    unsigned int const send_size, unsigned int const recv_size) const {
+  auto const field_index = MFTTI(field_type);
+  int const tag =
+      exchange.tag_ * AggregatedHaloExchange::number_of_field_types_ +
+      field_index;
+
+  std::vector<double> &send_buffer = exchange.send_buffers_[field_index];
+  MPI_Request &send_request = exchange.send_requests_[field_index];
+  if (send_buffer.size() != send_size ||
+      (send_size > 0 && send_request == MPI_REQUEST_NULL)) {
+    if (send_request != MPI_REQUEST_NULL) {
+      MPI_Request_free(&send_request);
+    }
+    send_buffer.resize(send_size);
+    if (send_size > 0) {
+      MPI_Send_init(send_buffer.data(), send_size, MPI_DOUBLE,
+                    exchange.partner_rank_, tag, halo_communicator_,
+                    &send_request);
+    }
+  }
+
+  std::vector<double> &recv_buffer = exchange.recv_buffers_[field_index];
+  MPI_Request &recv_request = exchange.recv_requests_[field_index];
+  if (recv_buffer.size() != recv_size ||
+      (recv_size > 0 && recv_request == MPI_REQUEST_NULL)) {
+    if (recv_request != MPI_REQUEST_NULL) {
+      MPI_Request_free(&recv_request);
+    }
+    recv_buffer.resize(recv_size);
+    if (recv_size > 0) {
+      MPI_Recv_init(recv_buffer.data(), recv_size, MPI_DOUBLE,
+                    exchange.partner_rank_, tag, halo_communicator_,
+                    &recv_request);
+    }
+  }
+}
+
 namespace {
 
 /**
@@ -422,6 +602,40 @@ CommunicationManager::ExternalMultiBoundaries() const {
   return external_multi_boundaries_;
 }
 
+/**
+ * @brief Gives the local leaves on a given level whose halos are filled by
+ * rank-local no-jump copies only.
+ * @param level Level for which the leaves should be returned.
+ * @return Ids of the leaves.
+ */
+std::vector<nid_t> const &
+CommunicationManager::RankLocalHaloLeaves(unsigned int const level) const {
+  return rank_local_halo_leaves_[level];
+}
+
+/**
+ * @brief Gives a reference to the per-partner-rank aggregation of all mpi
+ * no-jump halos on a given level.
+ * @param level Level for which the aggregation should be returned.
+ * @return Aggregated halo exchanges, one entry per partner rank.
+ * @note Only filled if the aggregated halo exchange is active.
+ */
+std::vector<AggregatedHaloExchange> &
+CommunicationManager::AggregatedHalosMpi(unsigned int const level) {
+  return aggregated_halos_mpi_[level];
+}
+
+/**
+ * @brief Gives a reference to the per-partner-rank aggregation of all mpi
+ * no-jump halos between multi-material nodes on the maximum level.
+ * @return Aggregated halo exchanges, one entry per partner rank.
+ * @note Only filled if the aggregated halo exchange is active.
+ */
+std::vector<AggregatedHaloExchange> &
+CommunicationManager::AggregatedMultiHalosMpi() {
+  return aggregated_multi_halos_mpi_;
+}
+
 /**
  * @brief Gives a reference to the list for a given level holding all internal
  * jump boundary relations that require mpi communication.
@@ -22,6 +22,7 @@
 #ifndef COMMUNICATION_MANAGER_H
 #define COMMUNICATION_MANAGER_H
 
+#include "communication/aggregated_halo_exchange.h"
 #include "communication/communication_types.h"
 #include "communication/exchange_types.h"
 #include "internal_boundary_types.h"
@@ -75,6 +76,16 @@ class CommunicationManager : public CommunicationTypes {
       external_boundaries_;
   std::vector<std::tuple<nid_t, BoundaryLocation>> external_multi_boundaries_;
 
+  // Cache for the per-partner-rank aggregation of the mpi no-jump halos
+  std::vector<std::vector<AggregatedHaloExchange>> aggregated_halos_mpi_;
+  std::vector<AggregatedHaloExchange> aggregated_multi_halos_mpi_;
+  // Cache for the local leaves whose halos are only filled by rank-local
+  // no-jump copies
+  std::vector<std::vector<nid_t>> rank_local_halo_leaves_;
+  // Communicator for the persistent halo requests (separated from
+  // MPI_COMM_WORLD to avoid clashes between fixed and counted tags)
+  MPI_Comm halo_communicator_;
+
   // Vector holding flags dor each level that the lists have been created
   // successfully
   std::vector<bool> boundaries_valid_;
@@ -91,11 +102,24 @@ class CommunicationManager : public CommunicationTypes {
           &nodes_internal_boundaries,
       std::vector<std::tuple<nid_t, BoundaryLocation>> &external_boundaries);
 
+  // Function that groups the mpi no-jump halos of a relation list by partner
+  // rank
+  void AggregateHalosPerPartnerRank(
+      std::vector<std::tuple<nid_t, BoundaryLocation,
+                             InternalBoundaryType>> const &boundaries,
+      int const tag, std::vector<AggregatedHaloExchange> &exchanges) const;
+  // Function that finds the local leaves without mpi, jump or external halos
+  void CollectRankLocalHaloLeaves(unsigned int const level);
+  // Function that releases the persistent requests bound to the aggregated
+  // halos
+  void FreePersistentHaloRequests(
+      std::vector<AggregatedHaloExchange> &exchanges) const;
+
 public:
   CommunicationManager() = delete;
   explicit CommunicationManager(TopologyManager &topology,
                                 unsigned int const maximum_level);
-  ~CommunicationManager() = default;
+  ~CommunicationManager();
   CommunicationManager(CommunicationManager const &) = delete;
   CommunicationManager &operator=(CommunicationManager const &) = delete;
   CommunicationManager(CommunicationManager &&) = delete;
@@ -122,6 +146,9 @@ public:
   ExternalBoundaries(unsigned level) const;
   std::vector<std::tuple<nid_t, BoundaryLocation>> const &
   ExternalMultiBoundaries() const;
+  std::vector<AggregatedHaloExchange> &AggregatedHalosMpi(unsigned int level);
+  std::vector<AggregatedHaloExchange> &AggregatedMultiHalosMpi();
+  std::vector<nid_t> const &RankLocalHaloLeaves(unsigned int const level) const;
 
   // Functions to get the status of the list creations and to empty the flags to
   // regenerate the lists
@@ -136,6 +163,11 @@ public:
            int const destination_rank, std::vector<MPI_Request> &requests);
   int Recv(void *buf, int count, MPI_Datatype datatype, int source,
            std::vector<MPI_Request> &requests);
+  // Binds the buffers of an aggregated halo exchange to persistent requests
+  void PreparePersistentHaloRequests(AggregatedHaloExchange &exchange,
+                                     MaterialFieldType const field_type,
+                                     unsigned int const send_size,
+                                     unsigned int const recv_size) const;
 
   // Helping functions to provide current rank and partner tags (MyRankId as
   // member variable to avoid multiple calls of Mpi library)
@@ -114,10 +114,14 @@ void CommunicationTypes::CreateDataTypes() {
 
   int const tc_per_conservative = CC::TCX() * CC::TCY() * CC::TCZ();
   MPI_Type_contiguous(tc_per_conservative, MPI_DOUBLE, &single_conservatives_);
+  int const ibc_per_conservative = CC::IBCX() * CC::IBCY() * CC::IBCZ();
+  MPI_Type_contiguous(ibc_per_conservative, MPI_DOUBLE,
+                      &single_initial_conservatives_);
   int const tc_per_jump = MF::ANOE() * CC::ICY() * CC::ICZ();
   MPI_Type_contiguous(tc_per_jump, MPI_DOUBLE, &single_boundary_jump_);
 
   MPI_Type_commit(&single_conservatives_);
+  MPI_Type_commit(&single_initial_conservatives_);
   MPI_Type_commit(&single_boundary_jump_);
 }
 
@@ -151,6 +155,7 @@ void CommunicationTypes::FreeTypes() {
 
   // Whole block-struct
   MPI_Type_free(&single_conservatives_);
+  MPI_Type_free(&single_initial_conservatives_);
   MPI_Type_free(&single_boundary_jump_);
 }
 
@@ -187,6 +192,15 @@ MPI_Datatype CommunicationTypes::ConservativesDatatype() const {
   return single_conservatives_;
 }
 
+/**
+ * @brief Gives a MPI Datatype to send the full set of conservatives of the
+ * initial buffer, which may be stored without halo cells.
+ * @return The datatype for initial conservative buffer communication.
+ */
+MPI_Datatype CommunicationTypes::InitialConservativesDatatype() const {
+  return single_initial_conservatives_;
+}
+
 /**
  * @brief Gives a MPI Datatype to send the full set of jump buffers.
  * @return The datatype for jump surface buffer communication.
@@ -155,6 +155,7 @@ class CommunicationTypes {
   MPI_Datatype jump_cube_;
   // Datatypes for Load Balancing, sending whole Struct
   MPI_Datatype single_conservatives_;
+  MPI_Datatype single_initial_conservatives_;
   MPI_Datatype single_boundary_jump_;
 
   /**
@@ -179,6 +180,7 @@ public:
                             DatatypeForMpi const datatype) const;
   MPI_Datatype JumpPlaneSendDatatype(BoundaryLocation const location) const;
   MPI_Datatype ConservativesDatatype() const;
+  MPI_Datatype InitialConservativesDatatype() const;
   MPI_Datatype JumpSurfaceDatatype() const;
   MPI_Datatype AveragingSendDatatype(unsigned int const child_position,
                                      DatatypeForMpi const datatype) const;
@@ -38,7 +38,7 @@ InternalHaloManager::InternalHaloManager(
     unsigned int const number_of_materials)
     : tree_(tree), topology_(topology),
       communication_manager_(communication_manager),
-      number_of_materials_(number_of_materials) {
+      number_of_materials_(number_of_materials), pending_no_jump_requests_() {
   // Empty besides initializer list
 }
 
@@ -60,9 +60,15 @@ void InternalHaloManager::MaterialHaloUpdateOnLevel(
   // it is necessary that first the non-jump boundaries are carried out to
   // ensure that all parent nodes contain the correct information in their halo
   // cells
-  MpiMaterialHaloUpdateNoJump(
-      requests, communication_manager_.InternalBoundariesMpi(level),
-      field_type);
+  if constexpr (CC::AggregatedHaloExchangeActive()) {
+    MpiMaterialHaloUpdateAggregated(
+        requests, communication_manager_.AggregatedHalosMpi(level),
+        field_type);
+  } else {
+    MpiMaterialHaloUpdateNoJump(
+        requests, communication_manager_.InternalBoundariesMpi(level),
+        field_type);
+  }
   NoMpiMaterialHaloUpdate(communication_manager_.InternalBoundaries(level),
                           field_type);
   // Jump halo updates
@@ -94,6 +100,10 @@ void InternalHaloManager::MaterialHaloUpdateOnLevel(
     MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
   }
   requests.clear();
+  if constexpr (CC::AggregatedHaloExchangeActive()) {
+    FinishMaterialHaloUpdateAggregated(
+        communication_manager_.AggregatedHalosMpi(level), field_type);
+  }
 }
 
 void InternalHaloManager::MaterialHaloUpdateOnMultis(
@@ -103,13 +113,102 @@ void InternalHaloManager::MaterialHaloUpdateOnMultis(
       topology_.GetMaximumLevel());
 
   // update inner boundaries
-  MpiMaterialHaloUpdateNoJump(
-      requests, communication_manager_.InternalMultiBoundariesMpi(),
-      field_type);
+  if constexpr (CC::AggregatedHaloExchangeActive()) {
+    MpiMaterialHaloUpdateAggregated(
+        requests, communication_manager_.AggregatedMultiHalosMpi(),
+        field_type);
+  } else {
+    MpiMaterialHaloUpdateNoJump(
+        requests, communication_manager_.InternalMultiBoundariesMpi(),
+        field_type);
+  }
   NoMpiMaterialHaloUpdate(communication_manager_.InternalMultiBoundaries(),
                           field_type);
   MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
   requests.clear();
+  if constexpr (CC::AggregatedHaloExchangeActive()) {
+    FinishMaterialHaloUpdateAggregated(
+        communication_manager_.AggregatedMultiHalosMpi(), field_type);
+  }
+}
+
+/**
+ * @brief Starts the no-jump part of the internal halo update on the given
+ * levels. The mpi halos are posted and the rank-local no-jump halos are filled.
+ * The update is completed by EndMaterialNoJumpHaloUpdate, which must be called
+ * before the halo cells of nodes with mpi no-jump halos are used or their
+ * domain cells are changed.
+ * @param levels The levels on which no-jump halos of nodes will be modified.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ */
+void InternalHaloManager::BeginMaterialNoJumpHaloUpdate(
+    std::vector<unsigned int> const &levels,
+    MaterialFieldType const field_type) {
+  for (unsigned int const level : levels) {
+    communication_manager_.GenerateNeighborRelationForHaloUpdate(level);
+    if constexpr (CC::AggregatedHaloExchangeActive()) {
+      MpiMaterialHaloUpdateAggregated(
+          pending_no_jump_requests_,
+          communication_manager_.AggregatedHalosMpi(level), field_type);
+    } else {
+      MpiMaterialHaloUpdateNoJump(
+          pending_no_jump_requests_,
+          communication_manager_.InternalBoundariesMpi(level), field_type);
+    }
+    NoMpiMaterialHaloUpdate(communication_manager_.InternalBoundaries(level),
+                            field_type);
+  }
+}
+
+/**
+ * @brief Completes the no-jump part of the internal halo update started by
+ * BeginMaterialNoJumpHaloUpdate.
+ * @param levels The levels given to BeginMaterialNoJumpHaloUpdate.
+ * @param field_type The field type given to BeginMaterialNoJumpHaloUpdate.
+ */
+void InternalHaloManager::EndMaterialNoJumpHaloUpdate(
+    std::vector<unsigned int> const &levels,
+    MaterialFieldType const field_type) {
+  MPI_Waitall(pending_no_jump_requests_.size(),
+              pending_no_jump_requests_.data(), MPI_STATUSES_IGNORE);
+  pending_no_jump_requests_.clear();
+  if constexpr (CC::AggregatedHaloExchangeActive()) {
+    for (unsigned int const level : levels) {
+      FinishMaterialHaloUpdateAggregated(
+          communication_manager_.AggregatedHalosMpi(level), field_type);
+    }
+  }
+}
+
+/**
+ * @brief Adjusts the values in the jump halo cells on the given level. The
+ * no-jump halos of the parent level must be up to date.
+ * @param level The level on which jump halos of nodes will be modified.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ */
+void InternalHaloManager::MaterialJumpHaloUpdateOnLevel(
+    unsigned int const level, MaterialFieldType const field_type) {
+  std::vector<MPI_Request> requests;
+  communication_manager_.GenerateNeighborRelationForHaloUpdate(level);
+  std::vector<ExchangePlane> jump_buffer_plane(
+      MF::ANOF(field_type) * number_of_materials_ *
+      communication_manager_.JumpSendCount(level, ExchangeType::Plane));
+  std::vector<ExchangeStick> jump_buffer_stick(
+      MF::ANOF(field_type) * number_of_materials_ *
+      communication_manager_.JumpSendCount(level, ExchangeType::Stick));
+  std::vector<ExchangeCube> jump_buffer_cube(
+      MF::ANOF(field_type) * number_of_materials_ *
+      communication_manager_.JumpSendCount(level, ExchangeType::Cube));
+  MpiMaterialHaloUpdateJump(
+      requests, communication_manager_.InternalBoundariesJumpMpi(level),
+      jump_buffer_plane, jump_buffer_stick, jump_buffer_cube, field_type);
+  NoMpiMaterialHaloUpdate(communication_manager_.InternalBoundariesJump(level),
+                          field_type);
+  MPI_Waitall(
+      requests.size(), requests.data(),
+      MPI_STATUSES_IGNORE); // buffer-vectors need to be alive till this point
 }
 
 /**
@@ -894,6 +993,221 @@ void InternalHaloManager::MpiMaterialHaloUpdateNoJump(
   }
 }
 
+/**
+ * @brief Gives the number of values in an aggregated halo buffer. Only
+ * materials present in both the node and its neighbor are exchanged.
+ * @param halos The (node id, location) pairs contained in the buffer.
+ * @param number_of_fields The number of fields exchanged per material.
+ * @return Number of values in the buffer.
+ */
+unsigned int InternalHaloManager::AggregatedHaloSize(
+    std::vector<std::tuple<nid_t, BoundaryLocation>> const &halos,
+    unsigned int const number_of_fields) const {
+  unsigned int size = 0;
+  for (auto const &[id, location] : halos) {
+    nid_t const neighbor_id = topology_.GetTopologyNeighborId(id, location);
+    auto const halo_size = communication_manager_.GetHaloSize(location);
+    unsigned int const cells_per_field =
+        halo_size[0] * halo_size[1] * halo_size[2];
+    for (auto const material : topology_.GetMaterialsOfNode(id)) {
+      if (topology_.NodeContainsMaterial(neighbor_id, material)) {
+        size += number_of_fields * cells_per_field;
+      }
+    }
+  }
+  return size;
+}
+
+/**
+ * @brief Copies the domain cells adjacent to all halos to be sent to one
+ * partner rank into the contiguous send buffer of the exchange.
+ * @param exchange The exchange with the partner rank.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ */
+void InternalHaloManager::PackAggregatedMaterialHalos(
+    AggregatedHaloExchange &exchange,
+    MaterialFieldType const field_type) const {
+  unsigned int const number_of_fields = MF::ANOF(field_type);
+  double *buffer = exchange.send_buffers_[MFTTI(field_type)].data();
+  for (auto const &[id, location] : exchange.send_halos_) {
+    Node const &node = tree_.GetNodeWithId(id);
+    nid_t const neighbor_id = topology_.GetTopologyNeighborId(id, location);
+    auto const start_indices =
+        communication_manager_.GetStartIndicesHaloSend(location);
+    auto const halo_size = communication_manager_.GetHaloSize(location);
+    for (auto const material : topology_.GetMaterialsOfNode(id)) {
+      if (topology_.NodeContainsMaterial(neighbor_id, material)) {
+        Block const &block = node.GetPhaseByMaterial(material);
+        for (unsigned int field_index = 0; field_index < number_of_fields;
+             ++field_index) {
+          double const(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+              block.GetFieldBuffer(field_type, field_index);
+          for (int i = 0; i < halo_size[0]; ++i) {
+            for (int j = 0; j < halo_size[1]; ++j) {
+              for (int k = 0; k < halo_size[2]; ++k) {
+                *buffer++ = cells[start_indices[0] + i][start_indices[1] + j]
+                                 [start_indices[2] + k];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Copies the values received from one partner rank from the contiguous
+ * receive buffer of the exchange into the halo cells of the local nodes.
+ * @param exchange The exchange with the partner rank.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ */
+void InternalHaloManager::UnpackAggregatedMaterialHalos(
+    AggregatedHaloExchange const &exchange,
+    MaterialFieldType const field_type) {
+  unsigned int const number_of_fields = MF::ANOF(field_type);
+  double const *buffer = exchange.recv_buffers_[MFTTI(field_type)].data();
+  for (auto const &[id, location] : exchange.recv_halos_) {
+    Node &node = tree_.GetNodeWithId(id);
+    nid_t const neighbor_id = topology_.GetTopologyNeighborId(id, location);
+    auto const start_indices =
+        communication_manager_.GetStartIndicesHaloRecv(location);
+    auto const halo_size = communication_manager_.GetHaloSize(location);
+    for (auto const material : topology_.GetMaterialsOfNode(id)) {
+      if (topology_.NodeContainsMaterial(neighbor_id, material)) {
+        Block &block = node.GetPhaseByMaterial(material);
+        for (unsigned int field_index = 0; field_index < number_of_fields;
+             ++field_index) {
+          double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+              block.GetFieldBuffer(field_type, field_index);
+          for (int i = 0; i < halo_size[0]; ++i) {
+            for (int j = 0; j < halo_size[1]; ++j) {
+              for (int k = 0; k < halo_size[2]; ++k) {
+                cells[start_indices[0] + i][start_indices[1] + j]
+                     [start_indices[2] + k] = *buffer++;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Method used to execute the Halo Update for all no-jump boundaries with
+ * MPI Communication, sending a single message per partner rank and direction.
+ * @param requests vector of communication request (handle), new handles will be
+ * added at the end of the vector.
+ * @param exchanges The per-partner-rank aggregation of the no-jump boundaries.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ * @note The received values are only written into the halo cells by
+ * FinishMaterialHaloUpdateAggregated after the requests have been completed.
+ * With persistent halo requests the requests are started instead of posted,
+ * the handles added to the vector must then not be freed by the caller.
+ */
+void InternalHaloManager::MpiMaterialHaloUpdateAggregated(
+    std::vector<MPI_Request> &requests,
+    std::vector<AggregatedHaloExchange> &exchanges,
+    MaterialFieldType const field_type) {
+  unsigned int const number_of_fields = MF::ANOF(field_type);
+  auto const field_index = MFTTI(field_type);
+
+  if constexpr (CC::PersistentHaloRequestsActive()) {
+    // Receives are started before packing, the sends once all buffers are
+    // filled. The started requests are handed out for completion.
+    std::vector<MPI_Request> started_requests;
+    started_requests.reserve(exchanges.size());
+    for (AggregatedHaloExchange &exchange : exchanges) {
+      communication_manager_.PreparePersistentHaloRequests(
+          exchange, field_type,
+          AggregatedHaloSize(exchange.send_halos_, number_of_fields),
+          AggregatedHaloSize(exchange.recv_halos_, number_of_fields));
+      if (exchange.recv_requests_[field_index] != MPI_REQUEST_NULL) {
+        started_requests.push_back(exchange.recv_requests_[field_index]);
+      }
+    }
+    if (!started_requests.empty()) {
+      MPI_Startall(started_requests.size(), started_requests.data());
+    }
+    requests.insert(requests.end(), started_requests.begin(),
+                    started_requests.end());
+    started_requests.clear();
+
+    for (AggregatedHaloExchange &exchange : exchanges) {
+      PackAggregatedMaterialHalos(exchange, field_type);
+      CommunicationStatistics::no_jump_halos_send_ +=
+          exchange.send_halos_.size();
+      CommunicationStatistics::no_jump_halos_recv_ +=
+          exchange.recv_halos_.size();
+      if (exchange.send_requests_[field_index] != MPI_REQUEST_NULL) {
+        started_requests.push_back(exchange.send_requests_[field_index]);
+      }
+    }
+    if (!started_requests.empty()) {
+      MPI_Startall(started_requests.size(), started_requests.data());
+    }
+    requests.insert(requests.end(), started_requests.begin(),
+                    started_requests.end());
+    return;
+  }
+
+  int const my_rank = communication_manager_.MyRankId();
+  for (AggregatedHaloExchange &exchange : exchanges) {
+    int const send_size =
+        AggregatedHaloSize(exchange.send_halos_, number_of_fields);
+    int const recv_size =
+        AggregatedHaloSize(exchange.recv_halos_, number_of_fields);
+    std::vector<double> &send_buffer = exchange.send_buffers_[field_index];
+    std::vector<double> &recv_buffer = exchange.recv_buffers_[field_index];
+    send_buffer.resize(send_size);
+    recv_buffer.resize(recv_size);
+    PackAggregatedMaterialHalos(exchange, field_type);
+    CommunicationStatistics::no_jump_halos_send_ += exchange.send_halos_.size();
+    CommunicationStatistics::no_jump_halos_recv_ += exchange.recv_halos_.size();
+
+    // The lower rank of each pair sends first to keep the tags of both
+    // partners consistent. Empty messages are skipped on both sides alike.
+    if (my_rank < exchange.partner_rank_) {
+      if (send_size > 0) {
+        communication_manager_.Send(send_buffer.data(), send_size, MPI_DOUBLE,
+                                    exchange.partner_rank_, requests);
+      }
+      if (recv_size > 0) {
+        communication_manager_.Recv(recv_buffer.data(), recv_size, MPI_DOUBLE,
+                                    exchange.partner_rank_, requests);
+      }
+    } else {
+      if (recv_size > 0) {
+        communication_manager_.Recv(recv_buffer.data(), recv_size, MPI_DOUBLE,
+                                    exchange.partner_rank_, requests);
+      }
+      if (send_size > 0) {
+        communication_manager_.Send(send_buffer.data(), send_size, MPI_DOUBLE,
+                                    exchange.partner_rank_, requests);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Writes the values received in an aggregated halo update into the halo
+ * cells. Must only be called once the requests of the update are completed.
+ * @param exchanges The per-partner-rank aggregation of the no-jump boundaries.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ */
+void InternalHaloManager::FinishMaterialHaloUpdateAggregated(
+    std::vector<AggregatedHaloExchange> const &exchanges,
+    MaterialFieldType const field_type) {
+  for (AggregatedHaloExchange const &exchange : exchanges) {
+    UnpackAggregatedMaterialHalos(exchange, field_type);
+  }
+}
+
 /**
  * @brief Method used to execute the Halo Update for all boundaries without MPI
  * Communication.
@@ -42,6 +42,8 @@ private:
       &communication_manager_; // Cannot be const (for now NH TODO-19) because
                                // of new tagging system.
   unsigned int const number_of_materials_;
+  // Requests of a started, but not yet completed no-jump halo update
+  std::vector<MPI_Request> pending_no_jump_requests_;
 
   // Helper function for the local halo filling of special buffers
   template <class T>
@@ -108,6 +110,20 @@ private:
       std::vector<std::tuple<nid_t, BoundaryLocation,
                              InternalBoundaryType>> const &boundaries,
       MaterialFieldType const field_type);
+  unsigned int AggregatedHaloSize(
+      std::vector<std::tuple<nid_t, BoundaryLocation>> const &halos,
+      unsigned int const number_of_fields) const;
+  void PackAggregatedMaterialHalos(AggregatedHaloExchange &exchange,
+                                   MaterialFieldType const field_type) const;
+  void UnpackAggregatedMaterialHalos(AggregatedHaloExchange const &exchange,
+                                     MaterialFieldType const field_type);
+  void MpiMaterialHaloUpdateAggregated(
+      std::vector<MPI_Request> &requests,
+      std::vector<AggregatedHaloExchange> &exchanges,
+      MaterialFieldType const field_type);
+  void FinishMaterialHaloUpdateAggregated(
+      std::vector<AggregatedHaloExchange> const &exchanges,
+      MaterialFieldType const field_type);
   void MpiMaterialHaloUpdateJump(
       std::vector<MPI_Request> &requests,
       std::vector<std::tuple<nid_t, BoundaryLocation,
@@ -155,6 +171,13 @@ public:
 
   void MaterialHaloUpdateOnMultis(MaterialFieldType const field_type);
 
+  void BeginMaterialNoJumpHaloUpdate(std::vector<unsigned int> const &levels,
+                                     MaterialFieldType const field_type);
+  void EndMaterialNoJumpHaloUpdate(std::vector<unsigned int> const &levels,
+                                   MaterialFieldType const field_type);
+  void MaterialJumpHaloUpdateOnLevel(unsigned int const level,
+                                     MaterialFieldType const field_type);
+
   void InterfaceTagHaloUpdateOnLevel(unsigned int const level,
                                      InterfaceDescriptionBufferType const type);
 
@@ -0,0 +1,226 @@
+//===------------------- jump_buffer_exchanger.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "communication/jump_buffer_exchanger.h"
+
+#include <algorithm>
+#include <mpi.h>
+#include <utility>
+
+#include "communication/communication_types.h"
+#include "communication/mpi_utilities.h"
+#include "multiresolution/multiresolution.h"
+#include "topology/id_information.h"
+
+namespace {
+// Fixed tags suffice, as at most one message of each kind is in flight between
+// two ranks
+constexpr int averaging_tag = 0;
+constexpr int exchange_tag = 1;
+constexpr std::size_t face_size = JumpBufferSendingSize();
+} // namespace
+
+/**
+ * @brief Default constructor.
+ * @param topology TopologyManager providing the global node information.
+ * @param tree Tree holding the local nodes whose jump buffers are exchanged.
+ */
+JumpBufferExchanger::JumpBufferExchanger(TopologyManager const &topology,
+                                         Tree &tree)
+    : topology_(topology), tree_(tree), my_rank_(MpiUtilities::MyRankId()),
+      number_of_ranks_(MpiUtilities::NumberOfRanks()),
+      sent_faces_(number_of_ranks_), received_faces_(number_of_ranks_) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Appends a jump face to the faces sent to the given rank.
+ * @param face The jump face of all equations.
+ * @param rank The receiving rank.
+ */
+void JumpBufferExchanger::PackFace(
+    double const (&face)[MF::ANOE()][CC::ICY()][CC::ICZ()], int const rank) {
+  sent_faces_[rank].insert(sent_faces_[rank].end(), &face[0][0][0],
+                           &face[0][0][0] + face_size);
+}
+
+/**
+ * @brief Posts the receives of the given number of faces and the sends of the
+ * packed faces for all partner ranks and completes them.
+ * @param face_counts Number of faces to be received from each rank.
+ * @param tag The message tag.
+ */
+void JumpBufferExchanger::ExchangeFaces(
+    std::vector<std::size_t> const &face_counts, int const tag) {
+  std::vector<MPI_Request> requests;
+  for (int rank = 0; rank < number_of_ranks_; ++rank) {
+    received_faces_[rank].resize(face_counts[rank] * face_size);
+    if (face_counts[rank] > 0) {
+      requests.push_back(MPI_Request());
+      MPI_Irecv(received_faces_[rank].data(), received_faces_[rank].size(),
+                MPI_DOUBLE, rank, tag, MPI_COMM_WORLD, &requests.back());
+    }
+    if (!sent_faces_[rank].empty()) {
+      requests.push_back(MPI_Request());
+      MPI_Isend(sent_faces_[rank].data(), sent_faces_[rank].size(), MPI_DOUBLE,
+                rank, tag, MPI_COMM_WORLD, &requests.back());
+    }
+  }
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+  for (std::vector<double> &faces : sent_faces_) {
+    faces.clear();
+  }
+}
+
+/**
+ * @brief Indicates whether a leaf adjacent to the given neighbor takes its jump
+ * face from the neighbor, i.e. whether the neighbor exists and is refined.
+ * @param neighbor_id Id of the neighbor.
+ * @return True if the neighbor is a parent, false otherwise.
+ */
+bool JumpBufferExchanger::NeighborIsParent(nid_t const neighbor_id) const {
+  return topology_.NodeExists(neighbor_id) &&
+         !topology_.NodeIsLeaf(neighbor_id);
+}
+
+/**
+ * @brief Averages the jump buffers of all children on the given levels into
+ * their parents, local and remote ones alike.
+ * @param levels_descending Levels of the children, finest first. Level zero
+ * must not be contained.
+ * @note One message per partner rank and level is sent, as the averaging onto
+ * a level needs the averaged values of the level above.
+ */
+void JumpBufferExchanger::AverageJumpBuffersDown(
+    std::vector<unsigned int> const &levels_descending) {
+  for (auto const &level : levels_descending) {
+    // The order of the children must be identical on all ranks
+    std::vector<nid_t> child_ids = topology_.IdsOnLevel(level);
+    std::sort(child_ids.begin(), child_ids.end());
+    // Per partner rank: (child id, material) of the remote children averaged
+    // into local parents
+    std::vector<std::vector<std::pair<nid_t, MaterialName>>> children_to_receive(
+        number_of_ranks_);
+    std::vector<std::size_t> face_counts(number_of_ranks_, 0);
+
+    for (auto const &child_id : child_ids) {
+      nid_t const parent_id = ParentIdOfNode(child_id);
+      int const rank_of_child = topology_.GetRankOfNode(child_id);
+      int const rank_of_parent = topology_.GetRankOfNode(parent_id);
+      if (rank_of_child == my_rank_ && rank_of_parent == my_rank_) {
+        // Non MPI Averaging
+        Node &parent = tree_.GetNodeWithId(parent_id);
+        Node const &child = tree_.GetNodeWithId(child_id);
+        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
+          Multiresolution::AverageJumpBuffer(
+              child.GetPhaseByMaterial(material).GetBoundaryJumpConservatives(),
+              parent.GetPhaseByMaterial(material)
+                  .GetBoundaryJumpConservatives(),
+              child_id);
+        }
+      } else if (rank_of_child == my_rank_ && rank_of_parent != my_rank_) {
+        // Only the faces on the parent's boundary are averaged
+        Node const &child = tree_.GetNodeWithId(child_id);
+        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
+          for (BoundaryLocation const location : CC::ANBS()) {
+            if (FaceOnParentBoundary(child_id, location)) {
+              PackFace(child.GetPhaseByMaterial(material)
+                           .GetBoundaryJumpConservatives(location),
+                       rank_of_parent);
+            }
+          }
+        }
+      } else if (rank_of_child != my_rank_ && rank_of_parent == my_rank_) {
+        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
+          children_to_receive[rank_of_child].emplace_back(child_id, material);
+          face_counts[rank_of_child] += DTI(CC::DIM());
+        }
+      }
+    }
+
+    ExchangeFaces(face_counts, averaging_tag);
+
+    SurfaceBuffer childs_jump_buffer;
+    for (int rank = 0; rank < number_of_ranks_; ++rank) {
+      double const *face = received_faces_[rank].data();
+      for (auto const &[child_id, material] : children_to_receive[rank]) {
+        for (BoundaryLocation const location : CC::ANBS()) {
+          if (FaceOnParentBoundary(child_id, location)) {
+            std::copy_n(face, face_size,
+                        &GetBoundaryJump(childs_jump_buffer, location)[0][0][0]);
+            face += face_size;
+          }
+        }
+        Multiresolution::AverageJumpBuffer(
+            childs_jump_buffer,
+            tree_.GetNodeWithId(ParentIdOfNode(child_id))
+                .GetPhaseByMaterial(material)
+                .GetBoundaryJumpConservatives(),
+            child_id);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Sends the jump faces of local parents to the adjacent remote leaves
+ * and receives the jump faces of remote parents adjacent to local leaves. All
+ * levels are sent in one message per partner rank.
+ * @param sorted_leaf_ids_on_levels Ascendingly sorted ids of all (global)
+ * leaves per exchanging level.
+ * @return The faces received from each rank. They are ordered as the (local
+ * leaf, material, location) triples with a remote parent neighbor, walking the
+ * given leaves, the materials of each leaf and all natural boundary locations.
+ */
+std::vector<std::vector<double>> const &
+JumpBufferExchanger::ExchangeCoarseNeighborFaces(
+    std::vector<std::vector<nid_t>> const &sorted_leaf_ids_on_levels) {
+  std::vector<std::size_t> face_counts(number_of_ranks_, 0);
+  for (auto const &leaf_ids_on_level : sorted_leaf_ids_on_levels) {
+    for (auto const &leaf_id : leaf_ids_on_level) {
+      bool const leaf_on_my_rank = topology_.NodeIsOnRank(leaf_id, my_rank_);
+      for (MaterialName const material :
+           topology_.GetMaterialsOfNode(leaf_id)) {
+        for (auto const &location : CC::ANBS()) {
+          nid_t const neighbor_id =
+              topology_.GetTopologyNeighborId(leaf_id, location);
+          if (!NeighborIsParent(neighbor_id)) {
+            continue;
+          }
+          bool const neighbor_on_my_rank =
+              topology_.NodeIsOnRank(neighbor_id, my_rank_);
+          if (leaf_on_my_rank && !neighbor_on_my_rank) {
+            face_counts[topology_.GetRankOfNode(neighbor_id)]++;
+          } else if (!leaf_on_my_rank && neighbor_on_my_rank) {
+            PackFace(tree_.GetNodeWithId(neighbor_id)
+                         .GetPhaseByMaterial(material)
+                         .GetBoundaryJumpConservatives(
+                             OppositeDirection(location)),
+                     topology_.GetRankOfNode(leaf_id));
+          }
+        }
+      }
+    }
+  }
+
+  ExchangeFaces(face_counts, exchange_tag);
+  return received_faces_;
+}
@@ -0,0 +1,74 @@
+//===-------------------- jump_buffer_exchanger.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef JUMP_BUFFER_EXCHANGER_H
+#define JUMP_BUFFER_EXCHANGER_H
+
+#include "block_definitions/block.h"
+#include "topology/node_id_type.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Exchanges the jump buffers at resolution jumps between ranks. Jump
+ * faces are packed per partner rank and exchanged non-blocking, such that at
+ * most one message per partner rank is in flight at a time. Only the faces
+ * which are actually used are sent, i.e. the faces of a child on the boundary
+ * of its parent and the face of a parent adjacent to a coarser leaf.
+ * @note Sender and receiver walk the node ids in ascending order, hence the
+ * packing order on the sender matches the unpacking order on the receiver
+ * without per-message tags.
+ */
+class JumpBufferExchanger {
+
+  TopologyManager const &topology_;
+  Tree &tree_;
+
+  int const my_rank_;
+  int const number_of_ranks_;
+
+  // Per partner rank: the jump faces sent and received in one message
+  std::vector<std::vector<double>> sent_faces_;
+  std::vector<std::vector<double>> received_faces_;
+
+  void PackFace(double const (&face)[MF::ANOE()][CC::ICY()][CC::ICZ()],
+                int const rank);
+  void ExchangeFaces(std::vector<std::size_t> const &face_counts,
+                     int const tag);
+
+public:
+  JumpBufferExchanger() = delete;
+  explicit JumpBufferExchanger(TopologyManager const &topology, Tree &tree);
+  ~JumpBufferExchanger() = default;
+  JumpBufferExchanger(JumpBufferExchanger const &) = delete;
+  JumpBufferExchanger &operator=(JumpBufferExchanger const &) = delete;
+  JumpBufferExchanger(JumpBufferExchanger &&) = delete;
+  JumpBufferExchanger &operator=(JumpBufferExchanger &&) = delete;
+
+  bool NeighborIsParent(nid_t const neighbor_id) const;
+  void AverageJumpBuffersDown(std::vector<unsigned int> const &levels_descending);
+  std::vector<std::vector<double>> const &ExchangeCoarseNeighborFaces(
+      std::vector<std::vector<nid_t>> const &sorted_leaf_ids_on_levels);
+};
+
+#endif // JUMP_BUFFER_EXCHANGER_H
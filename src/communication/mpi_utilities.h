@@ -24,10 +24,47 @@
 
 #include <mpi.h>
 #include <numeric>
+#include <stdexcept>
 #include <vector>
 
+#include "user_specifications/compile_time_constants.h"
+
 namespace MpiUtilities {
 
+/**
+ * @brief Initializes MPI with the thread support required by the compiled
+ * configuration. Must be used by all entry points of the code.
+ * @param argc Pointer to the argument count (may be nullptr).
+ * @param argv Pointer to the arguments (may be nullptr).
+ * @note Throws if the MPI library does not provide the required thread
+ * support.
+ */
+inline void Initialize(int *argc, char ***argv) {
+  if constexpr (CC::AsynchronousOutputActive()) {
+    // Output is written by a background thread concurrently to the solver
+    // communication of the main thread.
+    int provided_thread_support;
+    MPI_Init_thread(argc, argv, MPI_THREAD_MULTIPLE, &provided_thread_support);
+    if (provided_thread_support < MPI_THREAD_MULTIPLE) {
+      throw std::runtime_error(
+          "MPI library does not support MPI_THREAD_MULTIPLE");
+    }
+  } else {
+#ifdef _OPENMP
+    // Only the main thread calls MPI, threads are spawned in between
+    // communication.
+    int provided_thread_support;
+    MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &provided_thread_support);
+    if (provided_thread_support < MPI_THREAD_FUNNELED) {
+      throw std::runtime_error(
+          "MPI library does not support MPI_THREAD_FUNNELED");
+    }
+#else
+    MPI_Init(argc, argv);
+#endif
+  }
+}
+
 /**
  * @brief Reduces a bool across MPI ranks.
  * @param input local bool.
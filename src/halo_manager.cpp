@@ -91,6 +91,49 @@ void HaloManager::MaterialHaloUpdateOnLevel(unsigned int const level,
   MaterialExternalHaloUpdateOnLevel(level, field_type);
 }
 
+/**
+ * @brief Starts a halo update on the given levels, which is completed by
+ * EndMaterialHaloUpdate. Only the no-jump halos are started, i.e. the mpi
+ * messages are posted and all rank-local no-jump halos are filled. Hence,
+ * between both calls, leaves listed in
+ * CommunicationManager::RankLocalHaloLeaves() may be processed while the
+ * messages are in flight. No other nodes must be changed in between.
+ * @param levels_ascending The levels on which halos of nodes will be modified
+ * in ascending order.
+ * @param field_type The decider whether a halo update for conservatives or for
+ * prime states is done.
+ */
+void HaloManager::BeginMaterialHaloUpdate(
+    std::vector<unsigned int> const &levels_ascending,
+    MaterialFieldType const field_type) const {
+  internal_halo_manager_.BeginMaterialNoJumpHaloUpdate(levels_ascending,
+                                                       field_type);
+}
+
+/**
+ * @brief Completes a halo update started by BeginMaterialHaloUpdate. Gives the
+ * same result as MaterialHaloUpdate with identical arguments.
+ * @param levels_ascending The levels given to BeginMaterialHaloUpdate.
+ * @param field_type The field type given to BeginMaterialHaloUpdate.
+ * @param cut_jumps Decider if jump halos should be updated on all specified
+ * level. If true: jumps will not be updated on the coarsest level in
+ * "levels_ascending".
+ * @note The jump halos of a level are filled from the parents, hence, the
+ * levels are finished in ascending order once all no-jump halos are present.
+ */
+void HaloManager::EndMaterialHaloUpdate(
+    std::vector<unsigned int> const &levels_ascending,
+    MaterialFieldType const field_type, bool const cut_jumps) const {
+  internal_halo_manager_.EndMaterialNoJumpHaloUpdate(levels_ascending,
+                                                     field_type);
+  for (unsigned int const level : levels_ascending) {
+    if (!cut_jumps || level != levels_ascending.front()) {
+      internal_halo_manager_.MaterialJumpHaloUpdateOnLevel(level, field_type);
+    }
+    MaterialExternalHaloUpdateOnLevel(level, field_type);
+  }
+}
+
 /**
  * @brief Adjusts the values in internal halo cells, according to their type.
  * @param level The level on which halos of nodes will be modified.
@@ -64,6 +64,13 @@ public:
                                 bool const cut_jumps = true) const;
   void MaterialHaloUpdateOnLmaxMultis(MaterialFieldType const field_type) const;
 
+  void
+  BeginMaterialHaloUpdate(std::vector<unsigned int> const &levels_ascending,
+                          MaterialFieldType const field_type) const;
+  void EndMaterialHaloUpdate(std::vector<unsigned int> const &levels_ascending,
+                             MaterialFieldType const field_type,
+                             bool const cut_jumps = false) const;
+
   void MaterialInternalHaloUpdateOnLevel(unsigned int const level,
                                          MaterialFieldType const field_type,
                                          bool const cut_jumps = false) const;
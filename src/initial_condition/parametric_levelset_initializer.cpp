@@ -65,18 +65,25 @@ std::vector<std::array<double, 3>> ComputeInterfaceCoordinates(
       UserExpression(parametric_expression, spatial_variable_names,
                      variables_names, parameteric_point));
 
+  // Storage of the coordinates, which are all obtained from one evaluation
+  std::array<double const *, 3> coordinate_results;
+  std::transform(std::cbegin(spatial_variable_names),
+                 std::cend(spatial_variable_names),
+                 std::begin(coordinate_results),
+                 [&parameteric_expression](std::string const variable) {
+                   return &parameteric_expression.GetVariableReference(variable);
+                 });
+
   std::array<double, 3> interface_point = {0.0, 0.0, 0.0};
 
   for (std::uint64_t i = 0; i < number_of_points[0]; ++i) {
     parameteric_point[0] = start_values[0] + double(i) * delta_increments[0];
     for (std::uint64_t j = 0; j < number_of_points[1]; ++j) {
       parameteric_point[1] = start_values[1] + double(j) * delta_increments[1];
-      std::transform(std::cbegin(spatial_variable_names),
-                     std::cend(spatial_variable_names),
-                     std::begin(interface_point),
-                     [&parameteric_expression](std::string const variable) {
-                       return parameteric_expression.GetValue(variable);
-                     });
+      parameteric_expression.Evaluate();
+      std::transform(std::cbegin(coordinate_results),
+                     std::cend(coordinate_results), std::begin(interface_point),
+                     [](double const *result) { return *result; });
       interface_coordinates.push_back(interface_point);
     }
   }
@@ -22,7 +22,58 @@
 #include "prime_state_initializer.h"
 
 #include "topology/id_information.h"
-#include "user_expression.h"
+
+namespace {
+/**
+ * @brief Compiles the prime state expressions of all materials.
+ * @param prime_state_expression_strings The expression string for all
+ * materials.
+ * @param prime_state_variable_names List of all names for the prime states.
+ * @param spatial_variable_names Names of the spatial input variables.
+ * @param cell_center_point Storage of the spatial input variables.
+ * @return The compiled expressions.
+ */
+std::vector<std::unique_ptr<UserExpression const>> CompileExpressions(
+    std::vector<std::string> const &prime_state_expression_strings,
+    std::vector<std::string> const &prime_state_variable_names,
+    std::vector<std::string> const &spatial_variable_names,
+    std::vector<double> &cell_center_point) {
+  std::vector<std::unique_ptr<UserExpression const>> expressions;
+  expressions.reserve(prime_state_expression_strings.size());
+  for (std::string const &expression_string : prime_state_expression_strings) {
+    expressions.push_back(std::make_unique<UserExpression const>(
+        expression_string, prime_state_variable_names, spatial_variable_names,
+        cell_center_point));
+  }
+  return expressions;
+}
+
+/**
+ * @brief Gives the storage of the results of all prime state expressions.
+ * @param expressions The compiled expressions of all materials.
+ * @param prime_state_variable_names List of all names for the prime states.
+ * @return Pointers to the results per material and prime state (nullptr if no
+ * variable name is given).
+ */
+std::vector<std::array<double const *, MF::ANOP()>> ResultStorage(
+    std::vector<std::unique_ptr<UserExpression const>> const &expressions,
+    std::vector<std::string> const &prime_state_variable_names) {
+  std::vector<std::array<double const *, MF::ANOP()>> results;
+  results.reserve(expressions.size());
+  for (auto const &expression : expressions) {
+    std::array<double const *, MF::ANOP()> material_results;
+    material_results.fill(nullptr);
+    for (PrimeState const p : MF::ASOP()) {
+      if (!prime_state_variable_names[PTI(p)].empty()) {
+        material_results[PTI(p)] =
+            &expression->GetVariableReference(prime_state_variable_names[PTI(p)]);
+      }
+    }
+    results.push_back(material_results);
+  }
+  return results;
+}
+} // namespace
 
 /**
  * @brief Constructs the prime state initializer to evaluate prime state values
@@ -34,6 +85,7 @@
  * @param dimensionalized_node_size_on_level_zero Size of a node on level zero
  * (dimensionalized form).
  * @param unit_handler Instance to provide (non-)dimensionalization operations.
+ * @note All expressions are compiled here once instead of once per node.
  */
 PrimeStateInitializer::PrimeStateInitializer(
     std::vector<std::string> const &prime_state_expression_strings,
@@ -43,6 +95,11 @@ PrimeStateInitializer::PrimeStateInitializer(
     : unit_handler_(unit_handler),
       prime_state_expression_strings_(prime_state_expression_strings),
       prime_state_variable_names_(prime_state_variable_names),
+      prime_state_expressions_(CompileExpressions(
+          prime_state_expression_strings_, prime_state_variable_names_,
+          spatial_variable_names_, cell_center_point_)),
+      prime_state_results_(
+          ResultStorage(prime_state_expressions_, prime_state_variable_names_)),
       dimensionalized_node_size_on_level_zero_(
           dimensionalized_node_size_on_level_zero) {
   /** Empty besides initializer list */
@@ -68,29 +125,28 @@ void PrimeStateInitializer::GetInitialPrimeStates(
   double const cell_size =
       CellSizeOfId(node_id, dimensionalized_node_size_on_level_zero_);
 
-  // create the expression
-  std::vector<double> cell_center_point(3, 0.0);
-  UserExpression const prime_state_expression(UserExpression(
-      prime_state_expression_strings_[MTI(material)],
-      prime_state_variable_names_, spatial_variable_names_, cell_center_point));
+  UserExpression const &prime_state_expression =
+      *prime_state_expressions_[MTI(material)];
+  std::array<double const *, MF::ANOP()> const &results =
+      prime_state_results_[MTI(material)];
 
-  // Loop through all cells to assign correct values to the buffer
+  // Loop through all cells to assign correct values to the buffer. The
+  // expression is evaluated once per cell for all prime states
   for (unsigned int i = 0; i < CC::ICX(); ++i) {
-    cell_center_point[0] = origin[0] + (double(i) + 0.5) * cell_size;
+    cell_center_point_[0] = origin[0] + (double(i) + 0.5) * cell_size;
     for (unsigned int j = 0; j < CC::ICY(); ++j) {
       if constexpr (CC::DIM() != Dimension::One)
-        cell_center_point[1] = origin[1] + (double(j) + 0.5) * cell_size;
+        cell_center_point_[1] = origin[1] + (double(j) + 0.5) * cell_size;
       for (unsigned int k = 0; k < CC::ICZ(); ++k) {
         if constexpr (CC::DIM() == Dimension::Three)
-          cell_center_point[2] = origin[2] + (double(k) + 0.5) * cell_size;
+          cell_center_point_[2] = origin[2] + (double(k) + 0.5) * cell_size;
+        prime_state_expression.Evaluate();
         for (PrimeState const p : MF::ASOP()) {
           // If the variable name is not empty obtain value from expression.
-          if (!prime_state_variable_names_[PTI(p)].empty()) {
+          if (results[PTI(p)] != nullptr) {
             prime_state_buffer[PTI(p)][i][j][k] =
-                unit_handler_.NonDimensionalizeValue(
-                    prime_state_expression.GetValue(
-                        prime_state_variable_names_[PTI(p)]),
-                    MF::FieldUnit(p));
+                unit_handler_.NonDimensionalizeValue(*results[PTI(p)],
+                                                     MF::FieldUnit(p));
           } else { // Otherwise set zero value
             prime_state_buffer[PTI(p)][i][j][k] = 0.0;
           }
@@ -22,6 +22,8 @@
 #ifndef PRIME_STATE_INITIALIZER_H
 #define PRIME_STATE_INITIALIZER_H
 
+#include <array>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -29,6 +31,7 @@
 #include "materials/material_definitions.h"
 #include "topology/node_id_type.h"
 #include "unit_handler.h"
+#include "user_expression.h"
 #include "user_specifications/compile_time_constants.h"
 
 /**
@@ -46,6 +49,17 @@ class PrimeStateInitializer {
   std::vector<std::string> const prime_state_variable_names_;
   std::vector<std::string> const spatial_variable_names_ = {"x", "y", "z"};
 
+  // Input of all expressions. The expressions are bound to its elements, which
+  // are changed during the (logically const) evaluation
+  mutable std::vector<double> cell_center_point_ = {0.0, 0.0, 0.0};
+  // The expressions are compiled once per material and evaluated once per cell
+  std::vector<std::unique_ptr<UserExpression const>> const
+      prime_state_expressions_;
+  // Storage of the expression results per material and prime state (nullptr
+  // for prime states without variable name)
+  std::vector<std::array<double const *, MF::ANOP()>> const
+      prime_state_results_;
+
   // Additional required variables
   double const dimensionalized_node_size_on_level_zero_;
 
@@ -52,11 +52,7 @@ StlLevelsetInitializer::StlLevelsetInitializer(
  */
 double StlLevelsetInitializer::ComputeSignedLevelsetValue(
     std::array<double, 3> const &point) {
-  double levelset = std::numeric_limits<double>::max();
-  for (StlUtilities::Triangle const &triangle : stl_triangles_) {
-    StlUtilities::Voxelization(triangle, point, levelset);
-  }
-  return levelset;
+  return stl_triangles_.SignedDistance(point);
 }
 
 /**
@@ -76,7 +72,7 @@ StlLevelsetInitializer::GetTypeLogData(unsigned int const indent) const {
                 "Filename           : " + stl_filename_ + "\n";
   // Number of triangles
   log_string += StringOperations::Indent(indent) + "Number of triangles: " +
-                std::to_string(stl_triangles_.size()) + "\n";
+                std::to_string(stl_triangles_.NumberOfTriangles()) + "\n";
 
   return log_string;
 }
@@ -38,7 +38,7 @@ class StlLevelsetInitializer : public LevelsetInitializer {
   // Member variables of this class only
   std::string const stl_filename_;
 
-  std::vector<StlUtilities::Triangle> stl_triangles_;
+  StlUtilities::BoundingVolumeHierarchy const stl_triangles_;
 
   // Functions required from base class
   double
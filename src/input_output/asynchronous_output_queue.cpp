@@ -0,0 +1,117 @@
+//===------------------ asynchronous_output_queue.cpp ---------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/asynchronous_output_queue.h"
+
+#include <utility>
+
+/**
+ * @brief Creates the queue and starts its background thread.
+ * @param maximum_pending_jobs The maximum number of jobs that are not finished
+ * yet (including the one in progress).
+ */
+AsynchronousOutputQueue::AsynchronousOutputQueue(
+    std::size_t const maximum_pending_jobs)
+    : maximum_pending_jobs_(maximum_pending_jobs), jobs_(),
+      job_in_progress_(false), shutdown_(false), failure_(nullptr) {
+  fegetenv(&floating_point_environment_);
+  worker_ = std::thread(&AsynchronousOutputQueue::ProcessJobs, this);
+}
+
+/**
+ * @brief Finishes all pending jobs and stops the background thread.
+ * @note Failures of jobs that are not reported before are dropped.
+ */
+AsynchronousOutputQueue::~AsynchronousOutputQueue() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  job_added_.notify_one();
+  worker_.join();
+}
+
+/**
+ * @brief Adds a job to the queue. Blocks while the maximum number of jobs is
+ * pending.
+ * @param job The job to be executed on the background thread.
+ * @note Rethrows the exception of a previously failed job.
+ */
+void AsynchronousOutputQueue::Enqueue(std::function<void()> job) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_finished_.wait(lock, [this]() {
+      return failure_ ||
+             jobs_.size() + (job_in_progress_ ? 1 : 0) < maximum_pending_jobs_;
+    });
+    if (failure_) {
+      std::rethrow_exception(std::exchange(failure_, nullptr));
+    }
+    jobs_.push_back(std::move(job));
+  }
+  job_added_.notify_one();
+}
+
+/**
+ * @brief Blocks until all jobs of the queue are finished.
+ * @note Rethrows the exception of a previously failed job.
+ */
+void AsynchronousOutputQueue::WaitUntilEmpty() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  job_finished_.wait(lock, [this]() {
+    return failure_ || (jobs_.empty() && !job_in_progress_);
+  });
+  if (failure_) {
+    std::rethrow_exception(std::exchange(failure_, nullptr));
+  }
+}
+
+/**
+ * @brief Work loop of the background thread. Executes the jobs in order until
+ * the queue is shut down and empty.
+ */
+void AsynchronousOutputQueue::ProcessJobs() {
+  // Threads do not inherit the floating-point environment of their creator
+  fesetenv(&floating_point_environment_);
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    job_added_.wait(lock, [this]() { return shutdown_ || !jobs_.empty(); });
+    if (jobs_.empty()) {
+      return;
+    }
+    std::function<void()> job = std::move(jobs_.front());
+    jobs_.pop_front();
+    job_in_progress_ = true;
+    lock.unlock();
+    std::exception_ptr failure = nullptr;
+    try {
+      job();
+    } catch (...) {
+      failure = std::current_exception();
+    }
+    lock.lock();
+    job_in_progress_ = false;
+    if (failure && !failure_) {
+      failure_ = failure;
+    }
+    job_finished_.notify_all();
+  }
+}
@@ -0,0 +1,74 @@
+//===------------------- asynchronous_output_queue.h ----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef ASYNCHRONOUS_OUTPUT_QUEUE_H
+#define ASYNCHRONOUS_OUTPUT_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <fenv.h>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief The AsynchronousOutputQueue class executes writing jobs (e.g. of
+ * output or restart snapshots) in order on a single background thread. The
+ * number of pending jobs is bounded. If the queue is full, adding a job blocks
+ * until the oldest job is finished. This limits the memory held by staged
+ * snapshots.
+ * @note Jobs are executed in the order they were added. If all ranks add the
+ * same jobs in the same order, jobs may perform collective operations on a
+ * communicator that is exclusively used by the background threads. The
+ * background thread runs in the floating-point environment (e.g. enabled
+ * floating-point exceptions) of the thread that created the queue.
+ */
+class AsynchronousOutputQueue {
+
+  std::size_t const maximum_pending_jobs_;
+  std::deque<std::function<void()>> jobs_;
+  bool job_in_progress_;
+  bool shutdown_;
+  std::exception_ptr failure_;
+  fenv_t floating_point_environment_;
+  std::mutex mutex_;
+  std::condition_variable job_added_;
+  std::condition_variable job_finished_;
+  std::thread worker_;
+
+  void ProcessJobs();
+
+public:
+  explicit AsynchronousOutputQueue(std::size_t const maximum_pending_jobs);
+  AsynchronousOutputQueue() = delete;
+  ~AsynchronousOutputQueue();
+  AsynchronousOutputQueue(AsynchronousOutputQueue const &) = delete;
+  AsynchronousOutputQueue &operator=(AsynchronousOutputQueue const &) = delete;
+  AsynchronousOutputQueue(AsynchronousOutputQueue &&) = delete;
+  AsynchronousOutputQueue &operator=(AsynchronousOutputQueue &&) = delete;
+
+  void Enqueue(std::function<void()> job);
+  void WaitUntilEmpty();
+};
+
+#endif // ASYNCHRONOUS_OUTPUT_QUEUE_H
@@ -23,14 +23,82 @@
 #define HDF5_DEFINITIONS_H
 
 #include <hdf5.h>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "utilities/string_operations.h"
+
 /**
  * @brief Enum class for the different access options of the hdf5 file.
  */
 enum class Hdf5Access { Read, Write };
 
+/**
+ * @brief The CompressionType enum defines how the datasets of the hdf5 files
+ * are compressed. (Off: No compression). (Lossless: Byte shuffling and deflate
+ * compression). (Lossy: Floating-point data is additionally rounded to a given
+ * number of decimal digits, i.e. the absolute error is bounded by 0.5 *
+ * 10^(-digits). Non floating-point data is compressed lossless).
+ */
+enum class CompressionType { Off, Lossless, Lossy };
+
+/**
+ * @brief Holds the compression settings of a dataset.
+ */
+struct DatasetCompression {
+  CompressionType type_ = CompressionType::Off;
+  // Number of decimal digits that are kept in lossy compression
+  int decimal_digits_ = 0;
+};
+
+/**
+ * @brief Gives the proper Compression type for a given string.
+ * @param compression_type String that should be converted.
+ * @return Compression type.
+ */
+inline CompressionType
+StringToCompressionType(std::string const &compression_type) {
+  // transform string to upper case without spaces
+  std::string const type_upper_case(
+      StringOperations::ToUpperCaseWithoutSpaces(compression_type));
+  // switch statements cannot be used with strings
+  if (type_upper_case == "OFF") {
+    return CompressionType::Off;
+  } else if (type_upper_case == "LOSSLESS") {
+    return CompressionType::Lossless;
+  } else if (type_upper_case == "LOSSY") {
+    return CompressionType::Lossy;
+  } else {
+    throw std::logic_error("Compression type '" + type_upper_case +
+                           "' not known!");
+  }
+}
+
+/**
+ * @brief Converts the CompressionType to its corresponding string (for
+ * logging).
+ * @param type The compression type identifier.
+ * @return String to be used.
+ */
+inline std::string CompressionTypeToString(CompressionType const type) {
+
+  switch (type) {
+  case CompressionType::Off: {
+    return "Off";
+  }
+  case CompressionType::Lossless: {
+    return "Lossless";
+  }
+  case CompressionType::Lossy: {
+    return "Lossy";
+  }
+  default: {
+    throw std::logic_error("Compression type is not known!");
+  }
+  }
+}
+
 /**
  * @brief Struct that provides all information required for accessing
  * (reading/writing) data from/to the hdf5 file. It provides all information
@@ -60,6 +128,9 @@ struct Hdf5Dataset {
   std::vector<hsize_t> start_indices_;
   std::vector<hsize_t> chunk_;
   std::vector<hsize_t> count_;
+  // Compression of the dataset (compressed datasets must be written
+  // collectively)
+  DatasetCompression compression_;
   // Identifier for opened and/or created datasets
   hid_t datatype_ = -1;
   hid_t properties_create_ = -1;
@@ -89,10 +160,13 @@ struct Hdf5Dataset {
 struct Hdf5Group {
   hid_t id_ = -1;
   hid_t properties_ = -1;
+  hid_t collective_properties_ = -1;
 
   void Close() {
     if (properties_ != -1)
       H5Pclose(properties_);
+    if (collective_properties_ != -1)
+      H5Pclose(collective_properties_);
     if (id_ != -1)
       H5Gclose(id_);
   }
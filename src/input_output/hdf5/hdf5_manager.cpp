@@ -21,13 +21,56 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/hdf5/hdf5_manager.h"
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <stdexcept>
 
+namespace {
+// Deflate level used for compressed datasets (1: fastest, 9: smallest)
+constexpr unsigned int deflate_level = 1;
+// Number of values a chunk of a reserved dataspace holds at most if it is
+// compressed (filters are applied per chunk)
+constexpr hsize_t values_per_compressed_chunk = 1 << 16;
+
+/**
+ * @brief Adds the filters of the given compression to the dataset creation
+ * properties.
+ * @param properties The dataset creation properties (chunk must be set).
+ * @param compression The compression of the dataset.
+ * @param datatype_id Hdf5 identifier of the datatype of the dataset.
+ * @note Lossy compression is only applied to floating-point data.
+ */
+void SetCompressionFilters(hid_t const properties,
+                           DatasetCompression const &compression,
+                           hid_t const datatype_id) {
+  if (compression.type_ == CompressionType::Off) {
+    return;
+  }
+  if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0 ||
+      (compression.type_ == CompressionType::Lossy &&
+       H5Zfilter_avail(H5Z_FILTER_SCALEOFFSET) <= 0)) {
+    throw std::runtime_error(
+        "The hdf5 library does not provide the filters for the compression!");
+  }
+  if (compression.type_ == CompressionType::Lossy &&
+      H5Tget_class(datatype_id) == H5T_FLOAT) {
+    // Rounds to the given number of decimal digits and stores the minimum
+    // number of bits
+    H5Pset_scaleoffset(properties, H5Z_SO_FLOAT_DSCALE,
+                       compression.decimal_digits_);
+  }
+  H5Pset_shuffle(properties);
+  H5Pset_deflate(properties, deflate_level);
+}
+} // namespace
+
 /**
  * @brief Default constructor (private).
  * @note can only be used to create a singleton hdf5 writer.
  */
-Hdf5Manager::Hdf5Manager() { /** Empty constructor */
+Hdf5Manager::Hdf5Manager() : communicator_(MPI_COMM_WORLD) {
+  /** Empty besides initializer list */
 }
 
 /**
@@ -39,6 +82,23 @@ Hdf5Manager::~Hdf5Manager() {
   }
 }
 
+/**
+ * @brief Sets the communicator that is used for the parallel access of all
+ * files opened subsequently. Default: MPI_COMM_WORLD.
+ * @param communicator The communicator. Must contain all ranks.
+ * @note Allows to access files from a thread other than the main thread without
+ * interfering with the communication on MPI_COMM_WORLD.
+ */
+void Hdf5Manager::SetCommunicator(MPI_Comm const communicator) {
+#ifndef PERFORMANCE
+  if (file_.is_open_) {
+    throw std::runtime_error(
+        "The communicator cannot be changed while a file is open!");
+  }
+#endif
+  communicator_ = communicator;
+}
+
 /**
  * @brief Opens a file to write/read hdf5 content into/from.
  * @param filename Name of the file.
@@ -58,7 +118,7 @@ void Hdf5Manager::OpenFile(std::string const &filename,
 
   // instantiates the file_properties
   file_.properties_ = H5Pcreate(H5P_FILE_ACCESS);
-  H5Pset_fapl_mpio(file_.properties_, MPI_COMM_WORLD, MPI_INFO_NULL);
+  H5Pset_fapl_mpio(file_.properties_, communicator_, MPI_INFO_NULL);
   // Opens the file
   file_.id_ = file_.access_type_ == Hdf5Access::Read
                   ? H5Fopen(filename.c_str(), H5F_ACC_RDONLY, file_.properties_)
@@ -97,12 +157,43 @@ void Hdf5Manager::OpenGroup(std::string const &group_name) {
                                H5P_DEFAULT, H5P_DEFAULT);
   group.properties_ = H5Pcreate(H5P_DATASET_XFER);
   H5Pset_dxpl_mpio(group.properties_, H5FD_MPIO_INDEPENDENT);
+  group.collective_properties_ = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(group.collective_properties_, H5FD_MPIO_COLLECTIVE);
   // Add the new group to the map
   groups_[group_name] = group;
   // Set the active group to the current opened group
   active_group_ = group_name;
 }
 
+/**
+ * @brief Creates a link in the opened file to the group of the same name in
+ * another file. Reading the linked group gives the content of the group in the
+ * other file.
+ * @param group_name Name of the group that is linked.
+ * @param target_filename Name of the file holding the group. A relative name is
+ * resolved relative to the directory of the opened file.
+ */
+void Hdf5Manager::LinkExternalGroup(std::string const &group_name,
+                                    std::string const &target_filename) const {
+#ifndef PERFORMANCE
+  // Check whether a file is already opened where the link could be created
+  if (!file_.is_open_ || file_.access_type_ == Hdf5Access::Read) {
+    throw std::runtime_error(
+        "Error linking group. No file is open for writing!");
+  }
+  // Check if the group already exists
+  if (groups_.find(group_name) != groups_.end()) {
+    throw std::runtime_error("Error linking group. The group already exists!");
+  }
+#endif
+  if (H5Lcreate_external(target_filename.c_str(), ("/" + group_name).c_str(),
+                         file_.id_, group_name.c_str(), H5P_DEFAULT,
+                         H5P_DEFAULT) < 0) {
+    throw std::runtime_error("Error linking group '" + group_name +
+                             "' to file '" + target_filename + "'!");
+  }
+}
+
 /**
  * @brief Activates the group with given tag to open datasets/dataspaces into
  * it.
@@ -170,6 +261,8 @@ hsize_t Hdf5Manager::GetDatasetExtent(std::string const &dataset_name) const {
  * starts to write the cell values.
  * @param datatype_id Hdf5 identifier which datatype should be used for the
  * dataset (e.g., H5T_NATIVE_ULLONG, H5_NATIVE_DOUBLE).
+ * @param compression The compression of the dataset. Compressed datasets must
+ * be written with WriteDatasetCollectively.
  *
  * @note The dataset is always appended to the current active group. Use
  * ActivateGroup function to control.
@@ -182,7 +275,8 @@ void Hdf5Manager::OpenDatasetForWriting(
     std::string const &dataset_name,
     std::vector<hsize_t> const &dataspace_total_dimensions,
     std::vector<hsize_t> const &dataset_local_dimensions,
-    hsize_t const local_elements_start_index, hid_t const datatype_id) {
+    hsize_t const local_elements_start_index, hid_t const datatype_id,
+    DatasetCompression const &compression) {
 #ifndef PERFORMANCE
   // Check if the active group flag is set
   if (active_group_.empty()) {
@@ -222,6 +316,10 @@ void Hdf5Manager::OpenDatasetForWriting(
   dataset.properties_create_ = H5Pcreate(H5P_DATASET_CREATE);
   H5Pset_chunk(dataset.properties_create_, dataset.chunk_.size(),
                dataset.chunk_.data());
+  // Compression filters are applied per chunk, i.e. per node/block/buffer
+  dataset.compression_ = compression;
+  SetCompressionFilters(dataset.properties_create_, dataset.compression_,
+                        dataset.datatype_);
 
   // Define the number of elements of the dataset that are written at once (per
   // dimension). Always 1 per dimension.
@@ -336,6 +434,8 @@ void Hdf5Manager::OpenDatasetForReading(
  * starts to write the cell values.
  * @param datatype_id Hdf5 identifier which datatype should be used for the
  * dataset (e.g., H5T_NATIVE_ULLONG, H5_NATIVE_DOUBLE).
+ * @param compression The compression of all datasets written with the
+ * dataspace.
  *
  * @note The dataset is always appended to the current active group. Use
  * ActivateGroup function to control.
@@ -347,7 +447,8 @@ void Hdf5Manager::ReserveDataspace(
     std::string const &dataspace_name,
     std::vector<hsize_t> const &dataspace_total_dimensions,
     std::vector<hsize_t> const &dataset_local_dimensions,
-    hsize_t const local_elements_start_index, hid_t const datatype_id) {
+    hsize_t const local_elements_start_index, hid_t const datatype_id,
+    DatasetCompression const &compression) {
 #ifndef PERFORMANCE
   // Check whether a group is already opened where the dataset could be appended
   if (active_group_.empty()) {
@@ -382,6 +483,25 @@ void Hdf5Manager::ReserveDataspace(
 
   // Store the dataset data type
   dataset.datatype_ = datatype_id;
+
+  // Compression requires a chunked layout. Empty dataspaces cannot be chunked
+  // and are not compressed
+  if (compression.type_ != CompressionType::Off &&
+      dataset.total_dimensions_.front() > 0) {
+    dataset.compression_ = compression;
+    // Each chunk holds all values of several consecutive elements (cells)
+    hsize_t const values_per_element = std::accumulate(
+        std::next(dataset.total_dimensions_.cbegin()),
+        dataset.total_dimensions_.cend(), hsize_t(1), std::multiplies<hsize_t>());
+    dataset.chunk_ = dataset.total_dimensions_;
+    dataset.chunk_.front() = std::clamp(
+        values_per_compressed_chunk / std::max(values_per_element, hsize_t(1)),
+        hsize_t(1), dataset.total_dimensions_.front());
+    H5Pset_chunk(dataset.properties_create_, dataset.chunk_.size(),
+                 dataset.chunk_.data());
+    SetCompressionFilters(dataset.properties_create_, dataset.compression_,
+                          dataset.datatype_);
+  }
   // Create the dataspace for the full simulation data of the given dimensions
   // (NULL marks that the dataspaced is fixed to the given dimensions)
   dataset.dataspace_id_ = H5Screate_simple(
@@ -22,10 +22,13 @@
 #ifndef HDF5_MANAGER_H
 #define HDF5_MANAGER_H
 
+#include <algorithm>
 #include <hdf5.h>
+#include <mpi.h>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "input_output/hdf5/hdf5_definitions.h"
@@ -43,6 +46,8 @@ class Hdf5Manager {
   std::unordered_map<std::string, Hdf5Group> groups_;
   // Member variables for specification of a single dataset
   std::unordered_map<std::string, Hdf5Dataset> datasets_;
+  // Communicator used for the parallel file access
+  MPI_Comm communicator_;
 
   // Constructor called from the singleton public constructor
   explicit Hdf5Manager();
@@ -57,6 +62,9 @@ public:
   Hdf5Manager(Hdf5Manager &&) = delete;
   Hdf5Manager &operator=(Hdf5Manager &&) = delete;
 
+  // Sets the communicator for all files opened subsequently
+  void SetCommunicator(MPI_Comm const communicator);
+
   // Functions to open, close files, groups, datasets and dataspaces
   void OpenFile(std::string const &filename,
                 Hdf5Access const access_type = Hdf5Access::Write);
@@ -64,12 +72,15 @@ public:
   void OpenGroup(std::string const &group_name);
   void ActivateGroup(std::string const &name);
   void CloseGroup(std::string const &group_name = "");
+  void LinkExternalGroup(std::string const &group_name,
+                         std::string const &target_filename) const;
   void
   OpenDatasetForWriting(std::string const &dataset_name,
                         std::vector<hsize_t> const &dataspace_total_dimensions,
                         std::vector<hsize_t> const &dataset_local_dimensions,
                         hsize_t const local_elements_start_index,
-                        hid_t const datatype_id = H5T_NATIVE_DOUBLE);
+                        hid_t const datatype_id = H5T_NATIVE_DOUBLE,
+                        DatasetCompression const &compression = {});
   void
   OpenDatasetForReading(std::string const &dataset_name,
                         std::vector<hsize_t> const &dataset_local_dimensions,
@@ -78,7 +89,8 @@ public:
                         std::vector<hsize_t> const &dataspace_total_dimensions,
                         std::vector<hsize_t> const &dataset_local_dimensions,
                         hsize_t const local_elements_start_index,
-                        hid_t const datatype_id);
+                        hid_t const datatype_id,
+                        DatasetCompression const &compression = {});
   void CloseDataset(std::string const &dataset_name = "");
   // Gives the extent of a dataset
   hsize_t GetDatasetExtent(std::string const &dataset_name) const;
@@ -151,6 +163,58 @@ public:
     dataset.start_indices_.front()++;
   }
 
+  /**
+   * @brief Writes several consecutive elements into an already opened dataset
+   * in one collective operation. It is the collective counterpart of
+   * WriteDataset, i.e. the dataset must be opened with OpenDatasetForWriting
+   * before.
+   * @param dataset_name Name of the dataset that is written (must conincide
+   * with the name used to open).
+   * @param buffer Pointer to the CONTIGUOUS buffer holding all elements that
+   * are written.
+   * @param number_of_elements The number of elements ( e.g. nodes or blocks )
+   * held in the buffer.
+   *
+   * @tparam BufferType Buffer type that is written.
+   * @note Must be called by all ranks, also by those without any elements to
+   * write.
+   */
+  template <typename BufferType>
+  void WriteDatasetCollectively(std::string const &dataset_name,
+                                BufferType const *buffer,
+                                hsize_t const number_of_elements) {
+#ifndef PERFORMANCE
+    // Check if the dataset was opened before
+    if (datasets_.find(dataset_name) == datasets_.end()) {
+      throw std::logic_error("Before writing to a dataset it must be opened!");
+    }
+#endif
+    // Get the correct dataset info
+    Hdf5Dataset &dataset = datasets_[dataset_name];
+    Hdf5Group const &group = groups_[dataset.group_name_];
+    // Define the memory space holding all elements at once
+    std::vector<hsize_t> dimensions(dataset.local_dimensions_);
+    dimensions.front() = std::max(number_of_elements, hsize_t(1));
+    hid_t const memory_space =
+        H5Screate_simple(dimensions.size(), dimensions.data(), NULL);
+    // Select the correct hyperslab
+    if (number_of_elements > 0) {
+      dimensions.front() = number_of_elements;
+      H5Sselect_hyperslab(dataset.local_hyperslab_, H5S_SELECT_SET,
+                          dataset.start_indices_.data(), NULL,
+                          dataset.count_.data(), dimensions.data());
+    } else {
+      H5Sselect_none(dataset.local_hyperslab_);
+      H5Sselect_none(memory_space);
+    }
+    // Write the local data to the given group
+    H5Dwrite(dataset.dataset_id_, dataset.datatype_, memory_space,
+             dataset.local_hyperslab_, group.collective_properties_, buffer);
+    H5Sclose(memory_space);
+    // Increment the dataset start index for the next writing process
+    dataset.start_indices_.front() += number_of_elements;
+  }
+
   /**
    * @brief Writes data into an already allocated dataspace. It is part of a
    * two-phase writing procedure:
@@ -166,6 +230,8 @@ public:
    * @param buffer Pointer to the CONTIGUOUS buffer that is written.
    *
    * @tparam BufferType Buffer type that is written.
+   * @note Must be called by all ranks if the dataspace was reserved with
+   * compression.
    */
   template <typename BufferType>
   void WriteDatasetToDataspace(std::string const &dataspace_name,
@@ -192,12 +258,21 @@ public:
         H5Screate_simple(dataset.local_dimensions_.size(),
                          dataset.local_dimensions_.data(), NULL);
     hid_t const local_hyperslab = H5Dget_space(dataset_id);
-    H5Sselect_hyperslab(local_hyperslab, H5S_SELECT_SET,
-                        dataset.start_indices_.data(), NULL,
-                        dataset.local_dimensions_.data(), NULL);
-    // Write the local dataset to the given group
+    if (dataset.local_dimensions_.front() > 0) {
+      H5Sselect_hyperslab(local_hyperslab, H5S_SELECT_SET,
+                          dataset.start_indices_.data(), NULL,
+                          dataset.local_dimensions_.data(), NULL);
+    } else {
+      H5Sselect_none(local_hyperslab);
+      H5Sselect_none(local_memory_space);
+    }
+    // Write the local dataset to the given group (compressed datasets can only
+    // be written collectively in parallel)
     H5Dwrite(dataset_id, dataset.datatype_, local_memory_space, local_hyperslab,
-             group.properties_, buffer);
+             dataset.compression_.type_ == CompressionType::Off
+                 ? group.properties_
+                 : group.collective_properties_,
+             buffer);
     // close all local reserved data
     H5Sclose(local_hyperslab);
     H5Sclose(local_memory_space);
@@ -300,6 +375,55 @@ public:
     H5Dread(dataset.dataset_id_, dataset.datatype_, dataset.local_memory_space_,
             dataset.local_hyperslab_, group.properties_, buffer);
   }
+
+  /**
+   * @brief Reads several ranges of elements from an opened dataset in one
+   * collective operation. It is the collective counterpart of ReadDataset, i.e.
+   * the dataset must be opened with OpenDatasetForReading before.
+   * @param dataset_name Name of the dataset that should be read.
+   * @param buffer Buffer where the read elements are stored into contiguously.
+   * @param ranges Start index and number of elements of each range that is
+   * read. Must be sorted ascendingly and must not overlap.
+   * @tparam BufferType Type of the buffer where data is stored.
+   * @note Must be called by all ranks, also by those without any elements to
+   * read. No sanity check is done that the provided buffer is large enough.
+   */
+  template <typename BufferType>
+  void ReadDatasetCollectively(
+      std::string const &dataset_name, BufferType *buffer,
+      std::vector<std::pair<hsize_t, hsize_t>> const &ranges) {
+#ifndef PERFORMANCE
+    // Check if the dataset was opened before
+    if (datasets_.find(dataset_name) == datasets_.end()) {
+      throw std::logic_error("Before reading a dataset it must be opened!");
+    }
+#endif
+    // Get the correct dataset info
+    Hdf5Dataset &dataset = datasets_[dataset_name];
+    Hdf5Group const &group = groups_[dataset.group_name_];
+    // Select all ranges in the file
+    H5Sselect_none(dataset.local_hyperslab_);
+    std::vector<hsize_t> dimensions(dataset.local_dimensions_);
+    hsize_t number_of_elements = 0;
+    for (auto const &[start, count] : ranges) {
+      dataset.start_indices_.front() = start;
+      dimensions.front() = count;
+      H5Sselect_hyperslab(dataset.local_hyperslab_, H5S_SELECT_OR,
+                          dataset.start_indices_.data(), NULL,
+                          dataset.count_.data(), dimensions.data());
+      number_of_elements += count;
+    }
+    // Define the memory space receiving all elements at once
+    dimensions.front() = std::max(number_of_elements, hsize_t(1));
+    hid_t const memory_space =
+        H5Screate_simple(dimensions.size(), dimensions.data(), NULL);
+    if (number_of_elements == 0) {
+      H5Sselect_none(memory_space);
+    }
+    H5Dread(dataset.dataset_id_, dataset.datatype_, memory_space,
+            dataset.local_hyperslab_, group.collective_properties_, buffer);
+    H5Sclose(memory_space);
+  }
 };
 
 #endif // HDF5_MANAGER_H
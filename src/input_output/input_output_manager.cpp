@@ -35,6 +35,7 @@
 #include "input_output/output_writer/output_definitions.h"
 #include "user_specifications/compile_time_constants.h"
 #include "user_specifications/debug_and_profile_setup.h"
+#include "utilities/string_operations.h"
 
 namespace {
 /**
@@ -99,7 +100,20 @@ InputOutputManager::InputOutputManager(
       restart_files_to_keep_(restart_intervals_to_keep),
       symlink_latest_restart_name_(
           output_folder_name_ + RestartSubfolderName() + LatestSnapshotName()),
-      wall_time_of_last_restart_file_(std::chrono::system_clock::now()) {
+      wall_time_of_last_restart_file_(std::chrono::system_clock::now()),
+      control_filename_(output_folder_name_ + "/CONTROLFILE"),
+      wall_time_of_last_control_poll_(std::chrono::system_clock::now()),
+      restart_requested_(false), output_requested_(false),
+      output_communicator_(MPI_COMM_NULL),
+      asynchronous_output_queue_(nullptr) {
+  // The background writer accesses the files through its own communicator to
+  // avoid interference with the communication of the simulation
+  if constexpr (CC::AsynchronousOutputActive()) {
+    MPI_Comm_dup(MPI_COMM_WORLD, &output_communicator_);
+    Hdf5Manager::Instance().SetCommunicator(output_communicator_);
+    asynchronous_output_queue_ = std::make_unique<AsynchronousOutputQueue>(
+        CC::AsynchronousOutputQueueLength());
+  }
   // This Barrier is needed, otherwise we get inconsistent folder names across
   // the ranks.
   MPI_Barrier(MPI_COMM_WORLD);
@@ -147,6 +161,12 @@ InputOutputManager::InputOutputManager(
  * and restart operations.
  */
 InputOutputManager::~InputOutputManager() {
+  // Finish all pending output before the time series files are closed
+  if constexpr (CC::AsynchronousOutputActive()) {
+    asynchronous_output_queue_.reset();
+    Hdf5Manager::Instance().SetCommunicator(MPI_COMM_WORLD);
+    MPI_Comm_free(&output_communicator_);
+  }
   // Finalizes the time series files
   std::string time_series_filename;
   if (standard_output_enabled_) {
@@ -218,10 +238,107 @@ void InputOutputManager::WriteTimestepFile(
   }
 }
 
+/**
+ * @brief Reads the commands for the running simulation. Only rank zero polls
+ * the file system, once the poll interval has passed. The file "ABORTFILE"
+ * aborts the simulation. The file "CONTROLFILE" holds one command per line
+ * ("abort", "restart", "output" or "output_interval <time>") and is deleted
+ * after reading, i.e. each command is carried out once.
+ * @return The commands read on rank zero (no commands on all other ranks).
+ * @note The commands must be distributed among all ranks and passed to
+ * ScheduleControlCommands.
+ */
+ControlCommands InputOutputManager::PollControlCommands() {
+  ControlCommands control_commands;
+  // only carry out for rank zero in the given wall-clock interval
+  if (MpiUtilities::MyRankId() != 0) {
+    return control_commands;
+  }
+  std::chrono::time_point<std::chrono::system_clock> const current_wall_time =
+      std::chrono::system_clock::now();
+  if (std::chrono::duration_cast<std::chrono::seconds>(
+          current_wall_time - wall_time_of_last_control_poll_)
+          .count() < CC::ControlFilePollInterval()) {
+    return control_commands;
+  }
+  wall_time_of_last_control_poll_ = current_wall_time;
+
+  control_commands.abort_ = CheckIfAbortfileExists();
+  if (!FileUtilities::CheckIfPathExists(control_filename_)) {
+    return control_commands;
+  }
+  std::ifstream control_file(control_filename_);
+  std::vector<std::string> ignored_lines;
+  ControlCommands const parsed_commands =
+      ControlUtilities::ParseControlCommands(control_file, ignored_lines);
+  for (std::string const &line : ignored_lines) {
+    logger_.LogMessage("Control file: ignored invalid command '" + line + "'");
+  }
+  control_commands.abort_ = control_commands.abort_ || parsed_commands.abort_;
+  control_commands.write_restart_ = parsed_commands.write_restart_;
+  control_commands.write_output_ = parsed_commands.write_output_;
+  control_commands.output_interval_ = unit_handler_.NonDimensionalizeValue(
+      parsed_commands.output_interval_, UnitType::Time);
+  control_file.close();
+  std::remove(control_filename_.c_str());
+  return control_commands;
+}
+
+/**
+ * @brief Schedules the commands given through the control file. Restart and
+ * output files are written with the next call of the respective function. A
+ * new output interval replaces all remaining standard and interface output
+ * time stamps (except for the end time). Intervals below the macro time step
+ * size are rejected, since at most one output is written per macro time step.
+ * @param control_commands The commands (identical on all ranks).
+ * @param current_time The current (non-dimensional) simulation time.
+ * @param macro_timestep_size The (non-dimensional) size of the current macro
+ * time step.
+ * @note The abort command has to be handled by the caller.
+ */
+void InputOutputManager::ScheduleControlCommands(
+    ControlCommands const &control_commands, double const current_time,
+    double const macro_timestep_size) {
+  if (control_commands.write_restart_) {
+    logger_.LogMessage("Control file: restart file requested");
+    restart_requested_ = true;
+  }
+  if (control_commands.write_output_) {
+    logger_.LogMessage("Control file: output requested");
+    output_requested_ = true;
+  }
+  if (control_commands.output_interval_ > 0.0) {
+    std::string const interval_string =
+        StringOperations::ToScientificNotationString(
+            unit_handler_.DimensionalizeValue(control_commands.output_interval_,
+                                              UnitType::Time),
+            9);
+    bool const standard_replaced = ControlUtilities::ReplaceTimeStampInterval(
+        standard_output_timestamps_, current_time,
+        control_commands.output_interval_, macro_timestep_size);
+    bool const interface_replaced = ControlUtilities::ReplaceTimeStampInterval(
+        interface_output_timestamps_, current_time,
+        control_commands.output_interval_, macro_timestep_size);
+    if (standard_replaced && interface_replaced) {
+      logger_.LogMessage("Control file: output interval changed to " +
+                         interval_string);
+    } else {
+      logger_.LogMessage(
+          "Control file: rejected output interval " + interval_string +
+          " below the macro time step size " +
+          StringOperations::ToScientificNotationString(
+              unit_handler_.DimensionalizeValue(macro_timestep_size,
+                                                UnitType::Time),
+              9));
+    }
+  }
+}
+
 /**
  * @brief Writes the full output (all outputs desired (standard, interface,
- * debug)) at the current timestep. If the force_output flag is set, output is
- * written in any case.
+ * debug)) at the current timestep. If the force_output flag is set or an
+ * output was requested through the control file, output is written in any
+ * case.
  * @param timestep The current timestep.
  * @param force_output A flag indicating whether output should be forced.
  * @return Return whether any output was written or not.
@@ -231,6 +348,9 @@ bool InputOutputManager::WriteFullOutput(double const timestep,
 
   // Flag to indicate that any output has been written
   bool output_written = false;
+  // A requested output is handled now
+  bool const output_forced = force_output || output_requested_;
+  output_requested_ = false;
 
   // dimensionalize time
   double const dimensionalized_time =
@@ -248,7 +368,7 @@ bool InputOutputManager::WriteFullOutput(double const timestep,
   if (standard_output_enabled_) {
     // Check wether the output is forced or the next desired standard time stamp
     // is smaller than the current
-    if (force_output || standard_output_timestamps_.front() <= timestep) {
+    if (output_forced || standard_output_timestamps_.front() <= timestep) {
       // erase the timestamps that are handled now (everything smaller than
       // current time step) This needs to be done since the macro timestep can
       // jump over several given timestamps
@@ -272,7 +392,7 @@ bool InputOutputManager::WriteFullOutput(double const timestep,
   if (interface_output_enabled_) {
     // Check wether the output is forced or the next desired interface time
     // stamp is smaller than the current
-    if (force_output || interface_output_timestamps_.front() <= timestep) {
+    if (output_forced || interface_output_timestamps_.front() <= timestep) {
       // erase the timestamps that are handled now (everything smaller than
       // current time step) This needs to be done since the macro timestep can
       // jump over several given timestamps
@@ -349,15 +469,28 @@ void InputOutputManager::WriteOutput(
   // Logging for the writing time of the output
   double const write_output_start_time = MPI_Wtime();
 
-  // Call the output writer for writing the output
-  output_writer_.WriteOutput(output_type, output_time,
-                             filename_without_extension,
-                             time_series_filename_without_extension);
-
-  // Final logging
-  logger_.LogMessage(
-      OutputTypeToString(output_type) + " output file written at t = " +
-      StringOperations::ToScientificNotationString(output_time, 9));
+  if constexpr (CC::AsynchronousOutputActive()) {
+    // Only the staging blocks the simulation, the files are written on the
+    // background thread (shared pointer since jobs must be copyable)
+    auto const snapshot = std::make_shared<OutputSnapshot const>(
+        output_writer_.StageOutput(output_type, output_time,
+                                   filename_without_extension,
+                                   time_series_filename_without_extension));
+    asynchronous_output_queue_->Enqueue([this, snapshot]() {
+      output_writer_.WriteOutputSnapshot(*snapshot);
+    });
+    logger_.LogMessage(
+        OutputTypeToString(output_type) + " output file queued at t = " +
+        StringOperations::ToScientificNotationString(output_time, 9));
+  } else {
+    // Call the output writer for writing the output
+    output_writer_.WriteOutput(output_type, output_time,
+                               filename_without_extension,
+                               time_series_filename_without_extension);
+    logger_.LogMessage(
+        OutputTypeToString(output_type) + " output file written at t = " +
+        StringOperations::ToScientificNotationString(output_time, 9));
+  }
 
   // Debug loggin information for full writing process
   if (DP::Profile()) {
@@ -430,7 +563,9 @@ void InputOutputManager::WriteRestartFile(double const timestep,
   // carry out restart writing if the restart is triggered by forcing, flagging
   // or timing
   if (snapshot_interval_triggered || snapshot_timestamp_triggered ||
-      force_output) {
+      force_output || restart_requested_) {
+    // A requested restart file is handled now
+    restart_requested_ = false;
 
     // erase the timestamps that are handled now (smaller than given timestep)
     RemoveTimeStamps(restart_snapshot_timestamps_, timestep);
@@ -441,29 +576,60 @@ void InputOutputManager::WriteRestartFile(double const timestep,
         time_naming_factor_));
     std::string const filename_without_extension(RestartFileName() + time_name);
 
-    // write the actual restart file and store its name
-    std::string snapshot_filename =
-        restart_manager_.WriteRestartFile(timestep, filename_without_extension);
-
-    // handle filesystem access only on rank zero
-    if (MpiUtilities::MyRankId() == 0) {
+    if constexpr (CC::AsynchronousOutputActive()) {
+      // Only the staging blocks the simulation, the file is written on the
+      // background thread (shared pointer since jobs must be copyable)
+      auto const snapshot = std::make_shared<RestartSnapshot const>(
+          restart_manager_.StageRestartSnapshot(timestep));
+      asynchronous_output_queue_->Enqueue([this, snapshot,
+                                           filename_without_extension,
+                                           snapshot_timestamp_triggered]() {
+        UpdateRestartFiles(restart_manager_.WriteRestartSnapshot(
+                               *snapshot, filename_without_extension),
+                           snapshot_timestamp_triggered);
+      });
+      logger_.LogMessage(
+          "Restart file queued at t = " +
+          StringOperations::ToScientificNotationString(timestep, 9));
+    } else {
+      // write the actual restart file and store its name
+      UpdateRestartFiles(restart_manager_.WriteRestartFile(
+                             timestep, filename_without_extension),
+                         snapshot_timestamp_triggered);
+    }
+  }
+}
 
-      // update symbolic link to latest snapshot file
-      std::remove(symlink_latest_restart_name_.c_str());
-      [[maybe_unused]] int const result_io =
-          symlink(FileUtilities::RemoveFilePath(snapshot_filename).c_str(),
-                  symlink_latest_restart_name_.c_str());
-
-      // only consider non-timestamp snapshots for deletion
-      if (!snapshot_timestamp_triggered) {
-        if (restart_files_written_.size() == restart_files_to_keep_) {
-          // remove the oldest file
-          std::remove(restart_files_written_.front().c_str());
-          restart_files_written_.erase(restart_files_written_.begin());
-        }
-        // add the newest file to the list
-        restart_files_written_.push_back(snapshot_filename);
+/**
+ * @brief Updates the symbolic link to the latest restart file and deletes old
+ * restart files depending on user configuration.
+ * @param snapshot_filename Name of the restart file that has been written.
+ * @param snapshot_timestamp_triggered Flag whether the restart file was written
+ * for a user given time stamp (such files are never deleted).
+ * @note Executed on the background thread if asynchronous output is active.
+ */
+void InputOutputManager::UpdateRestartFiles(
+    std::string const &snapshot_filename,
+    bool const snapshot_timestamp_triggered) {
+  // handle filesystem access only on rank zero
+  if (MpiUtilities::MyRankId() == 0) {
+    std::lock_guard<std::mutex> const lock(restart_files_mutex_);
+
+    // update symbolic link to latest snapshot file
+    std::remove(symlink_latest_restart_name_.c_str());
+    [[maybe_unused]] int const result_io =
+        symlink(FileUtilities::RemoveFilePath(snapshot_filename).c_str(),
+                symlink_latest_restart_name_.c_str());
+
+    // only consider non-timestamp snapshots for deletion
+    if (!snapshot_timestamp_triggered) {
+      if (restart_files_written_.size() == restart_files_to_keep_) {
+        // remove the oldest file
+        std::remove(restart_files_written_.front().c_str());
+        restart_files_written_.erase(restart_files_written_.begin());
       }
+      // add the newest file to the list
+      restart_files_written_.push_back(snapshot_filename);
     }
   }
 }
@@ -478,6 +644,11 @@ double InputOutputManager::RestoreSimulationFromSnapshot() {
   // Restart time that is returned (negative if restart is not carried out)
   double restart_time;
 
+  // The restart file must not be read while output is written
+  if constexpr (CC::AsynchronousOutputActive()) {
+    asynchronous_output_queue_->WaitUntilEmpty();
+  }
+
   // Add an empty line to the logger
   logger_.LogMessage(" ");
   // Change behavior dependent on given restore mode
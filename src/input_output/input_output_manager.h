@@ -25,10 +25,14 @@
 #include <chrono>
 #include <filesystem>
 #include <memory>
+#include <mpi.h>
+#include <mutex>
 
+#include "input_output/asynchronous_output_queue.h"
 #include "input_output/log_writer/log_writer.h"
 // #include "topology/topology_manager.h"
 // #include "topology/tree.h"
+#include "input_output/utilities/control_utilities.h"
 #include "input_output/utilities/file_utilities.h"
 #include "unit_handler.h"
 // #include "materials/material_manager.h"
@@ -43,7 +47,8 @@
  * unique output folder and delegates all output calls. It decides whether
  * simulation output or restart snapshots have to be written based on user
  * configuration and calls the respective routines. Furthermore, all used micro
- * time steps used in the simulation can be written to a file.
+ * time steps used in the simulation can be written to a file. Commands to the
+ * running simulation are read from a control file in the output folder.
  */
 class InputOutputManager {
   // Unit handler for dimensionalization of time
@@ -79,11 +84,27 @@ class InputOutputManager {
   std::vector<double> restart_snapshot_timestamps_;
   int const restart_snapshot_interval_;
   std::vector<std::string> restart_files_written_;
+  // Guards the restart file bookkeeping, which is updated by the background
+  // writer if asynchronous output is active
+  std::mutex restart_files_mutex_;
   unsigned int const restart_files_to_keep_;
   std::string const symlink_latest_restart_name_;
   std::chrono::time_point<std::chrono::system_clock>
       wall_time_of_last_restart_file_;
 
+  // Control file polling (only on rank zero) and the output requested through
+  // it (carried out with the next output call)
+  std::string const control_filename_;
+  std::chrono::time_point<std::chrono::system_clock>
+      wall_time_of_last_control_poll_;
+  bool restart_requested_;
+  bool output_requested_;
+
+  // Communicator exclusively used for the file access of the background writer
+  // and the writer itself (only used if asynchronous output is active)
+  MPI_Comm output_communicator_;
+  std::unique_ptr<AsynchronousOutputQueue> asynchronous_output_queue_;
+
   // Local function to create the  appropriate folder structure
   void CreateOutputFolder() const;
   // local function to write an output with additional logging
@@ -91,6 +112,9 @@ class InputOutputManager {
   WriteOutput(OutputType const output_type, double const output_time,
               std::string const &filename_without_extension,
               std::string const &time_series_filename_without_extension) const;
+  // local function to update the symbolic link and delete old restart files
+  void UpdateRestartFiles(std::string const &snapshot_filename,
+                          bool const snapshot_timestamp_triggered);
 
   // Functions for naming of files and folders
   /**
@@ -171,6 +195,15 @@ class InputOutputManager {
     return FileUtilities::CheckIfPathExists(restore_filename_);
   }
 
+  /**
+   * @brief Checks whether the file "ABORTFILE" exists in the output folder
+   * indicating that the simulation should be aborted.
+   * @return True if "ABORTFILE" exists, false otherwise.
+   */
+  inline bool CheckIfAbortfileExists() const {
+    return FileUtilities::CheckIfPathExists(output_folder_name_ + "/ABORTFILE");
+  }
+
 public:
   explicit InputOutputManager(
       std::string const &input_file, std::filesystem::path const &output_folder,
@@ -189,14 +222,11 @@ public:
   InputOutputManager(InputOutputManager &&) = delete;
   InputOutputManager &operator=(InputOutputManager &&) = delete;
 
-  /**
-   * @brief Checks whether the file "ABORTFILE" exists in the output folder
-   * indicating that the simulation should be aborted.
-   * @return True if "ABORTFILE" exists, false otherwise.
-   */
-  inline bool CheckIfAbortfileExists() const {
-    return FileUtilities::CheckIfPathExists(output_folder_name_ + "/ABORTFILE");
-  }
+  // Functions for the control of the running simulation
+  ControlCommands PollControlCommands();
+  void ScheduleControlCommands(ControlCommands const &control_commands,
+                               double const current_time,
+                               double const macro_timestep_size);
 
   // Function to write the time information to a file
   void
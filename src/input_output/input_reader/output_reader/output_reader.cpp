@@ -86,3 +86,38 @@ OutputReader::ReadOutputTimeStamps(OutputType const output_type) const {
 
   return time_stamps;
 }
+
+/**
+ * @brief Gives the checked compression settings used for the datasets of the
+ * standard, interface and debug output.
+ * @return Compression settings of the output datasets.
+ */
+DatasetCompression OutputReader::ReadOutputCompression() const {
+  DatasetCompression compression;
+  compression.type_ = StringToCompressionType(DoReadOutputCompressionType());
+  // The number of digits is only required for lossy compression
+  if (compression.type_ == CompressionType::Lossy) {
+    compression.decimal_digits_ = DoReadCompressionDecimalDigits();
+    if (compression.decimal_digits_ < 0) {
+      throw std::invalid_argument(
+          "Number of decimal digits for lossy compression must be positive!");
+    }
+  }
+  return compression;
+}
+
+/**
+ * @brief Gives the checked compression settings used for the datasets of the
+ * restart files.
+ * @return Compression settings of the restart datasets.
+ */
+DatasetCompression OutputReader::ReadRestartCompression() const {
+  DatasetCompression compression;
+  compression.type_ = StringToCompressionType(DoReadRestartCompressionType());
+  // The restored simulation must be identical to the one written
+  if (compression.type_ == CompressionType::Lossy) {
+    throw std::invalid_argument(
+        "Restart files can only be compressed lossless!");
+  }
+  return compression;
+}
@@ -25,6 +25,7 @@
 #include <string>
 #include <vector>
 
+#include "input_output/hdf5/hdf5_definitions.h"
 #include "input_output/output_writer/output_definitions.h"
 
 /**
@@ -46,6 +47,9 @@ protected:
   virtual double DoReadOutputInterval(OutputType const output_type) const = 0;
   virtual std::vector<double>
   DoReadOutputTimeStamps(OutputType const output_type) const = 0;
+  virtual std::string DoReadOutputCompressionType() const = 0;
+  virtual std::string DoReadRestartCompressionType() const = 0;
+  virtual int DoReadCompressionDecimalDigits() const = 0;
 
 public:
   virtual ~OutputReader() = default;
@@ -60,6 +64,8 @@ public:
   ReadOutputTimesType(OutputType const output_type) const;
   TEST_VIRTUAL double ReadOutputInterval(OutputType const output_type) const;
   std::vector<double> ReadOutputTimeStamps(OutputType const output_type) const;
+  TEST_VIRTUAL DatasetCompression ReadOutputCompression() const;
+  TEST_VIRTUAL DatasetCompression ReadRestartCompression() const;
 };
 
 #endif // OUTPUT_READER_H
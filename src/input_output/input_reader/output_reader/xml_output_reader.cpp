@@ -91,3 +91,47 @@ XmlOutputReader::DoReadOutputTimeStamps(OutputType const output_type) const {
 
   return XmlUtilities::ReadTimeStamps(stamp_node);
 }
+
+/**
+ * @brief See base class definition.
+ * @note The compression is optional. Returns "Off" if no compression is given.
+ */
+std::string XmlOutputReader::DoReadOutputCompressionType() const {
+  if (!XmlUtilities::ChildExists(*xml_input_file_, {"configuration", "output",
+                                                    "compression", "output"})) {
+    return "Off";
+  }
+  // Obtain correct node
+  tinyxml2::XMLElement const *type_node = XmlUtilities::GetChild(
+      *xml_input_file_, {"configuration", "output", "compression", "output"});
+
+  return XmlUtilities::ReadString(type_node);
+}
+
+/**
+ * @brief See base class definition.
+ * @note The compression is optional. Returns "Off" if no compression is given.
+ */
+std::string XmlOutputReader::DoReadRestartCompressionType() const {
+  if (!XmlUtilities::ChildExists(*xml_input_file_, {"configuration", "output",
+                                                    "compression", "restart"})) {
+    return "Off";
+  }
+  // Obtain correct node
+  tinyxml2::XMLElement const *type_node = XmlUtilities::GetChild(
+      *xml_input_file_, {"configuration", "output", "compression", "restart"});
+
+  return XmlUtilities::ReadString(type_node);
+}
+
+/**
+ * @brief See base class definition.
+ */
+int XmlOutputReader::DoReadCompressionDecimalDigits() const {
+  // Obtain correct node
+  tinyxml2::XMLElement const *digits_node = XmlUtilities::GetChild(
+      *xml_input_file_,
+      {"configuration", "output", "compression", "decimalDigits"});
+
+  return XmlUtilities::ReadInt(digits_node);
+}
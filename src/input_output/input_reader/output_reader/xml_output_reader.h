@@ -46,6 +46,9 @@ class XmlOutputReader : public OutputReader {
   double DoReadOutputInterval(OutputType const output_type) const override;
   std::vector<double>
   DoReadOutputTimeStamps(OutputType const output_type) const override;
+  std::string DoReadOutputCompressionType() const override;
+  std::string DoReadRestartCompressionType() const override;
+  int DoReadCompressionDecimalDigits() const override;
 
 public:
   XmlOutputReader() = delete;
@@ -128,7 +128,9 @@ void LogCompiledSettings() {
           std::to_string(FluxSplittingSettings::low_mach_number_limit_factor));
     }
   }
-  if constexpr (convective_term_solver == ConvectiveTermSolvers::FiniteVolume) {
+  if constexpr (convective_term_solver == ConvectiveTermSolvers::FiniteVolume ||
+                convective_term_solver ==
+                    ConvectiveTermSolvers::FiniteVolumePencil) {
     logger.LogMessage(
         "Riemann solver                                : " +
         StringOperations::RemoveLeadingNumbers(
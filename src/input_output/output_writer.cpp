@@ -23,7 +23,9 @@
 
 #include "communication/mpi_utilities.h"
 #include "topology/id_information.h"
+#include "user_specifications/compile_time_constants.h"
 
+#include "input_output/output_writer/mesh_generator/mesh_generator_utilities.h"
 #include "input_output/output_writer/output_definitions.h"
 #include "input_output/utilities/file_utilities.h"
 #include "input_output/utilities/xdmf_utilities.h"
@@ -53,9 +55,10 @@ OutputWriter::OutputWriter(
         material_output_quantities,
     std::vector<std::unique_ptr<OutputQuantity const>>
         interface_output_quantities,
-    unsigned int const number_of_materials)
+    unsigned int const number_of_materials,
+    DatasetCompression const &compression)
     : // Start initializer list
-      number_of_materials_(number_of_materials),
+      number_of_materials_(number_of_materials), compression_(compression),
       hdf5_manager_(Hdf5Manager::Instance()),
       standard_mesh_generator_(std::move(standard_mesh_generator)),
       debug_mesh_generator_(std::move(debug_mesh_generator)),
@@ -121,84 +124,160 @@ void OutputWriter::WriteOutput(
     OutputType const output_type, double const output_time,
     std::string const &filename_without_extension,
     std::string const &time_series_filename_without_extension) const {
+  WriteOutputSnapshot(StageOutput(output_type, output_time,
+                                  filename_without_extension,
+                                  time_series_filename_without_extension));
+}
+
+/**
+ * @brief Collects all data that is written for the given output type. The
+ * returned snapshot does not refer to the tree anymore.
+ * @param output_type Output type identifier for which the output is written
+ * (standard, interface, debug).
+ * @param output_time The time at which the simulation is currently at.
+ * @param filename_without_extension Filename without extension where the output
+ * is written to.
+ * @param time_series_filename_without_extension Name of the time series file
+ * (without extension). Empty if no time series file is appended.
+ * @return The output snapshot.
+ */
+OutputSnapshot OutputWriter::StageOutput(
+    OutputType const output_type, double const output_time,
+    std::string const &filename_without_extension,
+    std::string const &time_series_filename_without_extension) const {
 
+  OutputSnapshot snapshot;
+  snapshot.output_time_ = output_time;
   // Define the full path filename of the hdf5 file
-  std::string const hdf5_filename(filename_without_extension + ".h5");
+  snapshot.hdf5_filename_ = filename_without_extension + ".h5";
+  snapshot.time_series_filename_without_extension_ =
+      time_series_filename_without_extension;
   // Obtain the correct mesh generator for the given output (ternary operator
   // used to avoid new function declaration and allow constness)
   MeshGenerator const &mesh_generator =
       output_type == OutputType::Debug       ? *debug_mesh_generator_
       : output_type == OutputType::Interface ? *interface_mesh_generator_
                                              : *standard_mesh_generator_;
-  // Call the writing function with the specific mesh_generator
-  WriteHdf5File(output_time, hdf5_filename, mesh_generator, output_type);
-  // Only write xdmf on rank 0 to avoid write conflicts
+  // Collect the data of the hdf5 file (the mesh topology only if it cannot be
+  // linked from a previous file). The topology revision is identical on all
+  // ranks, hence all ranks take the same decision. Files are linked by their
+  // short filename, i.e. all outputs of the same type must be written into the
+  // same directory
+  snapshot.linked_mesh_topology_filename_ =
+      mesh_topology_links_.LinkableFilename(
+          output_type, mesh_generator.GetTopologyRevision(),
+          FileUtilities::RemoveFilePath(snapshot.hdf5_filename_));
+  if (snapshot.linked_mesh_topology_filename_.empty()) {
+    if (CC::BlockStructuredOutputActive() && output_type != OutputType::Debug) {
+      StageBlockGeometry(mesh_generator, snapshot);
+    } else {
+      StageMeshTopology(mesh_generator, snapshot);
+    }
+  }
+  StageCellData(mesh_generator, output_type, snapshot);
+  // The xdmf files are only written on rank 0 to avoid write conflicts
   if (MpiUtilities::MyRankId() == 0) {
-    // Write the single time step xdmf file
-    WriteXdmfTimeStepFile(output_time, hdf5_filename, mesh_generator,
-                          output_type);
-    // Append the xdmf information to the time series file (ir required)
+    std::string const xdmf_spatial_data = XdmfSpatialDataInformation(
+        output_time, FileUtilities::RemoveFilePath(snapshot.hdf5_filename_),
+        mesh_generator, output_type);
+    // The single time step file holds header and footer
+    snapshot.xdmf_time_step_content_ =
+        XdmfUtilities::HeaderInformation("TimeStep") + xdmf_spatial_data +
+        XdmfUtilities::FooterInformation();
+    // The time series file only gets the spatial data appended
     if (!time_series_filename_without_extension.empty()) {
-      AppendToXdmfTimeSeriesFile(output_time, hdf5_filename, mesh_generator,
-                                 time_series_filename_without_extension,
-                                 output_type);
+      snapshot.xdmf_time_series_content_ = xdmf_spatial_data;
     }
   }
+
+  return snapshot;
 }
 
 /**
- * @brief Writes a single time step xdmf file for a given time step.
- * @param output_time Time at which the output is written.
- * @param hdf5_filename Filename of the hdf5 file (absolute path), where the
- * data information was written.
- * @param mesh_generator The mesh generator instance which was used to write the
- * output.
- * @param output_type Type of the output to be written (standard, interface,
- * debug).
+ * @brief Writes a previously staged output snapshot into the hdf5 and xdmf
+ * files.
+ * @param snapshot The staged output snapshot.
+ * @note Does not access the tree. Must be called by all ranks (collective file
+ * access).
  */
-void OutputWriter::WriteXdmfTimeStepFile(double const output_time,
-                                         std::string const &hdf5_filename,
-                                         MeshGenerator const &mesh_generator,
-                                         OutputType const output_type) const {
-
-  // Append header of the file
-  std::string xdmf_content(XdmfUtilities::HeaderInformation("TimeStep"));
-  // Append core information of the xdmf file (topology, geometry and cell data)
-  xdmf_content += XdmfSpatialDataInformation(
-      output_time, FileUtilities::RemoveFilePath(hdf5_filename), mesh_generator,
-      output_type);
-  // Append the footer information
-  xdmf_content += XdmfUtilities::FooterInformation();
-
-  // Write the complete content to the xdmf file
-  FileUtilities::WriteTextBasedFile(
-      FileUtilities::ChangeFileExtension(hdf5_filename, ".xdmf"), xdmf_content);
+void OutputWriter::WriteOutputSnapshot(OutputSnapshot const &snapshot) const {
+  // Write the hdf5 file on all ranks
+  WriteHdf5File(snapshot);
+  // Only write xdmf on rank 0 to avoid write conflicts
+  if (MpiUtilities::MyRankId() == 0) {
+    // Write the single time step xdmf file
+    FileUtilities::WriteTextBasedFile(
+        FileUtilities::ChangeFileExtension(snapshot.hdf5_filename_, ".xdmf"),
+        snapshot.xdmf_time_step_content_);
+    // Append the xdmf information to the time series file (if required)
+    if (!snapshot.time_series_filename_without_extension_.empty()) {
+      FileUtilities::AppendToTextBasedFile(
+          snapshot.time_series_filename_without_extension_ + ".xdmf",
+          snapshot.xdmf_time_series_content_);
+    }
+  }
 }
 
 /**
- * @brief Append the data to the time series xdmf file.
- * @param output_time Time at which the output is written.
- * @param hdf5_filename Hdf5 file (absolute path), where the data information
- * was written.
+ * @brief Writes the information contained in the xdmf file for the
+ * block-structured output. Each block is a uniform grid in a spatial collection,
+ * whose cell data is a hyperslab of the datasets of all blocks.
+ * @param output_time Time where the output is written.
+ * @param hdf5_short_filename short filename of the hdf5 file (without path
+ * information).
  * @param mesh_generator The mesh generator instance which was used to write the
  * output.
- * @param output_type Type of the output to be written (standard, interface,
- * debug).
+ * @param output_type Type of the output to be used (standard, interface).
+ * @return String of the Xdmf data that should be written.
  */
-void OutputWriter::AppendToXdmfTimeSeriesFile(
-    double const output_time, std::string const &hdf5_filename,
-    MeshGenerator const &mesh_generator,
-    std::string const &time_series_filename_without_extension,
-    OutputType const output_type) const {
-
-  // Generate the core which should be appended to the file (use incrementing
-  // grid names)
-  std::string const xdmf_content = XdmfSpatialDataInformation(
-      output_time, FileUtilities::RemoveFilePath(hdf5_filename), mesh_generator,
-      output_type);
-  // Append content to the file of the time series
-  FileUtilities::AppendToTextBasedFile(
-      time_series_filename_without_extension + ".xdmf", xdmf_content);
+std::string OutputWriter::XdmfBlockStructuredDataInformation(
+    double const output_time, std::string const &hdf5_short_filename,
+    MeshGenerator const &mesh_generator, OutputType const output_type) const {
+
+  std::string const spatial_data_name(
+      "SpatialData_" +
+      StringOperations::ToScientificNotationString(output_time, 6));
+  hsize_t const global_number_cells = mesh_generator.GetGlobalNumberOfCells();
+  hsize_t const global_number_blocks =
+      global_number_cells /
+      MeshGeneratorUtilities::NumberOfInternalCellsPerBlock();
+  std::string const geometry_name_prefix = "mesh_topology/";
+  // Declare output string
+  std::string xdmf_content;
+  // Append the time information (empty line afterwards for visual separation)
+  xdmf_content += XdmfUtilities::TimeDataItem(output_time);
+  xdmf_content += '\n';
+  // Append one uniform grid for each block
+  for (hsize_t block = 0; block < global_number_blocks; ++block) {
+    std::string block_content = XdmfUtilities::BlockTopologyString(
+        {CC::ICX(), CC::ICY(), CC::ICZ()});
+    block_content += XdmfUtilities::BlockGeometryString(
+        XdmfUtilities::HyperSlabDataItemString(
+            hdf5_short_filename,
+            geometry_name_prefix + mesh_generator.GetBlockOriginsName(),
+            {global_number_blocks, 3}, {block, 0}, {1, 3}, "3"),
+        XdmfUtilities::HyperSlabDataItemString(
+            hdf5_short_filename,
+            geometry_name_prefix + mesh_generator.GetBlockSpacingsName(),
+            {global_number_blocks, 3}, {block, 0}, {1, 3}, "3"));
+    for (auto const &output_quantity : material_output_quantities_) {
+      if (output_quantity->IsActive(output_type)) {
+        block_content += output_quantity->GetXdmfBlockAttributeString(
+            hdf5_short_filename, "cell_data", global_number_cells, block);
+      }
+    }
+    for (auto const &output_quantity : interface_output_quantities_) {
+      if (output_quantity->IsActive(output_type)) {
+        block_content += output_quantity->GetXdmfBlockAttributeString(
+            hdf5_short_filename, "cell_data", global_number_cells, block);
+      }
+    }
+    xdmf_content += XdmfUtilities::SpatialDataInformation(
+        "Block_" + std::to_string(block), block_content);
+  }
+  // return the string including surrounding collection information
+  return XdmfUtilities::SpatialCollectionInformation(spatial_data_name,
+                                                     xdmf_content);
 }
 
 /**
@@ -216,6 +295,11 @@ std::string OutputWriter::XdmfSpatialDataInformation(
     double const output_time, std::string const &hdf5_short_filename,
     MeshGenerator const &mesh_generator, OutputType const output_type) const {
 
+  if (CC::BlockStructuredOutputActive() && output_type != OutputType::Debug) {
+    return XdmfBlockStructuredDataInformation(
+        output_time, hdf5_short_filename, mesh_generator, output_type);
+  }
+
   // Declare the grid name with a prefix and given time used in the name of the
   // hdf5 file
   std::string const spatial_data_name(
@@ -264,85 +348,81 @@ std::string OutputWriter::XdmfSpatialDataInformation(
 }
 
 /**
- * @brief Writes the data into the hdf5 file.
- * @param hdf5_filename Filename of the hdf5 file (absolute path).
+ * @brief Collects the vertex IDs and vertex coordinates of the mesh.
  * @param mesh_generator The mesh generator to be used for the output.
- * @param output_type Type of the output that is considered (standard,
- * interface, debug).
+ * @param snapshot The snapshot where the data is stored (indirect return).
  */
-void OutputWriter::WriteHdf5File(double const output_time,
-                                 std::string const &hdf5_filename,
-                                 MeshGenerator const &mesh_generator,
-                                 OutputType const output_type) const {
-
-  /** Open the hdf5 file */
-  hdf5_manager_.OpenFile(hdf5_filename);
-
-  /** Write metadata into the hdf5 file (currently only time) */
-  hdf5_manager_.OpenGroup("metadata");
-  hdf5_manager_.WriteAttributeScalar("time", output_time, H5T_NATIVE_DOUBLE);
-  hdf5_manager_.CloseGroup();
-
-  /** Write complete mesh topology information into the hdf5 file */
-  // Open mesh topology group
-  hdf5_manager_.OpenGroup("mesh_topology");
+void OutputWriter::StageMeshTopology(MeshGenerator const &mesh_generator,
+                                     OutputSnapshot &snapshot) const {
 
   /** Vertex IDs */
   // Define the hdf5 dataset properties for vertex ids
-  std::vector<hsize_t> const global_dimensions_vertex_ids =
+  snapshot.vertex_ids_.global_dimensions_ =
       mesh_generator.GetGlobalDimensionsOfVertexIDs();
-  std::vector<hsize_t> const local_dimensions_vertex_ids =
+  snapshot.vertex_ids_.local_dimensions_ =
       mesh_generator.GetLocalDimensionsOfVertexIDs();
-  hsize_t const start_index_vertex_ids =
+  snapshot.vertex_ids_.start_index_ =
       mesh_generator.GetLocalVertexIDsStartIndex();
-
-  // Declare the vector where the vertex IDs are written into. The vector is not
-  // initialized with a certain size since done inside of the mesh generator
+  // Compute the vertex IDs (size is assigned inside of the mesh generator)
   std::vector<unsigned long long int> vertex_ids;
-  // Compute the vertex coordinates
   mesh_generator.ComputeVertexIDs(vertex_ids);
-  // Reserve storage for the vertex IDs dataset and define hyperslab positions
-  hdf5_manager_.ReserveDataspace("VertexIDs", global_dimensions_vertex_ids,
-                                 local_dimensions_vertex_ids,
-                                 start_index_vertex_ids, H5T_NATIVE_ULLONG);
-  // Write data to the dataset
-  hdf5_manager_.WriteDatasetToDataspace(
-      "VertexIDs", mesh_generator.GetVertexIDsName(), vertex_ids.data());
-  // Release the memory for the dataset
-  hdf5_manager_.CloseDataset("VertexIDs");
+  snapshot.vertex_ids_.data_.emplace_back(mesh_generator.GetVertexIDsName(),
+                                          std::move(vertex_ids));
 
   /** Vertex coordinates */
   // Define the hdf5 dataset properties for vertex coordinates
-  std::vector<hsize_t> const global_dimensions_vertex_coordinates =
+  snapshot.vertex_coordinates_.global_dimensions_ =
       mesh_generator.GetGlobalDimensionsOfVertexCoordinates();
-  std::vector<hsize_t> const local_dimensions_vertex_coordinates =
+  snapshot.vertex_coordinates_.local_dimensions_ =
       mesh_generator.GetLocalDimensionsOfVertexCoordinates();
-  hsize_t const start_index_vertex_coordinates =
+  snapshot.vertex_coordinates_.start_index_ =
       mesh_generator.GetLocalVertexCoordinatesStartIndex();
-
-  // Declare the vector where the vertex coordinates are written into. The
-  // vector is not initialized with a certain size since done inside of the mesh
-  // generator
+  // Compute the vertex coordinates (size is assigned inside of the mesh
+  // generator)
   std::vector<double> vertex_coordinates;
-  // Compute the vertex coordinates
   mesh_generator.ComputeVertexCoordinates(vertex_coordinates);
-  // Reserve storage for the vertex coordinates dataset and define hyperslab
-  // positions
-  hdf5_manager_.ReserveDataspace(
-      "VertexCoordinates", global_dimensions_vertex_coordinates,
-      local_dimensions_vertex_coordinates, start_index_vertex_coordinates,
-      H5T_NATIVE_DOUBLE);
-  // Write data to the dataset
-  hdf5_manager_.WriteDatasetToDataspace(
-      "VertexCoordinates", mesh_generator.GetVertexCoordinatesName(),
-      vertex_coordinates.data());
+  snapshot.vertex_coordinates_.data_.emplace_back(
+      mesh_generator.GetVertexCoordinatesName(), std::move(vertex_coordinates));
+}
 
-  /** 2.4 Close domain group (automatically closes open datasets) */
-  hdf5_manager_.CloseGroup();
+/**
+ * @brief Collects the origins and spacings of the blocks for the
+ * block-structured output.
+ * @param mesh_generator The mesh generator to be used for the output.
+ * @param snapshot The snapshot where the data is stored (indirect return).
+ */
+void OutputWriter::StageBlockGeometry(MeshGenerator const &mesh_generator,
+                                      OutputSnapshot &snapshot) const {
+  hsize_t const cells_per_block =
+      MeshGeneratorUtilities::NumberOfInternalCellsPerBlock();
+  // Define the hdf5 dataset properties for both origins and spacings
+  snapshot.block_geometry_.global_dimensions_ = {
+      mesh_generator.GetGlobalNumberOfCells() / cells_per_block, 3};
+  snapshot.block_geometry_.local_dimensions_ = {
+      mesh_generator.GetLocalNumberOfCells() / cells_per_block, 3};
+  snapshot.block_geometry_.start_index_ =
+      mesh_generator.GetLocalCellsStartIndex() / cells_per_block;
+  // Compute the block origins and spacings
+  std::vector<double> block_origins;
+  std::vector<double> block_spacings;
+  mesh_generator.ComputeBlockGeometry(block_origins, block_spacings);
+  snapshot.block_geometry_.data_.emplace_back(
+      mesh_generator.GetBlockOriginsName(), std::move(block_origins));
+  snapshot.block_geometry_.data_.emplace_back(
+      mesh_generator.GetBlockSpacingsName(), std::move(block_spacings));
+}
 
-  /** Write cell fields into the hdf5 file */
-  /** Open group where cell data is written to*/
-  hdf5_manager_.OpenGroup("cell_data");
+/**
+ * @brief Computes the cell data of all quantities that are active for the given
+ * output type.
+ * @param mesh_generator The mesh generator to be used for the output.
+ * @param output_type Type of the output that is considered (standard,
+ * interface, debug).
+ * @param snapshot The snapshot where the data is stored (indirect return).
+ */
+void OutputWriter::StageCellData(MeshGenerator const &mesh_generator,
+                                 OutputType const output_type,
+                                 OutputSnapshot &snapshot) const {
 
   /** Define parameters used for all cell fields */
   // Local nodes that are written to the hdf5 file by the current rank
@@ -356,26 +436,20 @@ void OutputWriter::WriteHdf5File(double const output_time,
   hsize_t const local_cells_start_index =
       mesh_generator.GetLocalCellsStartIndex();
 
-  // Data vector for each quantity (not initialized here. Size is assigned in
-  // the dimension loop)
-  std::vector<double> cell_data;
-
   // Loop through all different material quantities dimensions
   for (auto const &[dimensions, quantity_indices] :
        material_quantities_dimension_map_) {
 
-    // Data vector for each cell data (done here to avoid multiple calls to
-    // allocate and deallocate memory in each quantity)
-    cell_data.resize(local_number_of_cells * dimensions[0] * dimensions[1]);
-
-    // Reserve the dataset dataspace for all quantities of this dimension
-    std::vector<hsize_t> const global_dimensions(
-        {global_number_of_cells, dimensions[0], dimensions[1]});
-    std::vector<hsize_t> const local_dimensions(
-        {local_number_of_cells, dimensions[0], dimensions[1]});
-    hdf5_manager_.ReserveDataspace("BlockCellData", global_dimensions,
-                                   local_dimensions, local_cells_start_index,
-                                   H5T_NATIVE_DOUBLE);
+    // Define the dataset dataspace for all quantities of this dimension
+    OutputDatasetSnapshot<double> &dataset =
+        snapshot.block_cell_data_.emplace_back();
+    dataset.global_dimensions_ = {global_number_of_cells, dimensions[0],
+                                  dimensions[1]};
+    dataset.local_dimensions_ = {local_number_of_cells, dimensions[0],
+                                 dimensions[1]};
+    dataset.start_index_ = local_cells_start_index;
+    std::size_t const data_size =
+        local_number_of_cells * dimensions[0] * dimensions[1];
 
     // Loop through all quantities with the given dimension
     for (auto const &quantity_index : quantity_indices) {
@@ -388,46 +462,37 @@ void OutputWriter::WriteHdf5File(double const output_time,
           // Loop through all materials given in the current simulation
           for (size_t material_index = 0; material_index < number_of_materials_;
                material_index++) {
-            // Append the quantity to the hdf5 file
+            std::vector<double> cell_data(data_size);
             output_quantity->ComputeDebugCellData(local_nodes, cell_data,
                                                   ITM(material_index));
-            // Open the dataset with the appropriate name
-            hdf5_manager_.WriteDatasetToDataspace(
-                "BlockCellData",
-                "material_" + std::to_string(material_index + 1) + "_" +
-                    output_quantity->GetName(),
-                cell_data.data());
+            dataset.data_.emplace_back("material_" +
+                                           std::to_string(material_index + 1) +
+                                           "_" + output_quantity->GetName(),
+                                       std::move(cell_data));
           }
         } else {
           // Compute the cell data of the given quantity
+          std::vector<double> cell_data(data_size);
           output_quantity->ComputeCellData(local_nodes, cell_data);
-          // Write data to hdf5 file
-          hdf5_manager_.WriteDatasetToDataspace(
-              "BlockCellData", output_quantity->GetName(), cell_data.data());
+          dataset.data_.emplace_back(output_quantity->GetName(),
+                                     std::move(cell_data));
         }
       }
     }
-
-    // Release the dataset dataspace
-    hdf5_manager_.CloseDataset("BlockCellData");
   }
 
-  // Loop through all different material quantities dimensions
+  // Loop through all different interface quantities dimensions
   for (auto const &[dimensions, quantity_indices] :
        interface_quantities_dimension_map_) {
 
-    // Data vector for each cell data (done here to avoid multiple calls to
-    // allocate and deallocate memory in each quantity)
-    cell_data.resize(local_number_of_cells * dimensions[0] * dimensions[1]);
-
-    // Reserve the dataset dataspace for all quantities of this dimension
-    std::vector<hsize_t> const global_dimensions(
-        {global_number_of_cells, dimensions[0], dimensions[1]});
-    std::vector<hsize_t> const local_dimensions(
-        {local_number_of_cells, dimensions[0], dimensions[1]});
-    hdf5_manager_.ReserveDataspace("InterfaceBlockCellData", global_dimensions,
-                                   local_dimensions, local_cells_start_index,
-                                   H5T_NATIVE_DOUBLE);
+    // Define the dataset dataspace for all quantities of this dimension
+    OutputDatasetSnapshot<double> &dataset =
+        snapshot.interface_block_cell_data_.emplace_back();
+    dataset.global_dimensions_ = {global_number_of_cells, dimensions[0],
+                                  dimensions[1]};
+    dataset.local_dimensions_ = {local_number_of_cells, dimensions[0],
+                                 dimensions[1]};
+    dataset.start_index_ = local_cells_start_index;
 
     // Loop through all quantities with the given dimension
     for (auto const &quantity_index : quantity_indices) {
@@ -437,27 +502,96 @@ void OutputWriter::WriteHdf5File(double const output_time,
       // Check if the quantity is active for the given output type
       if (output_quantity->IsActive(output_type)) {
         // Compute the cell data depending on the given output type
+        std::vector<double> cell_data(local_number_of_cells * dimensions[0] *
+                                      dimensions[1]);
         if (output_type == OutputType::Debug) {
           output_quantity->ComputeDebugCellData(local_nodes, cell_data);
         } else {
           output_quantity->ComputeCellData(local_nodes, cell_data);
         }
-
-        // Open the dataset with the appropriate name
-        hdf5_manager_.WriteDatasetToDataspace("InterfaceBlockCellData",
-                                              output_quantity->GetName(),
-                                              cell_data.data());
+        dataset.data_.emplace_back(output_quantity->GetName(),
+                                   std::move(cell_data));
       }
     }
+  }
+}
 
-    // Release the dataset dataspace
-    hdf5_manager_.CloseDataset("InterfaceBlockCellData");
+/**
+ * @brief Writes all data of a staged dataset into the currently open group.
+ * @param dataset_name Name of the dataspace that is reserved for the data.
+ * @param dataset The staged dataset.
+ * @param datatype The hdf5 datatype of the data.
+ * @param compression The compression of the data.
+ * @tparam T Type of the data.
+ */
+template <typename T>
+void OutputWriter::WriteDatasetSnapshot(
+    std::string const &dataset_name, OutputDatasetSnapshot<T> const &dataset,
+    hid_t const datatype, DatasetCompression const &compression) const {
+  // Reserve the dataset dataspace for all data of this dimension
+  hdf5_manager_.ReserveDataspace(dataset_name, dataset.global_dimensions_,
+                                 dataset.local_dimensions_,
+                                 dataset.start_index_, datatype, compression);
+  // Write data to the dataset
+  for (auto const &[name, data] : dataset.data_) {
+    hdf5_manager_.WriteDatasetToDataspace(dataset_name, name, data.data());
   }
+  // Release the dataset dataspace
+  hdf5_manager_.CloseDataset(dataset_name);
+}
 
-  /** Close group */
+/**
+ * @brief Writes the data into the hdf5 file.
+ * @param snapshot The staged output snapshot.
+ */
+void OutputWriter::WriteHdf5File(OutputSnapshot const &snapshot) const {
+
+  /** Open the hdf5 file */
+  hdf5_manager_.OpenFile(snapshot.hdf5_filename_);
+
+  /** Write metadata into the hdf5 file (currently only time) */
+  hdf5_manager_.OpenGroup("metadata");
+  hdf5_manager_.WriteAttributeScalar("time", snapshot.output_time_,
+                                     H5T_NATIVE_DOUBLE);
+  hdf5_manager_.CloseGroup();
+
+  /** Write complete mesh topology information into the hdf5 file (vertex
+   * coordinates must not be perturbed, hence at most lossless) or link it from
+   * the previous file holding the unchanged mesh topology */
+  if (snapshot.linked_mesh_topology_filename_.empty()) {
+    DatasetCompression mesh_compression = compression_;
+    if (mesh_compression.type_ == CompressionType::Lossy) {
+      mesh_compression.type_ = CompressionType::Lossless;
+    }
+    hdf5_manager_.OpenGroup("mesh_topology");
+    if (snapshot.block_geometry_.data_.empty()) {
+      WriteDatasetSnapshot("VertexIDs", snapshot.vertex_ids_,
+                           H5T_NATIVE_ULLONG, mesh_compression);
+      WriteDatasetSnapshot("VertexCoordinates", snapshot.vertex_coordinates_,
+                           H5T_NATIVE_DOUBLE, mesh_compression);
+    } else {
+      WriteDatasetSnapshot("BlockGeometry", snapshot.block_geometry_,
+                           H5T_NATIVE_DOUBLE, mesh_compression);
+    }
+    hdf5_manager_.CloseGroup();
+  } else {
+    hdf5_manager_.LinkExternalGroup("mesh_topology",
+                                    snapshot.linked_mesh_topology_filename_);
+  }
+
+  /** Write cell fields into the hdf5 file */
+  hdf5_manager_.OpenGroup("cell_data");
+  for (auto const &dataset : snapshot.block_cell_data_) {
+    WriteDatasetSnapshot("BlockCellData", dataset, H5T_NATIVE_DOUBLE,
+                         compression_);
+  }
+  for (auto const &dataset : snapshot.interface_block_cell_data_) {
+    WriteDatasetSnapshot("InterfaceBlockCellData", dataset, H5T_NATIVE_DOUBLE,
+                         compression_);
+  }
   hdf5_manager_.CloseGroup();
 
-  /** Closing the last HDF Ressources and write xdmf file */
+  /** Closing the last HDF Ressources */
   hdf5_manager_.CloseFile();
 }
 
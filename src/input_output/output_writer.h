@@ -22,15 +22,56 @@
 #ifndef OUTPUT_WRITER_H
 #define OUTPUT_WRITER_H
 
+#include <array>
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "input_output/hdf5/hdf5_manager.h"
 #include "input_output/input_reader/multi_resolution_reader/multi_resolution_reader.h"
 #include "input_output/input_reader/output_reader/output_reader.h"
 #include "input_output/output_writer/mesh_generator.h"
+#include "input_output/output_writer/mesh_topology_links.h"
 #include "input_output/output_writer/output_quantity.h"
 #include "materials/material_manager.h"
 
+/**
+ * @brief Holds one dataset of the output file together with the hyperslab
+ * definition of the rank's contribution.
+ * @tparam T Type of the data.
+ */
+template <typename T> struct OutputDatasetSnapshot {
+  std::vector<hsize_t> global_dimensions_;
+  std::vector<hsize_t> local_dimensions_;
+  hsize_t start_index_ = 0;
+  // Pairs of the written name and the data of the rank
+  std::vector<std::pair<std::string, std::vector<T>>> data_;
+};
+
+/**
+ * @brief Holds all data of one output that is written to the hdf5 and xdmf
+ * files. The snapshot is independent of the tree, i.e. the simulation may
+ * continue before the snapshot is written.
+ */
+struct OutputSnapshot {
+  double output_time_ = 0.0;
+  std::string hdf5_filename_;
+  std::string time_series_filename_without_extension_;
+  // Mesh topology (empty if the topology of a previous file is linked)
+  std::string linked_mesh_topology_filename_;
+  OutputDatasetSnapshot<unsigned long long int> vertex_ids_;
+  OutputDatasetSnapshot<double> vertex_coordinates_;
+  // Block origins and spacings (block-structured output only)
+  OutputDatasetSnapshot<double> block_geometry_;
+  // Cell data (one entry for each group of quantities with the same dimension)
+  std::vector<OutputDatasetSnapshot<double>> block_cell_data_;
+  std::vector<OutputDatasetSnapshot<double>> interface_block_cell_data_;
+  // Content of the xdmf files (only filled on rank 0)
+  std::string xdmf_time_step_content_;
+  std::string xdmf_time_series_content_;
+};
+
 /**
  * @brief The OutputWriter class handles the output to the filesystem in XDMF +
  * HDF5 file format for ParaView. OutputWriter must not change any data. It
@@ -38,12 +79,17 @@
  * the mesh is generated in the specific format depending on the desired output
  * type (standard, interface, debug). Furthermore, an xdmf file is written that
  * provides the direct access to all files for the simulation in a time series.
+ * In the block-structured mode, the standard and interface output describe
+ * each block as a uniform grid by its origin and spacing instead.
  *        The xdmf file can be used with the Xdmf2 and Xdmf3 reader in ParaView.
  */
 class OutputWriter {
   // Specification that this variable is used from the base class to avoid
   // shadowing
   unsigned int const number_of_materials_;
+  // Compression of the cell data (the mesh topology is at most compressed
+  // lossless)
+  DatasetCompression const compression_;
 
   // Instance of the hdf5 file writer (cannot be const due to variable changes
   // during simulation, singleton allows constness of OutputWriter)
@@ -71,23 +117,32 @@ class OutputWriter {
   std::map<std::array<unsigned int, 2>, std::vector<unsigned int>> const
       interface_quantities_dimension_map_;
 
+  // Files holding the most recently staged mesh topology for each output type.
+  // Only bookkeeping, hence mutable
+  mutable MeshTopologyLinks mesh_topology_links_;
+
+  // local functions to collect the data of the hdf5 and xdmf files
+  void StageMeshTopology(MeshGenerator const &mesh_generator,
+                         OutputSnapshot &snapshot) const;
+  void StageBlockGeometry(MeshGenerator const &mesh_generator,
+                          OutputSnapshot &snapshot) const;
+  void StageCellData(MeshGenerator const &mesh_generator,
+                     OutputType const output_type,
+                     OutputSnapshot &snapshot) const;
   // local functions to write the hdf5 and xdmf files
-  void WriteHdf5File(double const output_time, std::string const &hdf5_filename,
-                     MeshGenerator const &mesh_generator,
-                     OutputType const output_type) const;
-  void WriteXdmfTimeStepFile(double const output_time,
-                             std::string const &hdf5_filename,
-                             MeshGenerator const &mesh_generator,
-                             OutputType const output_type) const;
-  void AppendToXdmfTimeSeriesFile(
-      double const output_time, std::string const &hdf5_filename,
-      MeshGenerator const &mesh_generator,
-      std::string const &time_series_filename_without_extension,
-      OutputType const output_type) const;
+  template <typename T>
+  void WriteDatasetSnapshot(std::string const &dataset_name,
+                            OutputDatasetSnapshot<T> const &dataset,
+                            hid_t const datatype,
+                            DatasetCompression const &compression) const;
+  void WriteHdf5File(OutputSnapshot const &snapshot) const;
   std::string XdmfSpatialDataInformation(double const output_time,
                                          std::string const &hdf5_short_filename,
                                          MeshGenerator const &mesh_generator,
                                          OutputType const output_type) const;
+  std::string XdmfBlockStructuredDataInformation(
+      double const output_time, std::string const &hdf5_short_filename,
+      MeshGenerator const &mesh_generator, OutputType const output_type) const;
 
   // local factory functions
   std::map<std::array<unsigned int, 2>, std::vector<unsigned int>>
@@ -104,7 +159,8 @@ public:
           material_output_quantities,
       std::vector<std::unique_ptr<OutputQuantity const>>
           interface_output_quantities,
-      unsigned int const number_of_materials);
+      unsigned int const number_of_materials,
+      DatasetCompression const &compression = {});
   ~OutputWriter() = default;
   OutputWriter(OutputWriter const &) = delete;
   OutputWriter &operator=(OutputWriter const &) = delete;
@@ -116,6 +172,12 @@ public:
       OutputType const output_type, double const output_time,
       std::string const &filename_without_extension,
       std::string const &time_series_filename_without_extension = "") const;
+  // Functions to write the output files in two phases (e.g. asynchronously)
+  OutputSnapshot StageOutput(
+      OutputType const output_type, double const output_time,
+      std::string const &filename_without_extension,
+      std::string const &time_series_filename_without_extension = "") const;
+  void WriteOutputSnapshot(OutputSnapshot const &snapshot) const;
   // Function to initialize and finalize the time series files
   void InitializeTimeSeriesFile(
       std::string const &time_series_filename_without_extension) const;
@@ -22,6 +22,8 @@
 #include "mesh_generator.h"
 #include "input_output/utilities/xdmf_utilities.h"
 
+#include <algorithm>
+
 /**
  * @brief Constructor for a generic mesh generator to be called from derived
  * classes.
@@ -100,3 +102,35 @@ void MeshGenerator::ComputeVertexCoordinates(
   // Compute the vertex coordinates in the derived class
   DoComputeVertexCoordinates(vertex_coordinates);
 }
+
+/**
+ * @brief Computes the origin and the cell spacing of all local nodes for the
+ * block-structured output. Each node is described by three values of each, in
+ * the order of the local nodes.
+ * @param block_origins Vector where the origins are written into (indirect
+ * return).
+ * @param block_spacings Vector where the spacings are written into (indirect
+ * return).
+ * @note The values are given in z-y-x order as expected by xdmf for uniform
+ * grids (3DCoRectMesh).
+ */
+void MeshGenerator::ComputeBlockGeometry(
+    std::vector<double> &block_origins,
+    std::vector<double> &block_spacings) const {
+  std::vector<std::reference_wrapper<Node const>> const nodes =
+      DoGetLocalNodes();
+  // The node geometry is stored non-dimensionally
+  double const dimensionalization_factor =
+      dimensionalized_node_size_on_level_zero_ / tree_.GetNodeSizeOnLevelZero();
+  block_origins.resize(3 * nodes.size());
+  block_spacings.resize(3 * nodes.size());
+  for (std::size_t n = 0; n < nodes.size(); ++n) {
+    Node const &node = nodes[n];
+    auto const [x, y, z] = node.GetBlockCoordinates();
+    block_origins[3 * n] = z * dimensionalization_factor;
+    block_origins[3 * n + 1] = y * dimensionalization_factor;
+    block_origins[3 * n + 2] = x * dimensionalization_factor;
+    std::fill_n(std::begin(block_spacings) + 3 * n, 3,
+                node.GetCellSize() * dimensionalization_factor);
+  }
+}
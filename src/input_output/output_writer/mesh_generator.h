@@ -27,6 +27,7 @@
 #include "topology/topology_manager.h"
 #include "topology/tree.h"
 #include "unit_handler.h"
+#include <cstdint>
 #include <hdf5.h>
 
 /**
@@ -46,6 +47,9 @@ private:
   // Naming of the vertex IDs and coordinates in the final file
   std::string const vertex_ids_name_ = "cell_vertex_IDs";
   std::string const vertex_coordinates_name_ = "cell_vertex_coordinates";
+  // Naming of the block origins and spacings in the block-structured output
+  std::string const block_origins_name_ = "block_origins";
+  std::string const block_spacings_name_ = "block_spacings";
 
 protected:
   // topology manager containing the global information of nodes
@@ -236,9 +240,31 @@ public:
     return vertex_coordinates_name_;
   }
 
+  /**
+   * @brief Return the name of the block origins to be used in the files.
+   * @return The name used for the block origins.
+   */
+  std::string GetBlockOriginsName() const { return block_origins_name_; }
+
+  /**
+   * @brief Return the name of the block spacings to be used in the files.
+   * @return The name used for the block spacings.
+   */
+  std::string GetBlockSpacingsName() const { return block_spacings_name_; }
+
+  /**
+   * @brief Gives the revision of the topology the mesh is generated from. The
+   * mesh does not change as long as the revision does not change.
+   * @return The topology revision.
+   */
+  std::uint64_t GetTopologyRevision() const { return topology_.GetRevision(); }
+
   // Functions to append vertex IDs and coordinatesS
   void ComputeVertexIDs(std::vector<unsigned long long int> &vertex_ids) const;
   void ComputeVertexCoordinates(std::vector<double> &vertex_coordinates) const;
+  // Function to compute the origin and spacing of the local nodes
+  void ComputeBlockGeometry(std::vector<double> &block_origins,
+                            std::vector<double> &block_spacings) const;
 
   // Creates the appropriate strings for the topology (vertex ids) and geometry
   // (vertex coordinates)
@@ -0,0 +1,59 @@
+//===---------------------- mesh_topology_links.cpp -----------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/output_writer/mesh_topology_links.h"
+
+/**
+ * @brief Constructs empty records, i.e. the first output of each type holds the
+ * full mesh topology.
+ * @param reuse_active Decision whether unchanged mesh topologies are linked.
+ */
+MeshTopologyLinks::MeshTopologyLinks(bool const reuse_active)
+    : reuse_active_(reuse_active), records_() {
+  /* Empty besides initializer list */
+}
+
+/**
+ * @brief Gives the file whose mesh topology can be linked for the given output,
+ * i.e. the file of the previous output of the same type if the topology did not
+ * change since. Records the given file as holder of the mesh topology
+ * otherwise.
+ * @param output_type Type of the output (standard, interface, debug).
+ * @param topology_revision Revision of the topology used for the output.
+ * @param hdf5_short_filename Short filename of the hdf5 file of the output
+ * (without path information).
+ * @return Short filename of the file holding the mesh topology. Empty if the
+ * mesh topology has to be written into the output file.
+ */
+std::string
+MeshTopologyLinks::LinkableFilename(OutputType const output_type,
+                                    std::uint64_t const topology_revision,
+                                    std::string const &hdf5_short_filename) {
+  auto &[revision, filename] = records_[OTTI(output_type)];
+  // A file rewritten under the same name cannot link to itself
+  if (reuse_active_ && !filename.empty() && revision == topology_revision &&
+      filename != hdf5_short_filename) {
+    return filename;
+  }
+  revision = topology_revision;
+  filename = hdf5_short_filename;
+  return "";
+}
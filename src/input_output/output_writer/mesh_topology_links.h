@@ -0,0 +1,60 @@
+//===----------------------- mesh_topology_links.h ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef MESH_TOPOLOGY_LINKS_H
+#define MESH_TOPOLOGY_LINKS_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "input_output/output_writer/output_definitions.h"
+#include "user_specifications/compile_time_constants.h"
+
+/**
+ * @brief The MeshTopologyLinks class records for each output type (standard,
+ * interface, debug) the file holding the most recently written mesh topology
+ * together with its topology revision. An output of an unchanged topology links
+ * the mesh topology of that file instead of writing it again.
+ */
+class MeshTopologyLinks {
+
+  bool const reuse_active_;
+  // Topology revision and (short) filename of the hdf5 file holding the mesh
+  // topology for each output type
+  std::array<std::pair<std::uint64_t, std::string>, 3> records_;
+
+public:
+  explicit MeshTopologyLinks(
+      bool const reuse_active = CC::MeshTopologyReuseActive());
+  ~MeshTopologyLinks() = default;
+  MeshTopologyLinks(MeshTopologyLinks const &) = delete;
+  MeshTopologyLinks &operator=(MeshTopologyLinks const &) = delete;
+  MeshTopologyLinks(MeshTopologyLinks &&) = delete;
+  MeshTopologyLinks &operator=(MeshTopologyLinks &&) = delete;
+
+  std::string LinkableFilename(OutputType const output_type,
+                               std::uint64_t const topology_revision,
+                               std::string const &hdf5_short_filename);
+};
+
+#endif // MESH_TOPOLOGY_LINKS_H
@@ -23,6 +23,7 @@
 #define OUTPUT_DEFINITIONS_H
 
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "utilities/string_operations.h"
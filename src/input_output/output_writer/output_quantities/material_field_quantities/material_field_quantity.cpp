@@ -22,6 +22,67 @@
 #include "input_output/output_writer/output_quantities/material_field_quantities/material_field_quantity.h"
 #include "input_output/utilities/xdmf_utilities.h"
 #include "levelset/multi_phase_manager/material_sign_capsule.h"
+#include <memory>
+
+namespace {
+/**
+ * @brief Single field in the layout of the block buffers, i.e. including the
+ * halo cells.
+ */
+struct FieldWithHalos {
+  double values_[CC::TCX()][CC::TCY()][CC::TCZ()];
+};
+
+/**
+ * @brief Gives a field of the given block in the layout including the halo
+ * cells. The initial conservatives are copied into a separate storage if the
+ * initial buffer is stored halo-free, such that the output never requests them
+ * from the block in the layout with halo cells.
+ * @param block The block holding the field.
+ * @param field_type The material field type of the field.
+ * @param field_index The index of the field.
+ * @param buffer_type The conservative buffer type of the field.
+ * @param halo_value Value given in the halo cells of a halo-free initial
+ * buffer.
+ * @param storage Storage for the copied initial field. Allocated on first use.
+ * @return Reference to the field.
+ */
+auto FieldBufferWithHalos(Block const &block,
+                          MaterialFieldType const field_type,
+                          unsigned int const field_index,
+                          ConservativeBufferType const buffer_type,
+                          double const halo_value,
+                          std::unique_ptr<FieldWithHalos> &storage)
+    -> double const (&)[CC::TCX()][CC::TCY()][CC::TCZ()] {
+  if constexpr (CC::HaloFreeInitialBufferActive()) {
+    if (field_type == MaterialFieldType::Conservatives &&
+        buffer_type == ConservativeBufferType::Initial) {
+      if (!storage) {
+        storage = std::make_unique<FieldWithHalos>();
+      }
+      double const(&initial_field)[CC::IBCX()][CC::IBCY()][CC::IBCZ()] =
+          block.GetInitialBuffer()[field_index];
+      for (unsigned int i = 0; i < CC::TCX(); ++i) {
+        for (unsigned int j = 0; j < CC::TCY(); ++j) {
+          for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+            storage->values_[i][j][k] = halo_value;
+          }
+        }
+      }
+      for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+        for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+          for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+            storage->values_[i][j][k] =
+                initial_field[i - CC::IBOX()][j - CC::IBOY()][k - CC::IBOZ()];
+          }
+        }
+      }
+      return storage->values_;
+    }
+  }
+  return block.GetFieldBuffer(field_type, field_index, buffer_type);
+}
+} // namespace
 
 /**
  * @brief constructor to create material field output.
@@ -72,6 +133,9 @@ void MaterialFieldQuantity::DoComputeCellData(
 
     // local counter
     unsigned long long int local_counter = 0;
+    // storage for initial fields stored without halo cells
+    std::unique_ptr<FieldWithHalos> positive_storage;
+    std::unique_ptr<FieldWithHalos> negative_storage;
 
     // Loop through all components
     for (std::size_t component = 0;
@@ -80,11 +144,15 @@ void MaterialFieldQuantity::DoComputeCellData(
       unsigned int const field_index = quantity_data_.field_indices_[component];
       // Get buffers of both materials and other specifications
       double const(&positive_field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial())
-              .GetFieldBuffer(field_type, field_index, buffer_type_);
+          FieldBufferWithHalos(
+              node.GetPhaseByMaterial(MaterialSignCapsule::PositiveMaterial()),
+              field_type, field_index, buffer_type_,
+              quantity_data_.debug_default_value_, positive_storage);
       double const(&negative_field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial())
-              .GetFieldBuffer(field_type, field_index, buffer_type_);
+          FieldBufferWithHalos(
+              node.GetPhaseByMaterial(MaterialSignCapsule::NegativeMaterial()),
+              field_type, field_index, buffer_type_,
+              quantity_data_.debug_default_value_, negative_storage);
       // Dimensionalization factor for re-dimensionalization of variables
       double const dimensionalization_factor =
           unit_handler_.DimensionalizeValue(
@@ -124,6 +192,8 @@ void MaterialFieldQuantity::DoComputeCellData(
 
     // local counter
     unsigned long long int local_counter = 0;
+    // storage for an initial field stored without halo cells
+    std::unique_ptr<FieldWithHalos> storage;
 
     // Loop through all components
     for (std::size_t component = 0;
@@ -131,8 +201,9 @@ void MaterialFieldQuantity::DoComputeCellData(
       // Get the correct buffer and dimensionalization factor
       unsigned int const field_index = quantity_data_.field_indices_[component];
       double const(&field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(material).GetFieldBuffer(
-              field_type, field_index, buffer_type_);
+          FieldBufferWithHalos(node.GetPhaseByMaterial(material), field_type,
+                               field_index, buffer_type_,
+                               quantity_data_.debug_default_value_, storage);
       double const dimensionalization_factor =
           unit_handler_.DimensionalizeValue(
               1.0, MF::FieldUnit(field_type, field_index));
@@ -171,6 +242,8 @@ void MaterialFieldQuantity::DoComputeDebugCellData(
   if (node.ContainsMaterial(material)) {
     // local counter
     unsigned long long int local_counter = 0;
+    // storage for an initial field stored without halo cells
+    std::unique_ptr<FieldWithHalos> storage;
     // Loop through all components
     for (std::size_t component = 0;
          component < quantity_data_.field_indices_.size(); component++) {
@@ -178,8 +251,9 @@ void MaterialFieldQuantity::DoComputeDebugCellData(
       // Get the correct buffer and dimensionalization factor
       unsigned int const field_index = quantity_data_.field_indices_[component];
       double const(&field_buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-          node.GetPhaseByMaterial(material).GetFieldBuffer(
-              field_type, field_index, buffer_type_);
+          FieldBufferWithHalos(node.GetPhaseByMaterial(material), field_type,
+                               field_index, buffer_type_,
+                               quantity_data_.debug_default_value_, storage);
       double const dimensionalization_factor =
           unit_handler_.DimensionalizeValue(
               1.0, MF::FieldUnit(field_type, field_index));
@@ -88,6 +88,49 @@ std::string OutputQuantity::GetXdmfAttributeString(
   std::string const data_item(XdmfUtilities::DataItemString(
       hdf5_filename, group_name + "/" + prefix + quantity_name_,
       number_of_global_cells, dimensions_));
+  return AttributeString(prefix + quantity_name_, data_item);
+}
+
+/**
+ * @brief Gives the appropriate attribute string for the xdmf file for the cells
+ * of a single block of this quantity in the block-structured output.
+ * @param hdf5_filename HDF5 filename (without path) where the actual data has
+ * been written to.
+ * @param group_name Name of the group the data was written.
+ * @param number_of_global_cells Number of cells used for the complete quantity
+ * (globally on all ranks).
+ * @param block_index Index of the block among all written blocks.
+ * @return Compete Xdmf attribute string.
+ * @note The cells of a block are stored contiguously with the x-index running
+ * fastest, i.e. in the z-y-x order of a uniform xdmf grid.
+ */
+std::string OutputQuantity::GetXdmfBlockAttributeString(
+    std::string const &hdf5_filename, std::string const &group_name,
+    hsize_t const number_of_global_cells, hsize_t const block_index) const {
+  constexpr std::array<unsigned int, 3> cells = {CC::ICX(), CC::ICY(),
+                                                 CC::ICZ()};
+  hsize_t const cells_per_block = cells[0] * cells[1] * cells[2];
+  // Select the cells of the block from the complete dataset
+  std::string const data_item(XdmfUtilities::HyperSlabDataItemString(
+      hdf5_filename, group_name + "/" + quantity_name_,
+      {number_of_global_cells, dimensions_[0], dimensions_[1]},
+      {block_index * cells_per_block, 0, 0},
+      {cells_per_block, dimensions_[0], dimensions_[1]},
+      XdmfUtilities::BlockDimensionsString(cells, dimensions_)));
+  return AttributeString(quantity_name_, data_item);
+}
+
+/**
+ * @brief Wraps the given data item into the attribute string matching the
+ * dimensions of this quantity (differentiation between multidimensional,
+ * vectorial and scalar quantities).
+ * @param attribute_name Name of the attribute.
+ * @param data_item The data item of the attribute.
+ * @return Compete Xdmf attribute string.
+ */
+std::string
+OutputQuantity::AttributeString(std::string const &attribute_name,
+                                std::string const &data_item) const {
   if (dimensions_.back() > 1 ||
       dimensions_.front() >
           DTI(CC::DIM())) { // multidimensional (second component dimension
@@ -98,20 +141,16 @@ std::string OutputQuantity::GetXdmfAttributeString(
     // allows sometimes special computations in ParaView
     if (dimensions_.back() == dimensions_.front() &&
         dimensions_.back() <= DTI(CC::DIM())) {
-      return XdmfUtilities::TensorAttributeString(prefix + quantity_name_,
-                                                  data_item);
+      return XdmfUtilities::TensorAttributeString(attribute_name, data_item);
     } else {
-      return XdmfUtilities::MatrixAttributeString(prefix + quantity_name_,
-                                                  data_item);
+      return XdmfUtilities::MatrixAttributeString(attribute_name, data_item);
     }
   } else if (dimensions_.front() >
              1) { // vectorial (first component dimension larger than one and
                   // implicitly smaller than current dimension)
-    return XdmfUtilities::VectorAttributeString(prefix + quantity_name_,
-                                                data_item);
+    return XdmfUtilities::VectorAttributeString(attribute_name, data_item);
   } else { // scalar (both dimensions are one)
-    return XdmfUtilities::ScalarAttributeString(prefix + quantity_name_,
-                                                data_item);
+    return XdmfUtilities::ScalarAttributeString(attribute_name, data_item);
   }
 }
 
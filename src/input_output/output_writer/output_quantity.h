@@ -52,6 +52,10 @@ protected:
   // matrix )
   std::array<unsigned int, 2> const dimensions_;
 
+  // Wraps the data item into the attribute string matching the dimensions
+  std::string AttributeString(std::string const &attribute_name,
+                              std::string const &data_item) const;
+
   /**
    * @brief Compute values for the data vector that is written to the hdf5 file
    * (standard, interface mode).
@@ -113,6 +117,11 @@ public:
                                      std::string const &group_name,
                                      hsize_t const number_of_values,
                                      std::string const prefix = "") const;
+  std::string
+  GetXdmfBlockAttributeString(std::string const &filename,
+                              std::string const &group_name,
+                              hsize_t const number_of_values,
+                              hsize_t const block_index) const;
 
   // Additional return functions to provide data to outside
   bool IsActive(OutputType const output_type) const;
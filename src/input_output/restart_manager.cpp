@@ -21,6 +21,10 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/restart_manager.h"
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 #include "block_definitions/block.h"
@@ -52,6 +56,63 @@ void CheckConsistency(T const &first_value, T const &second_value,
                            std::to_string(second_value) + ")!");
   }
 }
+
+/**
+ * @brief Appends the content of a (contiguous) buffer to a staging buffer,
+ * which is written to file in a single operation.
+ * @param buffer The buffer whose content is appended.
+ * @param staging_buffer The staging buffer (indirect return parameter).
+ * @tparam Buffer Trivially copyable buffer type (e.g. Conservatives or a plain
+ * cell array).
+ * @tparam T Element type of the staging buffer.
+ */
+template <typename Buffer, typename T>
+void AppendToStagingBuffer(Buffer const &buffer,
+                           std::vector<T> &staging_buffer) {
+  static_assert(sizeof(Buffer) % sizeof(T) == 0,
+                "Buffer cannot be staged with the given element type");
+  std::size_t const position = staging_buffer.size();
+  staging_buffer.resize(position + sizeof(Buffer) / sizeof(T));
+  std::memcpy(staging_buffer.data() + position, &buffer, sizeof(Buffer));
+}
+
+/**
+ * @brief Copies the content of a (contiguous) buffer from the given position
+ * of a staging buffer, which has been read from file in a single operation.
+ * @param position The position in the staging buffer.
+ * @param buffer The buffer that is filled (indirect return parameter).
+ * @return The position in the staging buffer behind the copied data.
+ * @tparam Buffer Trivially copyable buffer type (e.g. Conservatives or a plain
+ * cell array).
+ * @tparam T Element type of the staging buffer.
+ */
+template <typename Buffer, typename T>
+T const *CopyFromStagingBuffer(T const *position, Buffer &buffer) {
+  static_assert(sizeof(Buffer) % sizeof(T) == 0,
+                "Buffer cannot be staged with the given element type");
+  std::memcpy(&buffer, position, sizeof(Buffer));
+  return position + sizeof(Buffer) / sizeof(T);
+}
+
+/**
+ * @brief Appends a range of elements to a list of ranges. Directly adjacent
+ * ranges are merged.
+ * @param start The first element of the range.
+ * @param count The number of elements in the range.
+ * @param ranges The list of start-count pairs (indirect return parameter).
+ */
+void AppendToRanges(hsize_t const start, hsize_t const count,
+                    std::vector<std::pair<hsize_t, hsize_t>> &ranges) {
+  if (count == 0) {
+    return;
+  }
+  if (!ranges.empty() &&
+      ranges.back().first + ranges.back().second == start) {
+    ranges.back().second += count;
+  } else {
+    ranges.emplace_back(start, count);
+  }
+}
 } // namespace
 
 /**
@@ -63,10 +124,12 @@ void CheckConsistency(T const &first_value, T const &second_value,
  * structure of the simulation. It is only modified if the simulation is
  * restored from a snapshot.
  * @param maximum_level The maximum level of the simulation.
+ * @param compression The compression of the cell data in the restart files.
  */
 RestartManager::RestartManager(UnitHandler const &unit_handler,
                                TopologyManager &topology_manager, Tree &tree,
-                               unsigned int const maximum_level)
+                               unsigned int const maximum_level,
+                               DatasetCompression const &compression)
     : // Start initializer list
       tree_(tree), topology_(topology_manager), logger_(LogWriter::Instance()),
       hdf5_manager_(Hdf5Manager::Instance()), maximum_level_(maximum_level),
@@ -77,7 +140,8 @@ RestartManager::RestartManager(UnitHandler const &unit_handler,
       temperature_reference_(
           unit_handler.DimensionalizeValue(1.0, UnitType::Temperature)),
       velocity_reference_(
-          unit_handler.DimensionalizeValue(1.0, UnitType::Velocity)) {
+          unit_handler.DimensionalizeValue(1.0, UnitType::Velocity)),
+      compression_(compression) {
   /** Empty besides initializer list */
 }
 
@@ -210,19 +274,68 @@ RestartManager::RestoreSimulation(std::string const &restore_filename) const {
   hdf5_manager_.OpenDatasetForReading(
       "InterfaceTags", local_dimensions_single_buffer, H5T_NATIVE_CHAR);
 
-  // Declare the buffers that are filled during reading plus other variables
-  // required during reading
+  // Offsets of the first material and interface block of each node in the
+  // file
+  std::vector<hsize_t> material_block_offsets(global_number_of_nodes + 1, 0);
+  std::partial_sum(number_of_materials.begin(), number_of_materials.end(),
+                   material_block_offsets.begin() + 1);
+  std::vector<hsize_t> interface_block_offsets(global_number_of_nodes + 1, 0);
+  std::partial_sum(number_of_interface_blocks.begin(),
+                   number_of_interface_blocks.end(),
+                   interface_block_offsets.begin() + 1);
+
+  // The local nodes are processed in file order. This allows to read the
+  // blocks of consecutive nodes as single ranges.
+  std::vector<unsigned int> sorted_node_indices(local_node_indices);
+  std::sort(sorted_node_indices.begin(), sorted_node_indices.end());
+  std::vector<std::pair<hsize_t, hsize_t>> material_block_ranges;
+  std::vector<std::pair<hsize_t, hsize_t>> interface_block_ranges;
+  hsize_t local_number_of_material_blocks = 0;
+  hsize_t local_number_of_interface_blocks = 0;
+  for (auto const node_index : sorted_node_indices) {
+    AppendToRanges(material_block_offsets[node_index],
+                   number_of_materials[node_index], material_block_ranges);
+    AppendToRanges(interface_block_offsets[node_index],
+                   number_of_interface_blocks[node_index],
+                   interface_block_ranges);
+    local_number_of_material_blocks += number_of_materials[node_index];
+    local_number_of_interface_blocks += number_of_interface_blocks[node_index];
+  }
+
+  // Read all local cell data ( one collective call per dataset )
+  constexpr std::size_t single_buffer_size = CC::TCX() * CC::TCY() * CC::TCZ();
+  std::vector<double> conservatives(local_number_of_material_blocks *
+                                    MF::ANOE() * single_buffer_size);
+  std::vector<double> prime_states(local_number_of_material_blocks *
+                                   MF::ANOP() * single_buffer_size);
+  std::vector<double> levelsets(local_number_of_interface_blocks *
+                                single_buffer_size);
+  std::vector<std::int8_t> interface_tags_of_nodes(
+      local_number_of_interface_blocks * single_buffer_size);
+  hdf5_manager_.ReadDatasetCollectively("Conservatives", conservatives.data(),
+                                        material_block_ranges);
+  hdf5_manager_.ReadDatasetCollectively("PrimeStates", prime_states.data(),
+                                        material_block_ranges);
+  hdf5_manager_.ReadDatasetCollectively("Levelset", levelsets.data(),
+                                        interface_block_ranges);
+  hdf5_manager_.ReadDatasetCollectively(
+      "InterfaceTags", interface_tags_of_nodes.data(), interface_block_ranges);
+
+  // Declare the buffers that are filled from the read data plus other
+  // variables required during node creation
   std::int8_t interface_tags[CC::TCX()][CC::TCY()][CC::TCZ()];
   double single_buffer[CC::TCX()][CC::TCY()][CC::TCZ()];
   std::vector<MaterialName> materials_of_node;
+  double const *conservatives_position = conservatives.data();
+  double const *prime_states_position = prime_states.data();
+  double const *levelsets_position = levelsets.data();
+  std::int8_t const *interface_tags_position = interface_tags_of_nodes.data();
 
   // Loop through all local nodes and add the data
-  for (auto const node_index : local_node_indices) {
+  for (auto const node_index : sorted_node_indices) {
 
-    // Compute the offset where the current material blocks start
-    hsize_t const material_block_offset =
-        std::accumulate(number_of_materials.begin(),
-                        number_of_materials.begin() + node_index, 0);
+    // The offset where the current material blocks start
+    hsize_t const material_block_offset = material_block_offsets[node_index];
 
     materials_of_node.clear();
     for (unsigned int material_index = 0;
@@ -234,18 +347,15 @@ RestartManager::RestoreSimulation(std::string const &restore_filename) const {
     // Declare the interface block as null_pointer
     std::unique_ptr<InterfaceBlock> interface_block = nullptr;
     if (number_of_interface_blocks[node_index] == 1) {
-      hsize_t const reading_offset =
-          std::accumulate(number_of_interface_blocks.begin(),
-                          number_of_interface_blocks.begin() + node_index, 0);
-
-      // read the levelset
-      hdf5_manager_.ReadDataset("Levelset", single_buffer, reading_offset);
+      // take the levelset
+      levelsets_position =
+          CopyFromStagingBuffer(levelsets_position, single_buffer);
       // Create an interface block with the read levelset values
       interface_block = std::make_unique<InterfaceBlock>(single_buffer);
 
-      // read the interface tags
-      hdf5_manager_.ReadDataset("InterfaceTags", interface_tags,
-                                reading_offset);
+      // take the interface tags
+      interface_tags_position =
+          CopyFromStagingBuffer(interface_tags_position, interface_tags);
 
     } else {
       /** Since it is already checked that the number of materials and number of
@@ -264,21 +374,13 @@ RestartManager::RestoreSimulation(std::string const &restore_filename) const {
         tree_.CreateNode(node_ids[node_index], materials_of_node,
                          interface_tags, std::move(interface_block));
 
-    // Read the conservative and prime state data
-    for (unsigned int material_index = 0;
-         material_index < number_of_materials[node_index]; ++material_index) {
-      MaterialName const material =
-          materials[material_block_offset + material_index];
+    // Take the conservative and prime state data
+    for (MaterialName const material : materials_of_node) {
       Block &material_block = new_node.GetPhaseByMaterial(material);
-
-      hsize_t const reading_offset = material_block_offset + material_index;
-
-      // Read the conservatives and primes
-      hdf5_manager_.ReadDataset("Conservatives",
-                                &material_block.GetRightHandSideBuffer(),
-                                reading_offset);
-      hdf5_manager_.ReadDataset(
-          "PrimeStates", &material_block.GetPrimeStateBuffer(), reading_offset);
+      conservatives_position = CopyFromStagingBuffer(
+          conservatives_position, material_block.GetRightHandSideBuffer());
+      prime_states_position = CopyFromStagingBuffer(
+          prime_states_position, material_block.GetPrimeStateBuffer());
     }
   }
 
@@ -301,6 +403,25 @@ RestartManager::RestoreSimulation(std::string const &restore_filename) const {
 std::string RestartManager::WriteRestartFile(
     double const timestep,
     std::string const &filename_without_extension) const {
+  std::string const filename = WriteRestartSnapshot(
+      StageRestartSnapshot(timestep), filename_without_extension);
+  logger_.LogMessage("Restart file written at t = " +
+                     StringOperations::ToScientificNotationString(timestep, 9));
+  return filename;
+}
+
+/**
+ * @brief Collects all data of the current time step that is written into a
+ * restart file. The snapshot is independent of the tree and topology, i.e. the
+ * simulation may continue before the snapshot is written.
+ * @param timestep The current time step.
+ * @return The restart snapshot.
+ */
+RestartSnapshot
+RestartManager::StageRestartSnapshot(double const timestep) const {
+
+  RestartSnapshot snapshot;
+  snapshot.time_ = timestep;
 
   /** Prepare data that is required for the restart file (data that needs to be
    * collected from different ranks, etc.) */
@@ -312,12 +433,10 @@ std::string RestartManager::WriteRestartFile(
   std::pair<unsigned int, unsigned int> const nodes_blocks_global =
       topology_.NodeAndBlockCount();
 
-  // Deduce variables for better readability
-  unsigned int const global_number_of_nodes = nodes_blocks_global.first;
-  unsigned int const local_nodes_offset = nodes_blocks_offset.first;
-  unsigned int const global_number_of_material_blocks =
-      nodes_blocks_global.second;
-  unsigned int const local_material_blocks_offset = nodes_blocks_offset.second;
+  snapshot.global_number_of_nodes_ = nodes_blocks_global.first;
+  snapshot.local_nodes_offset_ = nodes_blocks_offset.first;
+  snapshot.global_number_of_material_blocks_ = nodes_blocks_global.second;
+  snapshot.local_material_blocks_offset_ = nodes_blocks_offset.second;
 
   // interface block data (So far nodes can have only one levelset, so this way
   // of counting is fine).
@@ -328,38 +447,90 @@ std::string RestartManager::WriteRestartFile(
   MPI_Allgather(&local_number_of_interface_blocks, 1, MPI_UNSIGNED,
                 number_of_interface_blocks_per_rank.data(), 1, MPI_UNSIGNED,
                 MPI_COMM_WORLD);
-  unsigned int const local_interface_block_offset = std::accumulate(
+  snapshot.local_interface_blocks_offset_ = std::accumulate(
       number_of_interface_blocks_per_rank.begin(),
       number_of_interface_blocks_per_rank.begin() + my_rank, 0u);
-  unsigned int const global_number_of_interface_blocks = std::accumulate(
+  snapshot.global_number_of_interface_blocks_ = std::accumulate(
       number_of_interface_blocks_per_rank.begin() + my_rank,
-      number_of_interface_blocks_per_rank.end(), local_interface_block_offset);
+      number_of_interface_blocks_per_rank.end(),
+      snapshot.local_interface_blocks_offset_);
+  snapshot.local_number_of_interface_blocks_ =
+      local_number_of_interface_blocks;
+
+  /** Stage all node data into contiguous buffers */
+  for (auto const &level : tree_.FullNodeList()) {
+    for (auto const &[id, node] : level) {
+      /** Stage general node info data */
+      PhaseMap const &phases(node.GetPhases());
+      snapshot.node_ids_.push_back(id);
+      snapshot.number_of_materials_.push_back(phases.size());
+      snapshot.number_of_interface_blocks_.push_back(node.HasLevelset() ? 1
+                                                                        : 0);
+
+      /** Stage the actual cell data */
+      // material/block data (conservatives and prime states)
+      for (auto const &mat_block : phases) {
+        snapshot.materials_.push_back(MTI(mat_block.first));
+        AppendToStagingBuffer(mat_block.second.GetAverageBuffer(),
+                              snapshot.conservatives_);
+        AppendToStagingBuffer(mat_block.second.GetPrimeStateBuffer(),
+                              snapshot.prime_states_);
+      }
+      // interface data (levelset and interface tags)
+      if (node.HasLevelset()) {
+        AppendToStagingBuffer(node.GetInterfaceBlock().GetBaseBuffer(
+                                  InterfaceDescription::Levelset),
+                              snapshot.levelsets_);
+        AppendToStagingBuffer(
+            node.GetInterfaceTags<
+                InterfaceDescriptionBufferType::Reinitialized>(),
+            snapshot.interface_tags_);
+      }
+    }
+  }
+
+  return snapshot;
+}
+
+/**
+ * @brief Writes a previously staged restart snapshot into a restart file.
+ * @param snapshot The staged restart snapshot.
+ * @param filename_without_extension The filename of the restart file (without
+ * file extension).
+ * @return The final name of the restart file that has been written.
+ * @note Does not access the tree or the topology. Must be called by all ranks
+ * (collective file access).
+ */
+std::string RestartManager::WriteRestartSnapshot(
+    RestartSnapshot const &snapshot,
+    std::string const &filename_without_extension) const {
 
   /** Define the dimensions for the different values and datasets that are
    * written to the restart file */
   std::vector<hsize_t> const total_dimensions_conservatives(
-      {global_number_of_material_blocks, MF::ANOE(), CC::TCX(), CC::TCY(),
-       CC::TCZ()});
+      {snapshot.global_number_of_material_blocks_, MF::ANOE(), CC::TCX(),
+       CC::TCY(), CC::TCZ()});
   std::vector<hsize_t> const local_dimensions_conservatives(
       {1, MF::ANOE(), CC::TCX(), CC::TCY(), CC::TCZ()});
 
   std::vector<hsize_t> const total_dimensions_prime_states(
-      {global_number_of_material_blocks, MF::ANOP(), CC::TCX(), CC::TCY(),
-       CC::TCZ()});
+      {snapshot.global_number_of_material_blocks_, MF::ANOP(), CC::TCX(),
+       CC::TCY(), CC::TCZ()});
   std::vector<hsize_t> const local_dimensions_prime_states(
       {1, MF::ANOP(), CC::TCX(), CC::TCY(), CC::TCZ()});
 
   std::vector<hsize_t> const total_dimensions_single_buffer(
-      {global_number_of_interface_blocks, CC::TCX(), CC::TCY(), CC::TCZ()});
+      {snapshot.global_number_of_interface_blocks_, CC::TCX(), CC::TCY(),
+       CC::TCZ()});
   std::vector<hsize_t> const local_dimensions_single_buffer(
       {1, CC::TCX(), CC::TCY(), CC::TCZ()});
 
   std::vector<hsize_t> const total_dimensions_node_scalar(
-      {global_number_of_nodes});
+      {snapshot.global_number_of_nodes_});
   std::vector<hsize_t> const local_dimensions_node_scalar({1});
 
   std::vector<hsize_t> const total_dimensions_block_scalar(
-      {global_number_of_material_blocks});
+      {snapshot.global_number_of_material_blocks_});
   std::vector<hsize_t> const local_dimensions_block_scalar({1});
 
   /** Open the hdf5 file where the data is written into */
@@ -369,79 +540,68 @@ std::string RestartManager::WriteRestartFile(
   /** Open the group and datasets, where the basic information of the node are
    * written into */
   hdf5_manager_.OpenGroup("node_info_data");
-  hdf5_manager_.OpenDatasetForWriting("NodeIds", total_dimensions_node_scalar,
-                                      local_dimensions_node_scalar,
-                                      local_nodes_offset, H5T_NATIVE_ULLONG);
-  hdf5_manager_.OpenDatasetForWriting(
-      "NumberOfMaterials", total_dimensions_node_scalar,
-      local_dimensions_node_scalar, local_nodes_offset, H5T_NATIVE_USHORT);
-  hdf5_manager_.OpenDatasetForWriting(
-      "Materials", total_dimensions_block_scalar, local_dimensions_block_scalar,
-      local_material_blocks_offset, H5T_NATIVE_USHORT);
   hdf5_manager_.OpenDatasetForWriting(
-      "NumberOfInterfaceBlocks", total_dimensions_node_scalar,
-      local_dimensions_node_scalar, local_nodes_offset, H5T_NATIVE_USHORT);
+      "NodeIds", total_dimensions_node_scalar, local_dimensions_node_scalar,
+      snapshot.local_nodes_offset_, H5T_NATIVE_ULLONG);
+  hdf5_manager_.OpenDatasetForWriting("NumberOfMaterials",
+                                      total_dimensions_node_scalar,
+                                      local_dimensions_node_scalar,
+                                      snapshot.local_nodes_offset_,
+                                      H5T_NATIVE_USHORT);
+  hdf5_manager_.OpenDatasetForWriting("Materials",
+                                      total_dimensions_block_scalar,
+                                      local_dimensions_block_scalar,
+                                      snapshot.local_material_blocks_offset_,
+                                      H5T_NATIVE_USHORT);
+  hdf5_manager_.OpenDatasetForWriting("NumberOfInterfaceBlocks",
+                                      total_dimensions_node_scalar,
+                                      local_dimensions_node_scalar,
+                                      snapshot.local_nodes_offset_,
+                                      H5T_NATIVE_USHORT);
 
   /** Open the group and datasets, where the cell data information of the node
    * are written into */
   hdf5_manager_.OpenGroup("node_cell_data");
   hdf5_manager_.OpenDatasetForWriting(
       "Conservatives", total_dimensions_conservatives,
-      local_dimensions_conservatives, local_material_blocks_offset,
-      H5T_NATIVE_DOUBLE);
+      local_dimensions_conservatives, snapshot.local_material_blocks_offset_,
+      H5T_NATIVE_DOUBLE, compression_);
   hdf5_manager_.OpenDatasetForWriting(
       "PrimeStates", total_dimensions_prime_states,
-      local_dimensions_prime_states, local_material_blocks_offset,
-      H5T_NATIVE_DOUBLE);
+      local_dimensions_prime_states, snapshot.local_material_blocks_offset_,
+      H5T_NATIVE_DOUBLE, compression_);
   hdf5_manager_.OpenDatasetForWriting(
       "Levelset", total_dimensions_single_buffer,
-      local_dimensions_single_buffer, local_interface_block_offset,
-      H5T_NATIVE_DOUBLE);
+      local_dimensions_single_buffer, snapshot.local_interface_blocks_offset_,
+      H5T_NATIVE_DOUBLE, compression_);
   hdf5_manager_.OpenDatasetForWriting(
       "InterfaceTags", total_dimensions_single_buffer,
-      local_dimensions_single_buffer, local_interface_block_offset,
-      H5T_NATIVE_CHAR);
-
-  /** Write all node data to the file */
-  for (auto const &level : tree_.FullNodeList()) {
-    for (auto const &[id, node] : level) {
-      /** Write general node info data */
-      std::unordered_map<MaterialName, Block> const &phases(node.GetPhases());
-      unsigned short const number_of_materials = phases.size();
-      unsigned short const number_of_interface_blocks =
-          node.HasLevelset() ? 1 : 0;
-
-      // Write the info data
-      hdf5_manager_.WriteDataset("NodeIds", &id);
-      hdf5_manager_.WriteDataset("NumberOfInterfaceBlocks",
-                                 &number_of_interface_blocks);
-      hdf5_manager_.WriteDataset("NumberOfMaterials", &number_of_materials);
-      for (auto const &mat_block : phases) {
-        unsigned short const material_index = MTI(mat_block.first);
-        hdf5_manager_.WriteDataset("Materials", &material_index);
-      }
-
-      /** Write the actual cell data */
-      // Write material/block data (conservatives and prime states)
-      for (auto const &mat_block : phases) {
-        // Write conservatives and prime states
-        hdf5_manager_.WriteDataset("Conservatives",
-                                   &mat_block.second.GetAverageBuffer());
-        hdf5_manager_.WriteDataset("PrimeStates",
-                                   &mat_block.second.GetPrimeStateBuffer());
-      }
-      // write interface data (levelset and interface tags)
-      if (node.HasLevelset()) {
-        hdf5_manager_.WriteDataset("Levelset",
-                                   node.GetInterfaceBlock().GetBaseBuffer(
-                                       InterfaceDescription::Levelset));
-        hdf5_manager_.WriteDataset(
-            "InterfaceTags",
-            node.GetInterfaceTags<
-                InterfaceDescriptionBufferType::Reinitialized>());
-      }
-    }
-  }
+      local_dimensions_single_buffer, snapshot.local_interface_blocks_offset_,
+      H5T_NATIVE_CHAR, compression_);
+
+  /** Write all node data to the file ( one collective call per dataset ) */
+  hdf5_manager_.WriteDatasetCollectively(
+      "NodeIds", snapshot.node_ids_.data(), snapshot.node_ids_.size());
+  hdf5_manager_.WriteDatasetCollectively(
+      "NumberOfInterfaceBlocks", snapshot.number_of_interface_blocks_.data(),
+      snapshot.number_of_interface_blocks_.size());
+  hdf5_manager_.WriteDatasetCollectively(
+      "NumberOfMaterials", snapshot.number_of_materials_.data(),
+      snapshot.number_of_materials_.size());
+  hdf5_manager_.WriteDatasetCollectively(
+      "Materials", snapshot.materials_.data(), snapshot.materials_.size());
+  hdf5_manager_.WriteDatasetCollectively("Conservatives",
+                                         snapshot.conservatives_.data(),
+                                         snapshot.materials_.size());
+  hdf5_manager_.WriteDatasetCollectively("PrimeStates",
+                                         snapshot.prime_states_.data(),
+                                         snapshot.materials_.size());
+  hdf5_manager_.WriteDatasetCollectively(
+      "Levelset", snapshot.levelsets_.data(),
+      snapshot.local_number_of_interface_blocks_);
+  hdf5_manager_.WriteDatasetCollectively(
+      "InterfaceTags", snapshot.interface_tags_.data(),
+      snapshot.local_number_of_interface_blocks_);
 
   /** Close the open groups (automatically closes all datasets) */
   hdf5_manager_.CloseGroup();
@@ -450,7 +610,8 @@ std::string RestartManager::WriteRestartFile(
    * restart file and new input file) */
   hdf5_manager_.OpenGroup("simulation_data");
   // Time
-  hdf5_manager_.WriteAttributeScalar("Time", timestep, H5T_NATIVE_DOUBLE);
+  hdf5_manager_.WriteAttributeScalar("Time", snapshot.time_,
+                                     H5T_NATIVE_DOUBLE);
   // Number of Dimensions
   hdf5_manager_.WriteAttributeScalar("Dimensions", DTI(CC::DIM()),
                                      H5T_NATIVE_UINT);
@@ -478,8 +639,5 @@ std::string RestartManager::WriteRestartFile(
   /** Close the file (automatically closes all groups and datasets) */
   hdf5_manager_.CloseFile();
 
-  /** Return the created filename and provide logging */
-  logger_.LogMessage("Restart file written at t = " +
-                     StringOperations::ToScientificNotationString(timestep, 9));
   return filename;
 }
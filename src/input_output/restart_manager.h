@@ -25,6 +25,7 @@
 #include <string>
 
 #include "input_output/hdf5/hdf5_manager.h"
+#include "input_output/restart_manager/restart_definitions.h"
 #include "topology/topology_manager.h"
 #include "topology/tree.h"
 #include "unit_handler.h"
@@ -50,12 +51,15 @@ class RestartManager {
   double const density_reference_;
   double const temperature_reference_;
   double const velocity_reference_;
+  // Compression of the cell data of the restart files
+  DatasetCompression const compression_;
 
 public:
   RestartManager() = delete;
   explicit RestartManager(UnitHandler const &unit_handler,
                           TopologyManager &topology_manager, Tree &tree,
-                          unsigned int const maximum_level);
+                          unsigned int const maximum_level,
+                          DatasetCompression const &compression = {});
   ~RestartManager() = default;
   RestartManager(RestartManager const &) = delete;
   RestartManager &operator=(RestartManager const &) = delete;
@@ -67,6 +71,11 @@ public:
   std::string
   WriteRestartFile(double const timestep,
                    std::string const &filename_without_extension) const;
+  // Functions to write restart files in two phases (e.g. asynchronously)
+  RestartSnapshot StageRestartSnapshot(double const timestep) const;
+  std::string
+  WriteRestartSnapshot(RestartSnapshot const &snapshot,
+                       std::string const &filename_without_extension) const;
 };
 
 #endif // RESTART_MANAGER_H
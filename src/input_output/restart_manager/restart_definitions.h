@@ -22,8 +22,11 @@
 #ifndef RESTART_DEFINITIONS_H
 #define RESTART_DEFINITIONS_H
 
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
+#include "topology/node_id_type.h"
 #include "utilities/string_operations.h"
 
 /**
@@ -39,6 +42,33 @@ enum class RestoreMode { Off, Soft, Forced };
  */
 enum class SnapshotTimesType { Off, Interval, Stamps, IntervalStamps };
 
+/**
+ * @brief Holds all data of one time step that is written into a restart file.
+ * The node data of the rank is staged in contiguous buffers ( one per dataset
+ * ), such that each dataset is written at once. The offsets give the position
+ * of the rank's data in the global datasets.
+ */
+struct RestartSnapshot {
+  double time_ = 0.0;
+  // Global sizes of the datasets and offsets of this rank
+  unsigned int global_number_of_nodes_ = 0;
+  unsigned int local_nodes_offset_ = 0;
+  unsigned int global_number_of_material_blocks_ = 0;
+  unsigned int local_material_blocks_offset_ = 0;
+  unsigned int global_number_of_interface_blocks_ = 0;
+  unsigned int local_interface_blocks_offset_ = 0;
+  unsigned int local_number_of_interface_blocks_ = 0;
+  // Staged node data
+  std::vector<nid_t> node_ids_;
+  std::vector<unsigned short> number_of_materials_;
+  std::vector<unsigned short> number_of_interface_blocks_;
+  std::vector<unsigned short> materials_;
+  std::vector<double> conservatives_;
+  std::vector<double> prime_states_;
+  std::vector<double> levelsets_;
+  std::vector<std::int8_t> interface_tags_;
+};
+
 /**
  * @brief Gives the proper OutputWriter type for a given string.
  * @param file_type String that should be converted.
@@ -0,0 +1,113 @@
+//===----------------------- control_utilities.cpp ------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "input_output/utilities/control_utilities.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "utilities/string_operations.h"
+
+namespace ControlUtilities {
+
+/**
+ * @brief Parses the commands of a control file. Each line holds one command
+ * ("abort", "restart", "output" or "output_interval <time>", case
+ * insensitive). Empty lines are skipped.
+ * @param control_stream The stream of the control file.
+ * @param ignored_lines Indirect return of the lines with unknown commands,
+ * extra arguments or invalid (non-positive or non-finite) intervals.
+ * @return The parsed commands. The output interval is given in the units of
+ * the control file.
+ */
+ControlCommands ParseControlCommands(std::istream &control_stream,
+                                     std::vector<std::string> &ignored_lines) {
+  ControlCommands control_commands;
+  std::string line;
+  while (std::getline(control_stream, line)) {
+    std::istringstream line_stream(line);
+    std::string command;
+    // skip empty lines
+    if (!(line_stream >> command)) {
+      continue;
+    }
+    command = StringOperations::ToUpperCaseWithoutSpaces(command);
+    double interval = 0.0;
+    bool valid = true;
+    if (command == "OUTPUT_INTERVAL") {
+      valid = line_stream >> interval && std::isfinite(interval) &&
+              interval > 0.0;
+    } else if (command != "ABORT" && command != "RESTART" &&
+               command != "OUTPUT") {
+      valid = false;
+    }
+    // no further arguments are allowed
+    std::string extra_argument;
+    if (!valid || line_stream >> extra_argument) {
+      ignored_lines.push_back(line);
+      continue;
+    }
+
+    if (command == "ABORT") {
+      control_commands.abort_ = true;
+    } else if (command == "RESTART") {
+      control_commands.write_restart_ = true;
+    } else if (command == "OUTPUT") {
+      control_commands.write_output_ = true;
+    } else {
+      control_commands.output_interval_ = interval;
+    }
+  }
+  return control_commands;
+}
+
+/**
+ * @brief Replaces the time stamps of a given vector by time stamps of a new
+ * interval. The last time stamp (the end time) is kept.
+ * @param time_stamps The vector holding all time stamps.
+ * @param current_time The time from which on the new interval is used.
+ * @param interval The new interval between two time stamps.
+ * @param minimum_interval The smallest allowed interval (e.g. the macro time
+ * step size, since at most one output is written per macro time step).
+ * @return Whether the time stamps were replaced. Intervals below the minimum
+ * are rejected and the time stamps are kept.
+ */
+bool ReplaceTimeStampInterval(std::vector<double> &time_stamps,
+                              double const current_time, double const interval,
+                              double const minimum_interval) {
+  if (!(interval >= minimum_interval && interval > 0.0)) {
+    return false;
+  }
+  // Without remaining time stamps, the output is finished or disabled
+  if (time_stamps.empty()) {
+    return true;
+  }
+  double const end_time = time_stamps.back();
+  time_stamps.clear();
+  for (double time = current_time + interval; time < end_time;
+       time += interval) {
+    time_stamps.push_back(time);
+  }
+  time_stamps.push_back(end_time);
+  return true;
+}
+
+} // namespace ControlUtilities
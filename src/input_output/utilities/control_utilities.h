@@ -0,0 +1,51 @@
+//===------------------------ control_utilities.h -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef CONTROL_UTILITIES_H
+#define CONTROL_UTILITIES_H
+
+#include <istream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Holds the commands given through the control file of a running
+ * simulation.
+ */
+struct ControlCommands {
+  bool abort_ = false;
+  bool write_restart_ = false;
+  bool write_output_ = false;
+  // New interval of the output time stamps (zero if unchanged)
+  double output_interval_ = 0.0;
+};
+
+namespace ControlUtilities {
+
+ControlCommands ParseControlCommands(std::istream &control_stream,
+                                     std::vector<std::string> &ignored_lines);
+bool ReplaceTimeStampInterval(std::vector<double> &time_stamps,
+                              double const current_time, double const interval,
+                              double const minimum_interval);
+
+} // namespace ControlUtilities
+
+#endif // CONTROL_UTILITIES_H
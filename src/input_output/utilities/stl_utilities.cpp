@@ -21,9 +21,40 @@
 //===----------------------------------------------------------------------===//
 #include "input_output/utilities/stl_utilities.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
 #include "utilities/mathematical_functions.h"
 
 namespace StlUtilities {
+namespace {
+// Maximum number of triangles in a leaf of the bounding volume hierarchy
+constexpr unsigned int triangles_per_leaf = 4;
+// Slack of the pruning relative to the extent of the geometry
+constexpr double relative_pruning_tolerance = 1.0e-12;
+
+/**
+ * @brief Gives the distance between a point and an axis-aligned bounding box.
+ * @param point The point.
+ * @param bounding_box The bounding box as { x_min, x_max, y_min, y_max, z_min,
+ * z_max }.
+ * @return The distance (zero if the point is inside the box).
+ */
+double DistanceToBoundingBox(std::array<double, 3> const &point,
+                             std::array<double, 6> const &bounding_box) {
+  double squared_distance = 0.0;
+  for (unsigned int d = 0; d < 3; ++d) {
+    double const outside =
+        std::max({bounding_box[2 * d] - point[d], 0.0,
+                  point[d] - bounding_box[2 * d + 1]});
+    squared_distance += outside * outside;
+  }
+  return std::sqrt(squared_distance);
+}
+} // namespace
+
 /**
  * @brief Reads out and returns a double array from the STL file denoting either
  * a triangle point or normal.
@@ -127,15 +158,17 @@ double DetermineOutsideDistance(std::array<double, 3> const &point,
   }
 }
 
+namespace {
 /**
- * @brief Computes the signed distance from the triangle to the grid point and
- * writes in the implicit return parameter. See \cite Jones1995.
+ * @brief Computes the signed distance from the triangle to the grid point. See
+ * \cite Jones1995.
  * @param triangle The triangle for which the distance is computed.
- * @param x/y/z The coordinates of the grid point.
- * @param signed_distance Implicit return parameter for the signed distance.
+ * @param point The coordinates of the grid point.
+ * @return The signed distance and whether the projection of the point lies
+ * inside the triangle.
  */
-void Voxelization(Triangle const &triangle, std::array<double, 3> const &point,
-                  double &signed_distance) {
+std::pair<double, bool> TriangleDistance(Triangle const &triangle,
+                                         std::array<double, 3> const &point) {
   // Gets all edges from the triangle and the inverse counter part of it
   std::array<std::array<double, 3>, 3> const edges = {
       VU::Difference(triangle.p1, triangle.p2),
@@ -202,13 +235,190 @@ void Voxelization(Triangle const &triangle, std::array<double, 3> const &point,
     throw std::logic_error("Wrong triangle distance in STL voxelization.");
   }
 
-  new_signed_distance =
-      std::abs(new_signed_distance) * Sign(signed_distance_inside);
+  return {std::abs(new_signed_distance) * Sign(signed_distance_inside),
+          inside_point};
+}
+} // namespace
 
+/**
+ * @brief Computes the signed distance from the triangle to the grid point and
+ * writes in the implicit return parameter. See \cite Jones1995.
+ * @param triangle The triangle for which the distance is computed.
+ * @param point The coordinates of the grid point.
+ * @param signed_distance Implicit return parameter for the signed distance.
+ */
+void Voxelization(Triangle const &triangle, std::array<double, 3> const &point,
+                  double &signed_distance) {
+  auto const [new_signed_distance, inside_point] =
+      TriangleDistance(triangle, point);
   if (std::abs(new_signed_distance) < std::abs(signed_distance) ||
       (std::abs(new_signed_distance) == std::abs(signed_distance) &&
        inside_point)) {
     signed_distance = new_signed_distance;
   }
 }
+
+/**
+ * @brief Builds the hierarchy over the given triangles.
+ * @param triangles The triangles of the geometry.
+ */
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+    std::vector<Triangle> &&triangles)
+    : triangles_(std::move(triangles)), triangle_indices_(triangles_.size()),
+      nodes_(), pruning_tolerance_(0.0) {
+  std::iota(triangle_indices_.begin(), triangle_indices_.end(), 0u);
+  if (!triangles_.empty()) {
+    // A binary tree has less than two nodes per leaf
+    nodes_.reserve(2 * (triangles_.size() / triangles_per_leaf + 1));
+    BuildNode(0, static_cast<unsigned int>(triangles_.size()));
+    // The round-off scales with the coordinates, not with the distance
+    std::array<double, 6> const &bounding_box = nodes_.front().bounding_box;
+    for (unsigned int d = 0; d < 6; ++d) {
+      pruning_tolerance_ =
+          std::max(pruning_tolerance_, std::abs(bounding_box[d]));
+    }
+    pruning_tolerance_ *= relative_pruning_tolerance;
+  }
+}
+
+/**
+ * @brief Builds the node for the given range of triangle indices and
+ * (recursively) its children. The range is split at the median of the triangle
+ * centroids along the longest edge of the bounding box.
+ * @param first_triangle The first index of the range.
+ * @param number_of_triangles The size of the range.
+ * @return The position of the node in the node list.
+ */
+unsigned int
+BoundingVolumeHierarchy::BuildNode(unsigned int const first_triangle,
+                                   unsigned int const number_of_triangles) {
+  HierarchyNode node;
+  node.first_triangle = first_triangle;
+  node.number_of_triangles = number_of_triangles;
+  node.second_child = 0;
+  for (unsigned int d = 0; d < 3; ++d) {
+    node.bounding_box[2 * d] = std::numeric_limits<double>::max();
+    node.bounding_box[2 * d + 1] = std::numeric_limits<double>::lowest();
+  }
+  for (unsigned int index = first_triangle;
+       index < first_triangle + number_of_triangles; ++index) {
+    Triangle const &triangle = triangles_[triangle_indices_[index]];
+    for (auto const &corner : {triangle.p1, triangle.p2, triangle.p3}) {
+      for (unsigned int d = 0; d < 3; ++d) {
+        node.bounding_box[2 * d] = std::min(node.bounding_box[2 * d], corner[d]);
+        node.bounding_box[2 * d + 1] =
+            std::max(node.bounding_box[2 * d + 1], corner[d]);
+      }
+    }
+  }
+
+  unsigned int const node_index = static_cast<unsigned int>(nodes_.size());
+  nodes_.push_back(node);
+  if (number_of_triangles <= triangles_per_leaf) {
+    return node_index;
+  }
+
+  unsigned int axis = 0;
+  for (unsigned int d = 1; d < 3; ++d) {
+    if (node.bounding_box[2 * d + 1] - node.bounding_box[2 * d] >
+        node.bounding_box[2 * axis + 1] - node.bounding_box[2 * axis]) {
+      axis = d;
+    }
+  }
+  unsigned int const first_half = number_of_triangles / 2;
+  auto const begin = triangle_indices_.begin() + first_triangle;
+  std::nth_element(begin, begin + first_half, begin + number_of_triangles,
+                   [this, axis](unsigned int const a, unsigned int const b) {
+                     Triangle const &triangle_a = triangles_[a];
+                     Triangle const &triangle_b = triangles_[b];
+                     return triangle_a.p1[axis] + triangle_a.p2[axis] +
+                                triangle_a.p3[axis] <
+                            triangle_b.p1[axis] + triangle_b.p2[axis] +
+                                triangle_b.p3[axis];
+                   });
+
+  BuildNode(first_triangle, first_half);
+  unsigned int const second_child =
+      BuildNode(first_triangle + first_half, number_of_triangles - first_half);
+  // Leaves are identified by a second child of zero
+  nodes_[node_index].number_of_triangles = 0;
+  nodes_[node_index].second_child = second_child;
+  return node_index;
+}
+
+/**
+ * @brief Computes the signed distance of a point to the geometry, see
+ * Voxelization. Equally distant triangles (e.g. at shared edges and corners)
+ * are resolved by their index as in a loop over all triangles with
+ * Voxelization: The last one with the projected point inside wins, otherwise
+ * the first one.
+ * @param point The point for which the distance is computed.
+ * @return The signed distance.
+ */
+double BoundingVolumeHierarchy::SignedDistance(
+    std::array<double, 3> const &point) const {
+  double signed_distance = std::numeric_limits<double>::max();
+  unsigned int closest_triangle = 0;
+  bool closest_inside_point = false;
+  if (nodes_.empty()) {
+    return signed_distance;
+  }
+
+  std::vector<unsigned int> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while (!stack.empty()) {
+    HierarchyNode const &node = nodes_[stack.back()];
+    stack.pop_back();
+    if (DistanceToBoundingBox(point, node.bounding_box) >
+        std::abs(signed_distance) + pruning_tolerance_) {
+      continue;
+    }
+    if (node.second_child == 0) {
+      for (unsigned int index = node.first_triangle;
+           index < node.first_triangle + node.number_of_triangles; ++index) {
+        unsigned int const triangle_index = triangle_indices_[index];
+        auto const [new_signed_distance, inside_point] =
+            TriangleDistance(triangles_[triangle_index], point);
+        bool const closer =
+            std::abs(new_signed_distance) < std::abs(signed_distance);
+        bool const equally_close =
+            std::abs(new_signed_distance) == std::abs(signed_distance);
+        bool const wins_tie =
+            inside_point ? !closest_inside_point ||
+                               triangle_index > closest_triangle
+                         : !closest_inside_point &&
+                               triangle_index < closest_triangle;
+        if (closer || (equally_close && wins_tie)) {
+          signed_distance = new_signed_distance;
+          closest_triangle = triangle_index;
+          closest_inside_point = inside_point;
+        }
+      }
+    } else {
+      // Visit the closer child first (it is pushed last)
+      unsigned int const first_child = &node - nodes_.data() + 1;
+      double const first_distance =
+          DistanceToBoundingBox(point, nodes_[first_child].bounding_box);
+      double const second_distance =
+          DistanceToBoundingBox(point, nodes_[node.second_child].bounding_box);
+      if (first_distance <= second_distance) {
+        stack.push_back(node.second_child);
+        stack.push_back(first_child);
+      } else {
+        stack.push_back(first_child);
+        stack.push_back(node.second_child);
+      }
+    }
+  }
+  return signed_distance;
+}
+
+/**
+ * @brief Gives the number of triangles held in the hierarchy.
+ * @return Number of triangles.
+ */
+std::size_t BoundingVolumeHierarchy::NumberOfTriangles() const {
+  return triangles_.size();
+}
 } // namespace StlUtilities
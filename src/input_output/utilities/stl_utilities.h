@@ -23,6 +23,7 @@
 #define STL_UTILITIES_H
 
 #include <array>
+#include <cstddef>
 #include <fstream>
 #include <sstream>
 #include <streambuf>
@@ -112,6 +113,56 @@ double DetermineOutsideDistance(std::array<double, 3> const &point,
 
 void Voxelization(Triangle const &triangle, std::array<double, 3> const &point,
                   double &levelset);
+
+/**
+ * @brief The BoundingVolumeHierarchy class holds the triangles of an STL
+ * geometry in a binary tree of axis-aligned bounding boxes. Signed distance
+ * queries only visit the triangles whose bounding box is closer to the point
+ * than the closest triangle found so far, i.e. the query time is logarithmic in
+ * the number of triangles for typical geometries.
+ * @note For triangles whose corners are ordered counter-clockwise with respect
+ * to their normal (as required by the STL format), the distance computed in
+ * Voxelization is never smaller than the distance to the bounding box of the
+ * triangle (up to round-off, which the pruning allows for). Together with
+ * resolving equally distant triangles by their index, the hierarchy gives the
+ * same result as a loop over all triangles.
+ */
+class BoundingVolumeHierarchy {
+
+  /**
+   * @brief A node of the hierarchy. Leaves refer to a range of triangle
+   * indices, inner nodes to their second child (the first child directly
+   * follows its parent).
+   */
+  struct HierarchyNode {
+    // Bounding box as { x_min, x_max, y_min, y_max, z_min, z_max }
+    std::array<double, 6> bounding_box;
+    unsigned int first_triangle;
+    unsigned int number_of_triangles;
+    unsigned int second_child;
+  };
+
+  std::vector<Triangle> const triangles_;
+  std::vector<unsigned int> triangle_indices_;
+  std::vector<HierarchyNode> nodes_;
+  // Slack of the pruning, which covers the round-off in the triangle distances
+  double pruning_tolerance_;
+
+  unsigned int BuildNode(unsigned int const first_triangle,
+                         unsigned int const number_of_triangles);
+
+public:
+  BoundingVolumeHierarchy() = delete;
+  explicit BoundingVolumeHierarchy(std::vector<Triangle> &&triangles);
+  ~BoundingVolumeHierarchy() = default;
+  BoundingVolumeHierarchy(BoundingVolumeHierarchy const &) = delete;
+  BoundingVolumeHierarchy &operator=(BoundingVolumeHierarchy const &) = delete;
+  BoundingVolumeHierarchy(BoundingVolumeHierarchy &&) = delete;
+  BoundingVolumeHierarchy &operator=(BoundingVolumeHierarchy &&) = delete;
+
+  double SignedDistance(std::array<double, 3> const &point) const;
+  std::size_t NumberOfTriangles() const;
+};
 } // namespace StlUtilities
 
 #endif // STL_UTILITIES_H
@@ -52,6 +52,20 @@ std::string DimensionsToString(std::array<T, 2> const &dimensions) {
     return dimensions_string;
   }
 }
+
+/**
+ * @brief Returns a string of all given values split by spaces.
+ * @param values The values to be formatted.
+ * @return the string.
+ */
+std::string
+ValuesToString(std::vector<unsigned long long int> const &values) {
+  std::string values_string;
+  for (auto const &value : values) {
+    values_string += (values_string.empty() ? "" : " ") + std::to_string(value);
+  }
+  return values_string;
+}
 } // namespace
 
 /**
@@ -87,6 +101,51 @@ std::string DataItemString(std::string const &hdf5_filename,
          "\"> " + hdf5_filename + ":/" + item_name + " </DataItem>\n";
 }
 
+/**
+ * @brief Generates a properly formated string for a DataItem node in the Xdmf
+ * file that selects a hyperslab of a dataset in the hdf5 file.
+ * @param hdf5_filename The name of the hdf5 file (without path).
+ * @param item_name The name of the dataset in the hdf5 file.
+ * @param dataset_dimensions The dimensions of the complete dataset.
+ * @param start The start index of the hyperslab in each dimension.
+ * @param count The number of selected values in each dimension.
+ * @param slab_dimensions The dimensions the selected values are given in
+ * (space-separated).
+ * @return string for the hyperslab data item.
+ */
+std::string HyperSlabDataItemString(
+    std::string const &hdf5_filename, std::string const &item_name,
+    std::vector<unsigned long long int> const &dataset_dimensions,
+    std::vector<unsigned long long int> const &start,
+    std::vector<unsigned long long int> const &count,
+    std::string const &slab_dimensions) {
+  std::vector<unsigned long long int> const stride(start.size(), 1);
+  return "<DataItem ItemType=\"HyperSlab\" Dimensions=\"" + slab_dimensions +
+         "\"> <DataItem Dimensions=\"3 " + std::to_string(start.size()) +
+         "\" Format=\"XML\"> " + ValuesToString(start) + " " +
+         ValuesToString(stride) + " " + ValuesToString(count) +
+         " </DataItem> <DataItem Format=\"HDF\" NumberType=\"Float\" "
+         "Precision=\"8\" Dimensions=\"" +
+         ValuesToString(dataset_dimensions) + "\"> " + hdf5_filename + ":/" +
+         item_name + " </DataItem> </DataItem>\n";
+}
+
+/**
+ * @brief Gives the dimensions of the cell data of a single block for a quantity
+ * of given dimensions, i.e. the number of cells in z, y and x-direction followed
+ * by the quantity dimensions.
+ * @param cells Number of cells of the block in x, y and z-direction.
+ * @param dimensions Dimensions of the quantity ({1,1} : scalar, {3,1} : vector,
+ * {n,m} : matrix/tensor).
+ * @return The space-separated dimensions.
+ */
+std::string
+BlockDimensionsString(std::array<unsigned int, 3> const &cells,
+                      std::array<unsigned int, 2> const &dimensions) {
+  return std::to_string(cells[2]) + " " + std::to_string(cells[1]) + " " +
+         std::to_string(cells[0]) + DimensionsToString(dimensions);
+}
+
 /**
  * @brief Returns the attribute string used for the description of the topology
  * in the Xdmf file. The topology describes the vertex IDs forming a given cell.
@@ -132,6 +191,37 @@ std::string GeometryString(std::string const &data_item,
          "</Geometry>\n";
 }
 
+/**
+ * @brief Returns the attribute string used for the description of the topology
+ * of a single uniform block in the Xdmf file. The vertices of the block are
+ * given by an origin and a spacing (3DCoRectMesh).
+ * @param cells Number of cells of the block in x, y and z-direction.
+ * @return Attribute string for the topology.
+ */
+std::string BlockTopologyString(std::array<unsigned int, 3> const &cells) {
+  return StringOperations::Indent(6) +
+         "<Topology TopologyType=\"3DCoRectMesh\" Dimensions=\"" +
+         std::to_string(cells[2] + 1) + " " + std::to_string(cells[1] + 1) +
+         " " + std::to_string(cells[0] + 1) + "\"/>\n";
+}
+
+/**
+ * @brief Returns the attribute string used for the description of the geometry
+ * of a single uniform block in the Xdmf file.
+ * @param origin_data_item data_item holding the origin of the block.
+ * @param spacing_data_item data_item holding the cell spacing of the block.
+ * @return Attribute string for the geometry.
+ * @note Xdmf expects the origin and the spacing in z-y-x order.
+ */
+std::string BlockGeometryString(std::string const &origin_data_item,
+                                std::string const &spacing_data_item) {
+  return StringOperations::Indent(6) +
+         "<Geometry GeometryType=\"ORIGIN_DXDYDZ\">\n" +
+         StringOperations::Indent(8) + origin_data_item +
+         StringOperations::Indent(8) + spacing_data_item +
+         StringOperations::Indent(6) + "</Geometry>\n";
+}
+
 /**
  * @brief Generates a properly formated string for an Attribute node of a scalar
  * quantity in the Xdmf file.
@@ -212,6 +302,21 @@ SpatialDataInformation(std::string const &spatial_data_name,
          StringOperations::Indent(4) + "</Grid>\n";
 }
 
+/**
+ * @brief Gives a properly formatted string for spatial data that consists of
+ * several grids, e.g. one grid per block.
+ * @param spatial_data_name Name of the collection to be used.
+ * @param spatial_data_information Complete data information (time and grids).
+ * @return Complete formatted spatial collection string.
+ */
+std::string
+SpatialCollectionInformation(std::string const &spatial_data_name,
+                             std::string const &spatial_data_information) {
+  return StringOperations::Indent(4) + "<Grid Name=\"" + spatial_data_name +
+         "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n" +
+         spatial_data_information + StringOperations::Indent(4) + "</Grid>\n";
+}
+
 /**
  * @brief Gives a properly formatted string for the XDMF file header.
  * @param data_name Name of the complete data stored for this file.
@@ -24,6 +24,7 @@
 
 #include <array>
 #include <string>
+#include <vector>
 
 /**
  * @brief The XdmfUtilities serves as a helper class to provide the complete set
@@ -36,10 +37,21 @@ std::string DataItemString(std::string const &hdf5_filename,
                            std::string const &item_name,
                            unsigned long long int const number_of_cells,
                            std::array<unsigned int, 2> const &dimensions);
+std::string HyperSlabDataItemString(
+    std::string const &hdf5_filename, std::string const &item_name,
+    std::vector<unsigned long long int> const &dataset_dimensions,
+    std::vector<unsigned long long int> const &start,
+    std::vector<unsigned long long int> const &count,
+    std::string const &slab_dimensions);
+std::string BlockDimensionsString(std::array<unsigned int, 3> const &cells,
+                                  std::array<unsigned int, 2> const &dimensions);
 std::string TopologyString(std::string const &data_item,
                            unsigned long long int const number_of_cells);
 std::string GeometryString(std::string const &data_item,
                            unsigned long long int const number_of_vertices);
+std::string BlockTopologyString(std::array<unsigned int, 3> const &cells);
+std::string BlockGeometryString(std::string const &origin_data_item,
+                                std::string const &spacing_data_item);
 std::string ScalarAttributeString(std::string const &attribute_name,
                                   std::string const &data_item);
 std::string VectorAttributeString(std::string const &attribute_name,
@@ -50,6 +62,9 @@ std::string TensorAttributeString(std::string const &attribute_name,
                                   std::string const &data_item);
 std::string SpatialDataInformation(std::string const &spatial_data_name,
                                    std::string const &spatial_data_information);
+std::string
+SpatialCollectionInformation(std::string const &spatial_data_name,
+                             std::string const &spatial_data_information);
 std::string HeaderInformation(std::string const &data_name);
 std::string FooterInformation();
 
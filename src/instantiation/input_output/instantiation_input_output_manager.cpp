@@ -371,6 +371,20 @@ InputOutputManager InstantiateInputOutputManager(
     logger.LogMessage("Interface output files      : Disabled");
   }
 
+  // compression of the datasets
+  DatasetCompression const output_compression =
+      output_reader.ReadOutputCompression();
+  logger.LogMessage(
+      "Output compression          : " +
+      CompressionTypeToString(output_compression.type_) +
+      (output_compression.type_ == CompressionType::Lossy
+           ? " (" + std::to_string(output_compression.decimal_digits_) +
+                 " decimal digits)"
+           : ""));
+  logger.LogMessage(
+      "Restart compression         : " +
+      CompressionTypeToString(output_reader.ReadRestartCompression().type_));
+
   logger.LogMessage(" ");
 
   // Instantiate the input output manager
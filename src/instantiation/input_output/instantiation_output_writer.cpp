@@ -388,6 +388,8 @@ std::unique_ptr<MeshGenerator const> GetStandardMeshGenerator(
 /**
  * @brief Instantiates the complete output writer class with the given input
  * classes.
+ * @param input_reader Reader that provides access to the full data of the input
+ * file.
  * @param topology_manager Class providing global (on all ranks) node
  * information.
  * @param tree Tree class providing local (on current rank) node information.
@@ -396,7 +398,8 @@ std::unique_ptr<MeshGenerator const> GetStandardMeshGenerator(
  * @return The fully instantiated OutputWriter class as pointer (allows
  * movements of it).
  */
-OutputWriter InstantiateOutputWriter(TopologyManager &topology_manager,
+OutputWriter InstantiateOutputWriter(InputReader const &input_reader,
+                                     TopologyManager &topology_manager,
                                      Tree &tree,
                                      MaterialManager const &material_manager,
                                      UnitHandler const &unit_handler) {
@@ -417,6 +420,7 @@ OutputWriter InstantiateOutputWriter(TopologyManager &topology_manager,
                                                      node_size_on_level_zero),
       GetMaterialOutputQuantities(unit_handler, material_manager),
       GetInterfaceOutputQuantities(unit_handler, material_manager),
-      material_manager.GetNumberOfMaterials());
+      material_manager.GetNumberOfMaterials(),
+      input_reader.GetOutputReader().ReadOutputCompression());
 }
 } // namespace Instantiation
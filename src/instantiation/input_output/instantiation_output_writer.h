@@ -25,6 +25,7 @@
 #include <memory>
 #include <vector>
 
+#include "input_output/input_reader.h"
 #include "input_output/output_writer.h"
 
 /**
@@ -45,7 +46,8 @@ GetInterfaceOutputQuantities(UnitHandler const &unit_handler,
                              MaterialManager const &material_manager);
 
 // Instantiation function for the input_output manager
-OutputWriter InstantiateOutputWriter(TopologyManager &topology_manager,
+OutputWriter InstantiateOutputWriter(InputReader const &input_reader,
+                                     TopologyManager &topology_manager,
                                      Tree &tree,
                                      MaterialManager const &material_manager,
                                      UnitHandler const &unit_handler);
@@ -26,6 +26,8 @@ namespace Instantiation {
 /**
  * @brief Instantiates the complete restart manager class with the given input
  * classes.
+ * @param input_reader Reader that provides access to the full data of the input
+ * file.
  * @param topology_manager Class providing global (on all ranks) node
  * information.
  * @param tree Tree class providing local (on current rank) node information.
@@ -33,12 +35,14 @@ namespace Instantiation {
  * @return The fully instantiated RestartManager class as pointer (allows
  * movements of it).
  */
-RestartManager InstantiateRestartManager(TopologyManager &topology_manager,
+RestartManager InstantiateRestartManager(InputReader const &input_reader,
+                                         TopologyManager &topology_manager,
                                          Tree &tree,
                                          UnitHandler const &unit_handler) {
 
   // return the fully initialied restart manager
-  return RestartManager(unit_handler, topology_manager, tree,
-                        topology_manager.GetMaximumLevel());
+  return RestartManager(
+      unit_handler, topology_manager, tree, topology_manager.GetMaximumLevel(),
+      input_reader.GetOutputReader().ReadRestartCompression());
 }
 } // namespace Instantiation
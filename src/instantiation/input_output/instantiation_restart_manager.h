@@ -25,6 +25,7 @@
 #include <memory>
 #include <vector>
 
+#include "input_output/input_reader.h"
 #include "input_output/restart_manager.h"
 
 /**
@@ -33,7 +34,8 @@
 namespace Instantiation {
 
 // Instantiation function for the input_output manager
-RestartManager InstantiateRestartManager(TopologyManager &topology_manager,
+RestartManager InstantiateRestartManager(InputReader const &input_reader,
+                                         TopologyManager &topology_manager,
                                          Tree &tree,
                                          UnitHandler const &unit_handler);
 } // namespace Instantiation
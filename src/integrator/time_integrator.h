@@ -383,15 +383,35 @@ public:
           for (Equation const eq : MF::ASOE()) {
             double const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
                 mat_block.second.GetAverageBuffer(eq);
-            double(&u_initial)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            double(&u_initial)[CC::IBCX()][CC::IBCY()][CC::IBCZ()] =
                 mat_block.second.GetInitialBuffer(eq);
-            for (unsigned int i = 0; i < CC::TCX(); ++i) {
-              for (unsigned int j = 0; j < CC::TCY(); ++j) {
-                for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+            for (unsigned int i = 0; i < CC::IBCX(); ++i) {
+              for (unsigned int j = 0; j < CC::IBCY(); ++j) {
+                for (unsigned int k = 0; k < CC::IBCZ(); ++k) {
+                  unsigned int const x = i + CC::IBOX();
+                  unsigned int const y = j + CC::IBOY();
+                  unsigned int const z = k + CC::IBOZ();
                   u_initial[i][j][k] =
-                      u[i][j][k] *
+                      u[x][y][z] *
                       (reference_volume_fraction +
-                       material_sign_double * volume_fraction[i][j][k]);
+                       material_sign_double * volume_fraction[x][y][z]);
+                } // k
+              }   // j
+            }     // i
+          }       // equations
+        }         // phases
+      } else if constexpr (CC::HaloFreeInitialBufferActive()) {
+        for (auto &mat_block : node.GetPhases()) {
+          for (Equation const eq : MF::ASOE()) {
+            double const(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+                mat_block.second.GetAverageBuffer(eq);
+            double(&u_initial)[CC::IBCX()][CC::IBCY()][CC::IBCZ()] =
+                mat_block.second.GetInitialBuffer(eq);
+            for (unsigned int i = 0; i < CC::IBCX(); ++i) {
+              for (unsigned int j = 0; j < CC::IBCY(); ++j) {
+                for (unsigned int k = 0; k < CC::IBCZ(); ++k) {
+                  u_initial[i][j][k] =
+                      u[i + CC::IBOX()][j + CC::IBOY()][k + CC::IBOZ()];
                 } // k
               }   // j
             }     // i
@@ -430,6 +450,11 @@ public:
    * @param node The node for which the average buffer is prepared for the next
    * stage.
    * @param stage The stage of the time-stepping scheme.
+   * @note A halo-free initial buffer leaves the halo cells untouched. They are
+   * overwritten by the halo update after the stage, except for the jump halos
+   * on the coarsest integrated level. These halos are never updated and have
+   * a zero right-hand side, hence they keep the values of the initial stage,
+   * which the combination reproduces as the buffer multipliers sum up to one.
    */
   void PrepareBufferForIntegration(Node &node, unsigned int const stage) const {
     // buffer preparation is only necessary for later stages
@@ -441,13 +466,15 @@ public:
         for (Equation const eq : MF::ASOE()) {
           double(&u)[CC::TCX()][CC::TCY()][CC::TCZ()] =
               mat_block.second.GetAverageBuffer(eq);
-          double const(&u_initial)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+          double const(&u_initial)[CC::IBCX()][CC::IBCY()][CC::IBCZ()] =
               mat_block.second.GetInitialBuffer(eq);
-          for (unsigned int i = 0; i < CC::TCX(); ++i) {
-            for (unsigned int j = 0; j < CC::TCY(); ++j) {
-              for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-                u[i][j][k] = multipliers[0] * u[i][j][k] +
-                             multipliers[1] * u_initial[i][j][k];
+          for (unsigned int i = 0; i < CC::IBCX(); ++i) {
+            for (unsigned int j = 0; j < CC::IBCY(); ++j) {
+              for (unsigned int k = 0; k < CC::IBCZ(); ++k) {
+                double &u_cell =
+                    u[i + CC::IBOX()][j + CC::IBOY()][k + CC::IBOZ()];
+                u_cell = multipliers[0] * u_cell +
+                         multipliers[1] * u_initial[i][j][k];
               } // k
             }   // j
           }     // i
@@ -146,8 +146,22 @@ public:
    * @brief Iteratively solves the extension equation. For description of
    * functionality also see base class.
    * @param nodes The nodes for which the extension equation is solved.
+   * @tparam HaloUpdateInterval The number of iterations between two halo
+   * updates. An iteration performs the corresponding share of the sweeps the
+   * halo size allows for between two halo updates.
    */
+  template <unsigned int HaloUpdateInterval =
+                ExtensionConstants::HaloUpdateInterval>
   void Extend(std::vector<std::reference_wrapper<Node>> const &nodes) const {
+    static_assert(HaloUpdateInterval > 0 &&
+                      HaloUpdateInterval <=
+                          DerivedGhostFluidExtender::repetition_,
+                  "Each iteration between two halo updates requires at least "
+                  "one sweep");
+    constexpr unsigned int repetition =
+        DerivedGhostFluidExtender::repetition_ / HaloUpdateInterval;
+    constexpr unsigned int maximum_number_of_iterations =
+        ExtensionConstants::MaximumNumberOfIterations * HaloUpdateInterval;
 
     // The 2 is hardcoded on purpose. It corresponds to the number of materials.
     // An issue about that is already in the git.
@@ -163,47 +177,54 @@ public:
     }
 
     // Actual iterative loop
+    bool halos_up_to_date = true;
     for (unsigned int iteration_number = 0;
-         iteration_number < ExtensionConstants::MaximumNumberOfIterations;
+         iteration_number < maximum_number_of_iterations;
          ++iteration_number) {
       // Additional computation if the convergence is tracked
       if constexpr (ExtensionConstants::TrackConvergence) {
-        // Reset tracking quantities
-        for (unsigned int material_index = 0; material_index < 2;
-             ++material_index) {
-          for (unsigned int field_index = 0;
-               field_index < MF::ANOF(field_type_); ++field_index) {
-            convergence_tracking_quantities[material_index][field_index] = 0.0;
+        if (iteration_number % ExtensionConstants::ConvergenceCheckInterval ==
+                0 ||
+            iteration_number == maximum_number_of_iterations - 1) {
+          // Reset tracking quantities
+          for (unsigned int material_index = 0; material_index < 2;
+               ++material_index) {
+            for (unsigned int field_index = 0;
+                 field_index < MF::ANOF(field_type_); ++field_index) {
+              convergence_tracking_quantities[material_index][field_index] =
+                  0.0;
+            }
           }
-        }
-        for (Node const &node : nodes) {
-          DetermineMaximumValueOfQuantitiesToExtend(
-              node, convergence_tracking_quantities);
-        }
-
-        MPI_Allreduce(MPI_IN_PLACE, &convergence_tracking_quantities,
-                      number_of_convergence_tracking_quantities_ * 2,
-                      MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-        // Write convergence to logger if desired or if maximum of iterations is
-        // reached
-        if (convergence_tracking_quantities[0][MF::ANOF(field_type_)] <
-                ExtensionConstants::MaximumResiduum &&
-            convergence_tracking_quantities[1][MF::ANOF(field_type_)] <
-                ExtensionConstants::MaximumResiduum &&
-            iteration_number != 0) {
-          if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
-            logger_.BufferMessage(
-                "Ext: " + std::to_string(static_cast<int>(iteration_number)) +
-                " ");
+          for (Node const &node : nodes) {
+            DetermineMaximumValueOfQuantitiesToExtend(
+                node, convergence_tracking_quantities);
           }
-          break;
-        } else if (iteration_number ==
-                   ExtensionConstants::MaximumNumberOfIterations - 1) {
-          if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
-            logger_.BufferMessage("Ext: nc   !!!   ");
+
+          MPI_Allreduce(MPI_IN_PLACE, &convergence_tracking_quantities,
+                        number_of_convergence_tracking_quantities_ * 2,
+                        MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+          // Write convergence to logger if desired or if maximum of iterations
+          // is reached
+          if (convergence_tracking_quantities[0][MF::ANOF(field_type_)] <
+                  ExtensionConstants::MaximumResiduum &&
+              convergence_tracking_quantities[1][MF::ANOF(field_type_)] <
+                  ExtensionConstants::MaximumResiduum &&
+              iteration_number != 0) {
+            if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+              logger_.BufferMessage(
+                  "Ext: " +
+                  std::to_string(static_cast<int>(iteration_number)) + " ");
+            }
+            break;
+          } else if (iteration_number == maximum_number_of_iterations - 1) {
+            if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+              logger_.BufferMessage("Ext: nc   !!!   ");
+            }
           }
         }
-        // Reset the maximum tracking quantity
+        // Reset the maximum tracking quantity. Only the residuum of the
+        // iteration before a check is relevant. The normalization of the last
+        // check is kept in between.
         convergence_tracking_quantities[0][MF::ANOF(field_type_)] = 0.0;
         convergence_tracking_quantities[1][MF::ANOF(field_type_)] = 0.0;
       }
@@ -211,13 +232,22 @@ public:
       // iterative extension on field buffer (static derived extender)
       for (Node &node : nodes) {
         static_cast<DerivedGhostFluidExtender const &>(*this)
-            .IterativeExtension(node, convergence_tracking_quantities);
+            .IterativeExtension(node, convergence_tracking_quantities,
+                                repetition);
       } // nodes
 
-      // Update the halos after each iterative step
+      // Update the halos every few iterative steps. In between, the extension
+      // is carried out on the (outdated) halo cells redundantly
+      halos_up_to_date = (iteration_number + 1) % HaloUpdateInterval == 0;
+      if (halos_up_to_date) {
+        halo_manager_.MaterialHaloUpdateOnLmaxMultis(field_type_);
+      }
+    }
+
+    if (!halos_up_to_date) {
       halo_manager_.MaterialHaloUpdateOnLmaxMultis(field_type_);
     }
-  };
+  }
 };
 
 #endif // GHOST_FLUID_EXTENDER_H
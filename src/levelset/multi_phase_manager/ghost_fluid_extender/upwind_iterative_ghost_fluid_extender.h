@@ -62,10 +62,14 @@ protected:
    * @param node The node which is extended.
    * @param convergence_tracking_quantities An array holding information about
    * the convergence status of the iterative extension method.
+   * @param repetition The number of sweeps over the node. Each sweep outdates
+   * one further stencil width of the halo cells.
    */
   void IterativeExtension(
-      Node &node, double (&convergence_tracking_quantities)
-                      [2][number_of_convergence_tracking_quantities_]) const {
+      Node &node,
+      double (&convergence_tracking_quantities)
+          [2][number_of_convergence_tracking_quantities_],
+      unsigned int const repetition) const {
 
     std::int8_t const(&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
@@ -98,7 +102,7 @@ protected:
                 convergence_tracking_quantities[material_index][field_index]));
       }
 
-      for (unsigned int iteration = 0; iteration < repetition_; ++iteration) {
+      for (unsigned int iteration = 0; iteration < repetition; ++iteration) {
         /**
          * Setting the extension_rhs buffer to zero is crucial!
          */
@@ -91,6 +91,18 @@ class InterfaceExtender {
     }       // field of interface field_type
   }
 
+  /**
+   * @brief Updates the halos of all interface fields that are extended.
+   */
+  void UpdateHalos() const {
+    for (unsigned int field_index = 0; field_index < IF::NOFTE(field_type_);
+         ++field_index) {
+      halo_manager_.InterfaceHaloUpdateOnLmax(
+          MapInterfaceFieldToInterfaceBlockBufferType(
+              field_type_, IF::FITE(field_type_, field_index)));
+    }
+  }
+
   /**
    * @brief Default constructor of the InterfaceExtender class.
    * @param halo_manager Instance to a HaloManager which provides MPI-related
@@ -112,63 +124,85 @@ public:
   /**
    * @brief Performs an extension of interface quantities.
    * @param nodes The nodes for which scale separation should be done.
+   * @tparam HaloUpdateInterval The number of iterations between two halo
+   * updates. An iteration performs the corresponding share of the sweeps the
+   * halo size allows for between two halo updates.
    */
+  template <unsigned int HaloUpdateInterval =
+                InterfaceStateExtensionConstants::HaloUpdateInterval>
   void Extend(std::vector<std::reference_wrapper<Node>> const &nodes) const {
+    static_assert(HaloUpdateInterval > 0 &&
+                      HaloUpdateInterval <=
+                          DerivedInterfaceExtender::repetition_,
+                  "Each iteration between two halo updates requires at least "
+                  "one sweep");
+    constexpr unsigned int repetition =
+        DerivedInterfaceExtender::repetition_ / HaloUpdateInterval;
+    constexpr unsigned int maximum_number_of_iterations =
+        InterfaceStateExtensionConstants::MaximumNumberOfIterations *
+        HaloUpdateInterval;
     // Initialization of tracking quantities
     std::vector<double> convergence_tracking_quantities(
         number_of_convergence_tracking_quantities_, 0.0);
     // actual iterative loop
+    bool halos_up_to_date = true;
     for (unsigned int iteration_number = 0;
-         iteration_number <
-         InterfaceStateExtensionConstants::MaximumNumberOfIterations;
+         iteration_number < maximum_number_of_iterations;
          ++iteration_number) {
       if constexpr (InterfaceStateExtensionConstants::TrackConvergence) {
-        for (unsigned int field_index = 0; field_index < IF::NOFTE(field_type_);
-             ++field_index) {
-          convergence_tracking_quantities[field_index] = 0.0;
-        }
-        for (auto const &node : nodes) {
-          DetermineMaximumValueOfQuantitiesToExtend(
-              node, convergence_tracking_quantities);
-        }
-
-        MPI_Allreduce(MPI_IN_PLACE, convergence_tracking_quantities.data(),
-                      number_of_convergence_tracking_quantities_, MPI_DOUBLE,
-                      MPI_MAX, MPI_COMM_WORLD);
-
-        if (convergence_tracking_quantities[IF::NOFTE(field_type_)] <
-                InterfaceStateExtensionConstants::MaximumResiduum &&
-            iteration_number != 0) {
-          if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
-            logger_.BufferMessage(
-                "IntExt: " +
-                std::to_string(static_cast<int>(iteration_number)) + " ");
+        if (iteration_number %
+                    InterfaceStateExtensionConstants::ConvergenceCheckInterval ==
+                0 ||
+            iteration_number == maximum_number_of_iterations - 1) {
+          for (unsigned int field_index = 0;
+               field_index < IF::NOFTE(field_type_); ++field_index) {
+            convergence_tracking_quantities[field_index] = 0.0;
           }
-          break;
-        } else if (iteration_number ==
-                   InterfaceStateExtensionConstants::MaximumNumberOfIterations -
-                       1) {
-          if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
-            logger_.BufferMessage("IntExt: nc   !!!   ");
+          for (auto const &node : nodes) {
+            DetermineMaximumValueOfQuantitiesToExtend(
+                node, convergence_tracking_quantities);
+          }
+
+          MPI_Allreduce(MPI_IN_PLACE, convergence_tracking_quantities.data(),
+                        number_of_convergence_tracking_quantities_, MPI_DOUBLE,
+                        MPI_MAX, MPI_COMM_WORLD);
+
+          if (convergence_tracking_quantities[IF::NOFTE(field_type_)] <
+                  InterfaceStateExtensionConstants::MaximumResiduum &&
+              iteration_number != 0) {
+            if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+              logger_.BufferMessage(
+                  "IntExt: " +
+                  std::to_string(static_cast<int>(iteration_number)) + " ");
+            }
+            break;
+          } else if (iteration_number == maximum_number_of_iterations - 1) {
+            if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+              logger_.BufferMessage("IntExt: nc   !!!   ");
+            }
           }
         }
+        // Only the residuum of the iteration before a check is relevant
         convergence_tracking_quantities[IF::NOFTE(field_type_)] = 0.0;
       }
 
       // carry out the actual iterative extension on all nodes
       for (auto const &node : nodes) {
         static_cast<DerivedInterfaceExtender const &>(*this).IterativeExtension(
-            node, convergence_tracking_quantities);
+            node, convergence_tracking_quantities, repetition);
       }
 
-      // Halo Update for all interface fields that should be extended
-      for (unsigned int field_index = 0; field_index < IF::NOFTE(field_type_);
-           ++field_index) {
-        halo_manager_.InterfaceHaloUpdateOnLmax(
-            MapInterfaceFieldToInterfaceBlockBufferType(
-                field_type_, IF::FITE(field_type_, field_index)));
+      // Halo Update for all interface fields that should be extended (every few
+      // iterations, in between the halo cells are extended redundantly)
+      halos_up_to_date = (iteration_number + 1) % HaloUpdateInterval == 0;
+      if (halos_up_to_date) {
+        UpdateHalos();
       }
     }
+
+    if (!halos_up_to_date) {
+      UpdateHalos();
+    }
   }
 };
 
@@ -54,9 +54,12 @@ private:
    * @param node The node which contains the phase which is extended.
    * @param convergence_tracking_quantities A vector holding information about
    * the convergence status of the iterative extension method.
+   * @param repetition The number of sweeps over the node. Each sweep outdates
+   * one further stencil width of the halo cells.
    */
-  void IterativeExtension(
-      Node &node, std::vector<double> &convergence_tracking_quantities) const {
+  void IterativeExtension(Node &node,
+                          std::vector<double> &convergence_tracking_quantities,
+                          unsigned int const repetition) const {
 
     double const(&levelset_reinitialized)[CC::TCX()][CC::TCY()][CC::TCZ()] =
         node.GetInterfaceBlock().GetReinitializedBuffer(
@@ -76,7 +79,7 @@ private:
           node.GetInterfaceBlock().GetFieldBuffer(
               field_type_, IF::FITE(field_type_, field_index));
 
-      for (unsigned int iteration = 0; iteration < repetition_; ++iteration) {
+      for (unsigned int iteration = 0; iteration < repetition; ++iteration) {
         for (unsigned int i = 0; i < CC::TCX(); ++i) {
           for (unsigned int j = 0; j < CC::TCY(); ++j) {
             for (unsigned int k = 0; k < CC::TCZ(); ++k) {
@@ -0,0 +1,276 @@
+//===-------------- fast_sweeping_levelset_reinitializer.cpp --------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "fast_sweeping_levelset_reinitializer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <mpi.h>
+
+#include "enums/interface_tag_definition.h"
+#include "user_specifications/two_phase_constants.h"
+
+/**
+ * @brief The default constructor for a FastSweepingLevelsetReinitializer.
+ * Calls the default constructor of the base class.
+ * @param halo_manager See base class.
+ */
+FastSweepingLevelsetReinitializer::FastSweepingLevelsetReinitializer(
+    HaloManager &halo_manager)
+    : LevelsetReinitializer(halo_manager) {
+  // Empty Constructor, besides call of base class constructor.
+}
+
+namespace FastSweeping {
+
+/**
+ * @brief Solves the upwind (Godunov) discretization of the Eikonal equation
+ * |grad(phi)| = 1 for the absolute level-set value of a cell. Distances are
+ * given in units of the cell size.
+ * @param neighbors The smaller absolute level-set value of the two neighbors
+ * in each direction.
+ * @return The absolute level-set value of the cell.
+ */
+double SolveEikonal(std::array<double, DTI(CC::DIM())> neighbors) {
+  std::sort(neighbors.begin(), neighbors.end());
+  double distance = std::numeric_limits<double>::max();
+  double sum = 0.0;
+  double sum_of_squares = 0.0;
+  // Directions are only taken into account if they are upwind of the solution
+  for (unsigned int d = 0; d < neighbors.size() && distance > neighbors[d];
+       ++d) {
+    sum += neighbors[d];
+    sum_of_squares += neighbors[d] * neighbors[d];
+    double const number_of_directions = static_cast<double>(d + 1);
+    distance = (sum + std::sqrt(sum * sum - number_of_directions *
+                                                (sum_of_squares - 1.0))) /
+               number_of_directions;
+  }
+  return distance;
+}
+
+/**
+ * @brief Sets the levelset of all internal cells which are not cut cells to the
+ * cut-off value while keeping their sign. This gives an upper bound of the
+ * distance for the sweeps. Cut cells are optionally reinitialized by scaling
+ * their value with the inverse of the (central) level-set gradient, which keeps
+ * the interface position.
+ * @param interface_tags The interface tags of the block.
+ * @param levelset The level-set field of the block.
+ * @param reinitialize_cut_cells Whether cut cells are reinitialized.
+ */
+void InitializeBlock(
+    std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    bool const reinitialize_cut_cells) {
+
+  // Cut cells are computed from the unmodified field first
+  double cut_cell_levelset[CC::ICX()][CC::ICY()][CC::ICZ()];
+  if (reinitialize_cut_cells) {
+    for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+      for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+        for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+          if (std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell)) {
+            continue;
+          }
+          double const gradient_x =
+              0.5 * (levelset[i + 1][j][k] - levelset[i - 1][j][k]);
+          double const gradient_y =
+              CC::DIM() != Dimension::One
+                  ? 0.5 * (levelset[i][j + 1][k] - levelset[i][j - 1][k])
+                  : 0.0;
+          double const gradient_z =
+              CC::DIM() == Dimension::Three
+                  ? 0.5 * (levelset[i][j][k + 1] - levelset[i][j][k - 1])
+                  : 0.0;
+          double const gradient_magnitude =
+              std::sqrt(gradient_x * gradient_x + gradient_y * gradient_y +
+                        gradient_z * gradient_z);
+          cut_cell_levelset[i - CC::FICX()][j - CC::FICY()][k - CC::FICZ()] =
+              gradient_magnitude > std::numeric_limits<double>::epsilon()
+                  ? levelset[i][j][k] / gradient_magnitude
+                  : levelset[i][j][k];
+        } // k
+      }   // j
+    }     // i
+  }
+
+  double const cutoff = CC::LSCOF();
+  for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+    for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+      for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+        if (std::abs(interface_tags[i][j][k]) > ITTI(IT::NewCutCell)) {
+          levelset[i][j][k] = Signum(levelset[i][j][k]) * cutoff;
+        } else if (reinitialize_cut_cells) {
+          levelset[i][j][k] =
+              cut_cell_levelset[i - CC::FICX()][j - CC::FICY()][k - CC::FICZ()];
+        }
+      } // k
+    }   // j
+  }     // i
+}
+
+/**
+ * @brief Carries out one Gauss-Seidel sweep in each of the alternating
+ * directions over the internal cells of a block. The absolute levelset value of
+ * a cell can only decrease.
+ * @param interface_tags The interface tags of the block.
+ * @param levelset The level-set field of the block.
+ * @return The largest change of a cell inside the reinitialization band.
+ */
+double SweepBlock(
+    std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()]) {
+
+  double residuum = 0.0;
+  std::array<double, DTI(CC::DIM())> neighbors;
+  constexpr unsigned int number_of_sweeps = 1 << DTI(CC::DIM());
+  for (unsigned int sweep = 0; sweep < number_of_sweeps; ++sweep) {
+    bool const backward_x = sweep & 1;
+    bool const backward_y = sweep & 2;
+    bool const backward_z = sweep & 4;
+    for (unsigned int ii = 0; ii < CC::ICX(); ++ii) {
+      unsigned int const i = backward_x ? CC::LICX() - ii : CC::FICX() + ii;
+      for (unsigned int jj = 0; jj < CC::ICY(); ++jj) {
+        unsigned int const j = backward_y ? CC::LICY() - jj : CC::FICY() + jj;
+        for (unsigned int kk = 0; kk < CC::ICZ(); ++kk) {
+          unsigned int const k =
+              backward_z ? CC::LICZ() - kk : CC::FICZ() + kk;
+          if (std::abs(interface_tags[i][j][k]) <= ITTI(IT::NewCutCell)) {
+            continue;
+          }
+          neighbors[0] = std::min(std::abs(levelset[i - 1][j][k]),
+                                  std::abs(levelset[i + 1][j][k]));
+          if constexpr (CC::DIM() != Dimension::One) {
+            neighbors[1] = std::min(std::abs(levelset[i][j - 1][k]),
+                                    std::abs(levelset[i][j + 1][k]));
+          }
+          if constexpr (CC::DIM() == Dimension::Three) {
+            neighbors[2] = std::min(std::abs(levelset[i][j][k - 1]),
+                                    std::abs(levelset[i][j][k + 1]));
+          }
+          double const distance = SolveEikonal(neighbors);
+          if (distance < std::abs(levelset[i][j][k])) {
+            if (std::abs(interface_tags[i][j][k]) <=
+                ITTI(IT::ReinitializationBand)) {
+              residuum =
+                  std::max(residuum, std::abs(levelset[i][j][k]) - distance);
+            }
+            levelset[i][j][k] = Signum(levelset[i][j][k]) * distance;
+          }
+        } // k
+      }   // j
+    }     // i
+  }       // sweep
+  return residuum;
+}
+
+} // namespace FastSweeping
+
+/**
+ * @brief Initializes the level-set field of a node for the sweeps, see
+ * FastSweeping::InitializeBlock.
+ * @param node The node with levelset block which has to be reinitialized.
+ * @param levelset_type Level set buffer type which is reinitialized.
+ * @param is_last_stage Whether it is the last RK stage or not.
+ */
+void FastSweepingLevelsetReinitializer::InitializeSingleNode(
+    Node &node, InterfaceDescriptionBufferType const levelset_type,
+    bool const is_last_stage) const {
+  FastSweeping::InitializeBlock(
+      node.GetInterfaceTags(levelset_type),
+      node.GetInterfaceBlock().GetInterfaceDescriptionBuffer(
+          levelset_type)[InterfaceDescription::Levelset],
+      ReinitializationConstants::ReinitializeCutCells && is_last_stage);
+}
+
+/**
+ * @brief Sweeps the level-set field of a node, see FastSweeping::SweepBlock.
+ * @param node The node with levelset block which has to be reinitialized.
+ * @param levelset_type Level set buffer type which is reinitialized.
+ * @return The residuum for the current node.
+ */
+double FastSweepingLevelsetReinitializer::SweepSingleNode(
+    Node &node, InterfaceDescriptionBufferType const levelset_type) const {
+  return FastSweeping::SweepBlock(
+      node.GetInterfaceTags(levelset_type),
+      node.GetInterfaceBlock().GetInterfaceDescriptionBuffer(
+          levelset_type)[InterfaceDescription::Levelset]);
+}
+
+/**
+ * @brief Reinitializes the level-set field of all given nodes. The field is
+ * initialized with the cut-off value and then swept in rounds, each followed by
+ * a halo update. If convergence is tracked, the rounds stop once no cell in the
+ * reinitialization band changes by more than the maximum residuum. Otherwise,
+ * or if the limit is reached first, NumberOfFastSweepingRounds rounds are done.
+ * @param nodes Vector holding all nodes that have to be updated.
+ * @param levelset_type Level set buffer type which is reinitialized.
+ * @param is_last_stage Whether it is the last RK stage or not.
+ */
+void FastSweepingLevelsetReinitializer::ReinitializeImplementation(
+    std::vector<std::reference_wrapper<Node>> const &nodes,
+    InterfaceDescriptionBufferType const levelset_type,
+    bool const is_last_stage) const {
+
+  InterfaceBlockBufferType const levelset_buffer_type =
+      levelset_type == InterfaceDescriptionBufferType::Reinitialized
+          ? InterfaceBlockBufferType::LevelsetReinitialized
+          : InterfaceBlockBufferType::LevelsetIntegrated;
+
+  for (auto &node : nodes) {
+    InitializeSingleNode(node, levelset_type, is_last_stage);
+  }
+  halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
+
+  for (unsigned int round = 0;
+       round < ReinitializationConstants::NumberOfFastSweepingRounds;
+       ++round) {
+    double residuum = 0.0;
+    for (auto &node : nodes) {
+      residuum = std::max(residuum, SweepSingleNode(node, levelset_type));
+    }
+    halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
+    if constexpr (ReinitializationConstants::TrackConvergence) {
+      MPI_Allreduce(MPI_IN_PLACE, &residuum, 1, MPI_DOUBLE, MPI_MAX,
+                    MPI_COMM_WORLD);
+      if (residuum < ReinitializationConstants::MaximumResiduum) {
+        if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+          logger_.BufferMessage(
+              "Reinit: " + std::to_string(static_cast<int>(round)) + " ");
+        }
+        break;
+      } else if (round ==
+                 ReinitializationConstants::NumberOfFastSweepingRounds - 1) {
+        if constexpr (GeneralTwoPhaseSettings::LogConvergenceInformation) {
+          logger_.BufferMessage("Reinit: nc   !!!   ");
+        }
+      }
+    }
+  }
+
+  for (auto &node : nodes) {
+    CutOffSingleNode(node, levelset_type);
+  }
+  halo_manager_.InterfaceHaloUpdateOnLmax(levelset_buffer_type);
+}
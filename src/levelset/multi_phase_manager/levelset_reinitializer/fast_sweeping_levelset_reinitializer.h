@@ -0,0 +1,86 @@
+//===--------------- fast_sweeping_levelset_reinitializer.h ---------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef FAST_SWEEPING_LEVELSET_REINITIALIZER_H
+#define FAST_SWEEPING_LEVELSET_REINITIALIZER_H
+
+#include "levelset_reinitializer.h"
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Block-wise kernels of the fast-sweeping reinitialization. Level-set
+ * values are given in units of the cell size.
+ */
+namespace FastSweeping {
+double SolveEikonal(std::array<double, DTI(CC::DIM())> neighbors);
+void InitializeBlock(
+    std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    bool const reinitialize_cut_cells);
+double SweepBlock(
+    std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
+    double (&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()]);
+} // namespace FastSweeping
+
+/**
+ * @brief Provides functionality to reinitialize a level-set field with the
+ * fast-sweeping method of \cite Zhao2005. The Eikonal equation is solved
+ * block-wise by Gauss-Seidel sweeps in all alternating directions. Halo cells
+ * act as boundary conditions and are updated after each round of sweeps.
+ * Hence, only a few halo updates are needed.
+ * @note Cut cells anchor the signed-distance field. They are only reinitialized
+ * (from their local level-set gradient) if ReinitializeCutCells is set and in
+ * the last Runge-Kutta stage.
+ */
+class FastSweepingLevelsetReinitializer
+    : public LevelsetReinitializer<FastSweepingLevelsetReinitializer> {
+
+  friend LevelsetReinitializer;
+
+  void InitializeSingleNode(Node &node,
+                            InterfaceDescriptionBufferType const levelset_type,
+                            bool const is_last_stage) const;
+  double
+  SweepSingleNode(Node &node,
+                  InterfaceDescriptionBufferType const levelset_type) const;
+
+protected:
+  void ReinitializeImplementation(
+      std::vector<std::reference_wrapper<Node>> const &nodes,
+      InterfaceDescriptionBufferType const levelset_type,
+      bool const is_last_stage) const;
+
+public:
+  FastSweepingLevelsetReinitializer() = delete;
+  explicit FastSweepingLevelsetReinitializer(HaloManager &halo_manager);
+  ~FastSweepingLevelsetReinitializer() = default;
+  FastSweepingLevelsetReinitializer(FastSweepingLevelsetReinitializer const &) =
+      delete;
+  FastSweepingLevelsetReinitializer &
+  operator=(FastSweepingLevelsetReinitializer const &) = delete;
+  FastSweepingLevelsetReinitializer(FastSweepingLevelsetReinitializer &&) =
+      delete;
+  FastSweepingLevelsetReinitializer &
+  operator=(FastSweepingLevelsetReinitializer &&) = delete;
+};
+
+#endif // FAST_SWEEPING_LEVELSET_REINITIALIZER_H
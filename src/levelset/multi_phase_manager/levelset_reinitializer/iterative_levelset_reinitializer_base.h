@@ -43,6 +43,8 @@ class IterativeLevelsetReinitializerBase
   using LevelsetReinitializer<
       DerivedIterativeLevelsetReinitializer>::halo_manager_;
   using LevelsetReinitializer<DerivedIterativeLevelsetReinitializer>::logger_;
+  using LevelsetReinitializer<
+      DerivedIterativeLevelsetReinitializer>::CutOffSingleNode;
 
   /**
    * @brief The default constructor for a LevelsetReinitializer object.
@@ -55,34 +57,6 @@ class IterativeLevelsetReinitializerBase
     // Empty Constructor, besides initializer list.
   }
 
-  /**
-   * @brief Sets the cut-off in the levelset field of a node.
-   * @param node The node with levelset block which has to be reinitialized.
-   * @param levelset_type Level set buffer type which is reinitialized.
-   */
-  void
-  CutOffSingleNode(Node &node,
-                   InterfaceDescriptionBufferType const levelset_type) const {
-
-    InterfaceBlock &interface_block = node.GetInterfaceBlock();
-    double(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        interface_block.GetInterfaceDescriptionBuffer(
-            levelset_type)[InterfaceDescription::Levelset];
-
-    // Cells which have a levelset value greater than the cutoff value are set
-    // to cutoff.
-    double const cutoff = CC::LSCOF();
-    for (unsigned int i = 0; i < CC::TCX(); ++i) {
-      for (unsigned int j = 0; j < CC::TCY(); ++j) {
-        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-          if (std::abs(levelset[i][j][k]) > cutoff) {
-            levelset[i][j][k] = Signum(levelset[i][j][k]) * cutoff;
-          }
-        } // k
-      }   // j
-    }     // i
-  }
-
   /**
    * @brief Reinitializes a single-level set field as described in \cite
    * Sussman1994.
@@ -27,6 +27,7 @@
 #include "levelset/geometry/geometry_calculator_marching_cubes.h"
 #include "materials/material_manager.h"
 #include "user_specifications/numerical_setup.h"
+#include "utilities/mathematical_functions.h"
 
 /**
  * @brief The class LevelsetReinitializer ensures the (signed-)distance property
@@ -53,6 +54,34 @@ protected:
     // Empty Constructor, besides initializer list.
   }
 
+  /**
+   * @brief Sets the cut-off in the levelset field of a node.
+   * @param node The node with levelset block which has to be reinitialized.
+   * @param levelset_type Level set buffer type which is reinitialized.
+   */
+  void
+  CutOffSingleNode(Node &node,
+                   InterfaceDescriptionBufferType const levelset_type) const {
+
+    InterfaceBlock &interface_block = node.GetInterfaceBlock();
+    double(&levelset)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+        interface_block.GetInterfaceDescriptionBuffer(
+            levelset_type)[InterfaceDescription::Levelset];
+
+    // Cells which have a levelset value greater than the cutoff value are set
+    // to cutoff.
+    double const cutoff = CC::LSCOF();
+    for (unsigned int i = 0; i < CC::TCX(); ++i) {
+      for (unsigned int j = 0; j < CC::TCY(); ++j) {
+        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+          if (std::abs(levelset[i][j][k]) > cutoff) {
+            levelset[i][j][k] = Signum(levelset[i][j][k]) * cutoff;
+          }
+        } // k
+      }   // j
+    }     // i
+  }
+
 public:
   LevelsetReinitializer() = delete;
   ~LevelsetReinitializer() = default;
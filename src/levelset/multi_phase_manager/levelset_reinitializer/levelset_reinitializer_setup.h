@@ -22,6 +22,7 @@
 #ifndef LEVELSET_REINITIALIZER_SETUP_H
 #define LEVELSET_REINITIALIZER_SETUP_H
 
+#include "fast_sweeping_levelset_reinitializer.h"
 #include "min_iterative_levelset_reinitializer.h"
 #include "user_specifications/numerical_setup.h"
 #include "weno_iterative_levelset_reinitializer.h"
@@ -52,6 +53,12 @@ template <> struct Concretize<LevelsetReinitializers::Weno> {
 template <> struct Concretize<LevelsetReinitializers::Min> {
   typedef MinIterativeLevelsetReinitializer type;
 };
+/**
+ * @brief See generic implementation.
+ */
+template <> struct Concretize<LevelsetReinitializers::FastSweeping> {
+  typedef FastSweepingLevelsetReinitializer type;
+};
 
 } // namespace LevelsetReinitializerSetup
 
@@ -40,7 +40,8 @@
  */
 int main(int argc, char *argv[]) {
 
-  MPI_Init(&argc, &argv);
+  // Requests the thread support needed by OpenMP or asynchronous output
+  MpiUtilities::Initialize(&argc, &argv);
   // Triggers signals on floating point errors, i.e. prohibits quiet NaNs and
   // alike
   feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
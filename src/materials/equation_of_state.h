@@ -23,6 +23,7 @@
 #define EQUATION_OF_STATE_H
 
 #include "equation_of_state_definitions.h"
+#include "user_specifications/compile_time_constants.h"
 #include <vector>
 
 /**
@@ -67,10 +68,122 @@ class EquationOfState {
   virtual double ComputeSpeedOfSound(double const density,
                                      double const pressure) const = 0;
 
+  // batched evaluations, derived classes should override them with kernels
+  // that call their own cell functions without virtual dispatch
+  virtual void ComputePressureBatch(
+      unsigned int const number_of_cells, double const *const mass,
+      double const *const momentum_x, double const *const momentum_y,
+      double const *const momentum_z, double const *const energy,
+      double *const pressure) const {
+    EvaluateConservativeBatch(
+        number_of_cells, mass, momentum_x, momentum_y, momentum_z, energy,
+        pressure,
+        [this](double const m, double const m_x, double const m_y,
+               double const m_z, double const e) {
+          return ComputePressure(m, m_x, m_y, m_z, e);
+        });
+  }
+  virtual void ComputeTemperatureBatch(
+      unsigned int const number_of_cells, double const *const mass,
+      double const *const momentum_x, double const *const momentum_y,
+      double const *const momentum_z, double const *const energy,
+      double *const temperature) const {
+    EvaluateConservativeBatch(
+        number_of_cells, mass, momentum_x, momentum_y, momentum_z, energy,
+        temperature,
+        [this](double const m, double const m_x, double const m_y,
+               double const m_z, double const e) {
+          return ComputeTemperature(m, m_x, m_y, m_z, e);
+        });
+  }
+  virtual void ComputeEnergyBatch(
+      unsigned int const number_of_cells, double const *const density,
+      double const *const velocity_x, double const *const velocity_y,
+      double const *const velocity_z, double const *const pressure,
+      double *const energy) const {
+    EvaluatePrimeStateBatch(
+        number_of_cells, density, velocity_x, velocity_y, velocity_z, pressure,
+        energy,
+        [this](double const rho, double const u, double const v,
+               double const w, double const p) {
+          return ComputeEnergy(rho, u, v, w, p);
+        });
+  }
+  virtual void ComputeSpeedOfSoundBatch(unsigned int const number_of_cells,
+                                        double const *const density,
+                                        double const *const pressure,
+                                        double *const speed_of_sound) const {
+    for (unsigned int c = 0; c < number_of_cells; ++c) {
+      speed_of_sound[c] = ComputeSpeedOfSound(density[c], pressure[c]);
+    }
+  }
+
 protected:
   // protected default constructor (can only be called from derived classes)
   explicit EquationOfState() = default;
 
+  /**
+   * @brief Evaluates a cell function of the conservative variables for a batch
+   * of cells.
+   * @param number_of_cells The number of cells in the batch.
+   * @param mass, momentum_x, momentum_y, momentum_z, energy The conservative
+   * inputs of the batch.
+   * @param result The output of the batch. Indirect return parameter.
+   * @param cell_function The function evaluated for each cell.
+   * @tparam CellFunction Callable taking mass, momenta and energy of a cell.
+   * @note Momenta of directions that are not part of the simulation dimension
+   * are not accessed and may be nullptr. An energy given as nullptr is treated
+   * as zero (e.g. isentropic equations).
+   */
+  template <typename CellFunction>
+  static void EvaluateConservativeBatch(
+      unsigned int const number_of_cells, double const *const mass,
+      double const *const momentum_x, double const *const momentum_y,
+      double const *const momentum_z, double const *const energy,
+      double *const result, CellFunction const &cell_function) {
+    if (energy == nullptr) {
+      for (unsigned int c = 0; c < number_of_cells; ++c) {
+        result[c] = cell_function(
+            mass[c], momentum_x[c],
+            CC::DIM() != Dimension::One ? momentum_y[c] : 0.0,
+            CC::DIM() == Dimension::Three ? momentum_z[c] : 0.0, 0.0);
+      }
+    } else {
+      for (unsigned int c = 0; c < number_of_cells; ++c) {
+        result[c] = cell_function(
+            mass[c], momentum_x[c],
+            CC::DIM() != Dimension::One ? momentum_y[c] : 0.0,
+            CC::DIM() == Dimension::Three ? momentum_z[c] : 0.0, energy[c]);
+      }
+    }
+  }
+
+  /**
+   * @brief Evaluates a cell function of the prime states for a batch of cells.
+   * @param number_of_cells The number of cells in the batch.
+   * @param density, velocity_x, velocity_y, velocity_z, pressure The prime
+   * state inputs of the batch.
+   * @param result The output of the batch. Indirect return parameter.
+   * @param cell_function The function evaluated for each cell.
+   * @tparam CellFunction Callable taking density, velocities and pressure of a
+   * cell.
+   * @note Velocities of directions that are not part of the simulation
+   * dimension are not accessed and may be nullptr.
+   */
+  template <typename CellFunction>
+  static void EvaluatePrimeStateBatch(
+      unsigned int const number_of_cells, double const *const density,
+      double const *const velocity_x, double const *const velocity_y,
+      double const *const velocity_z, double const *const pressure,
+      double *const result, CellFunction const &cell_function) {
+    for (unsigned int c = 0; c < number_of_cells; ++c) {
+      result[c] = cell_function(
+          density[c], velocity_x[c],
+          CC::DIM() != Dimension::One ? velocity_y[c] : 0.0,
+          CC::DIM() == Dimension::Three ? velocity_z[c] : 0.0, pressure[c]);
+    }
+  }
+
 public:
   virtual ~EquationOfState() = default;
   EquationOfState(EquationOfState const &) = delete;
@@ -197,6 +310,85 @@ public:
    * @return B value of the implemented material.
    */
   double B() const { return GetB(); }
+
+  /**
+   * @brief Computes the pressure for a batch of cells given as contiguous
+   * arrays of mass, momenta and energy. The equation of state is dispatched
+   * once for the whole batch.
+   * @param number_of_cells The number of cells in the batch.
+   * @param mass, momentum_x, momentum_y, momentum_z, energy The conservative
+   * inputs of the batch.
+   * @param pressure The pressure of the batch. Indirect return parameter.
+   * @note Momenta of directions that are not part of the simulation dimension
+   * are not accessed. An energy given as nullptr is treated as zero.
+   */
+  void PressureBatch(unsigned int const number_of_cells,
+                     double const *const mass, double const *const momentum_x,
+                     double const *const momentum_y,
+                     double const *const momentum_z,
+                     double const *const energy, double *const pressure) const {
+    ComputePressureBatch(number_of_cells, mass, momentum_x, momentum_y,
+                         momentum_z, energy, pressure);
+  }
+
+  /**
+   * @brief Computes the temperature for a batch of cells given as contiguous
+   * arrays of mass, momenta and energy.
+   * @param number_of_cells The number of cells in the batch.
+   * @param mass, momentum_x, momentum_y, momentum_z, energy The conservative
+   * inputs of the batch.
+   * @param temperature The temperature of the batch. Indirect return
+   * parameter.
+   * @note Momenta of directions that are not part of the simulation dimension
+   * are not accessed.
+   */
+  void TemperatureBatch(unsigned int const number_of_cells,
+                        double const *const mass,
+                        double const *const momentum_x,
+                        double const *const momentum_y,
+                        double const *const momentum_z,
+                        double const *const energy,
+                        double *const temperature) const {
+    ComputeTemperatureBatch(number_of_cells, mass, momentum_x, momentum_y,
+                            momentum_z, energy, temperature);
+  }
+
+  /**
+   * @brief Computes the energy for a batch of cells given as contiguous arrays
+   * of density, velocities and pressure.
+   * @param number_of_cells The number of cells in the batch.
+   * @param density, velocity_x, velocity_y, velocity_z, pressure The prime
+   * state inputs of the batch.
+   * @param energy The energy of the batch. Indirect return parameter.
+   * @note Velocities of directions that are not part of the simulation
+   * dimension are not accessed.
+   */
+  void EnergyBatch(unsigned int const number_of_cells,
+                   double const *const density,
+                   double const *const velocity_x,
+                   double const *const velocity_y,
+                   double const *const velocity_z,
+                   double const *const pressure, double *const energy) const {
+    ComputeEnergyBatch(number_of_cells, density, velocity_x, velocity_y,
+                       velocity_z, pressure, energy);
+  }
+
+  /**
+   * @brief Computes the speed of sound for a batch of cells given as
+   * contiguous arrays of density and pressure.
+   * @param number_of_cells The number of cells in the batch.
+   * @param density The density of the batch.
+   * @param pressure The pressure of the batch.
+   * @param speed_of_sound The speed of sound of the batch. Indirect return
+   * parameter.
+   */
+  void SpeedOfSoundBatch(unsigned int const number_of_cells,
+                         double const *const density,
+                         double const *const pressure,
+                         double *const speed_of_sound) const {
+    ComputeSpeedOfSoundBatch(number_of_cells, density, pressure,
+                             speed_of_sound);
+  }
 };
 
 #endif // EQUATION_OF_STATE_H
@@ -64,6 +64,33 @@ class NobleAbelStiffenedGas : public EquationOfState {
   double ComputeSpeedOfSound(double const density,
                              double const pressure) const override;
 
+  // batched functions, dispatched once per batch
+  void ComputePressureBatch(unsigned int const number_of_cells,
+                            double const *const mass,
+                            double const *const momentum_x,
+                            double const *const momentum_y,
+                            double const *const momentum_z,
+                            double const *const energy,
+                            double *const pressure) const override;
+  void ComputeTemperatureBatch(unsigned int const number_of_cells,
+                               double const *const mass,
+                               double const *const momentum_x,
+                               double const *const momentum_y,
+                               double const *const momentum_z,
+                               double const *const energy,
+                               double *const temperature) const override;
+  void ComputeEnergyBatch(unsigned int const number_of_cells,
+                          double const *const density,
+                          double const *const velocity_x,
+                          double const *const velocity_y,
+                          double const *const velocity_z,
+                          double const *const pressure,
+                          double *const energy) const override;
+  void ComputeSpeedOfSoundBatch(unsigned int const number_of_cells,
+                                double const *const density,
+                                double const *const pressure,
+                                double *const speed_of_sound) const override;
+
 public:
   NobleAbelStiffenedGas() = delete;
   explicit NobleAbelStiffenedGas(
@@ -202,6 +202,91 @@ StiffenedGasCompleteSafe::ComputeSpeedOfSound(double const density,
   return std::sqrt(std::max(speed_of_sound_squared, epsilon_));
 }
 
+/**
+ * @brief Computes the pressure for a batch of cells. The cell function is
+ * called directly, i.e. without virtual dispatch, to allow inlining and
+ * vectorization.
+ * @param number_of_cells The number of cells in the batch.
+ * @param mass, momentum_x, momentum_y, momentum_z, energy The conservative
+ * inputs of the batch.
+ * @param pressure The pressure of the batch. Indirect return parameter.
+ */
+void StiffenedGasCompleteSafe::ComputePressureBatch(
+    unsigned int const number_of_cells, double const *const mass,
+    double const *const momentum_x, double const *const momentum_y,
+    double const *const momentum_z, double const *const energy,
+    double *const pressure) const {
+  EvaluateConservativeBatch(
+      number_of_cells, mass, momentum_x, momentum_y, momentum_z, energy,
+      pressure,
+      [this](double const m, double const m_x, double const m_y,
+             double const m_z, double const e) {
+        return StiffenedGasCompleteSafe::ComputePressure(m, m_x, m_y, m_z, e);
+      });
+}
+
+/**
+ * @brief Computes the temperature for a batch of cells without virtual
+ * dispatch.
+ * @param number_of_cells The number of cells in the batch.
+ * @param mass, momentum_x, momentum_y, momentum_z, energy The conservative
+ * inputs of the batch.
+ * @param temperature The temperature of the batch. Indirect return parameter.
+ */
+void StiffenedGasCompleteSafe::ComputeTemperatureBatch(
+    unsigned int const number_of_cells, double const *const mass,
+    double const *const momentum_x, double const *const momentum_y,
+    double const *const momentum_z, double const *const energy,
+    double *const temperature) const {
+  EvaluateConservativeBatch(
+      number_of_cells, mass, momentum_x, momentum_y, momentum_z, energy,
+      temperature,
+      [this](double const m, double const m_x, double const m_y,
+             double const m_z, double const e) {
+        return StiffenedGasCompleteSafe::ComputeTemperature(m, m_x, m_y, m_z,
+                                                            e);
+      });
+}
+
+/**
+ * @brief Computes the energy for a batch of cells without virtual dispatch.
+ * @param number_of_cells The number of cells in the batch.
+ * @param density, velocity_x, velocity_y, velocity_z, pressure The prime state
+ * inputs of the batch.
+ * @param energy The energy of the batch. Indirect return parameter.
+ */
+void StiffenedGasCompleteSafe::ComputeEnergyBatch(
+    unsigned int const number_of_cells, double const *const density,
+    double const *const velocity_x, double const *const velocity_y,
+    double const *const velocity_z, double const *const pressure,
+    double *const energy) const {
+  EvaluatePrimeStateBatch(
+      number_of_cells, density, velocity_x, velocity_y, velocity_z, pressure,
+      energy,
+      [this](double const rho, double const u, double const v, double const w,
+             double const p) {
+        return StiffenedGasCompleteSafe::ComputeEnergy(rho, u, v, w, p);
+      });
+}
+
+/**
+ * @brief Computes the speed of sound for a batch of cells without virtual
+ * dispatch.
+ * @param number_of_cells The number of cells in the batch.
+ * @param density The density of the batch.
+ * @param pressure The pressure of the batch.
+ * @param speed_of_sound The speed of sound of the batch. Indirect return
+ * parameter.
+ */
+void StiffenedGasCompleteSafe::ComputeSpeedOfSoundBatch(
+    unsigned int const number_of_cells, double const *const density,
+    double const *const pressure, double *const speed_of_sound) const {
+  for (unsigned int c = 0; c < number_of_cells; ++c) {
+    speed_of_sound[c] =
+        StiffenedGasCompleteSafe::ComputeSpeedOfSound(density[c], pressure[c]);
+  }
+}
+
 /**
  * @brief Provides logging information of the equation of state.
  * @param indent Number of white spaces used at the beginning of each line for
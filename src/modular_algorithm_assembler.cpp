@@ -22,10 +22,14 @@
 #include "modular_algorithm_assembler.h"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
+#include <limits>
 #include <string>
+#include <utility>
 
 #include "block_definitions/interface_block.h"
+#include "communication/jump_buffer_exchanger.h"
 #include "communication/mpi_utilities.h"
 #include "enums/interface_tag_definition.h"
 #include "enums/remesh_identifier.h"
@@ -33,10 +37,12 @@
 #include "interface_tags/interface_tag_functions.h"
 #include "materials/equations_of_state/gamma_model_stiffened_gas.h"
 #include "multiresolution/multiresolution.h"
+#include "multiresolution/remeshing_analyzer.h"
 #include "topology/id_information.h"
 #include "user_specifications/compile_time_constants.h"
 #include "user_specifications/debug_and_profile_setup.h"
 #include "user_specifications/riemann_solver_settings.h"
+#include "utilities/container_operations.h"
 #include "utilities/string_operations.h"
 
 #include "utilities/buffer_operations_interface.h"
@@ -48,6 +54,12 @@ void SetTimeInProfileRuns(double &time) {
     time = MPI_Wtime();
   }
 }
+
+void SetTimeInLeafCostMeasurements(double &time) {
+  if constexpr (CC::MeasuredLeafCostsActive()) {
+    time = MPI_Wtime();
+  }
+}
 } // namespace
 
 /**
@@ -83,7 +95,8 @@ ModularAlgorithmAssembler::ModularAlgorithmAssembler(
       prime_state_handler_(material_manager),
       parameter_manager_(material_manager_, halo_manager_),
       space_solver_(material_manager_, gravity),
-      logger_(LogWriter::Instance()) {
+      logger_(LogWriter::Instance()),
+      leaf_compute_time_of_timestep_(0.0) {
   /* Empty besides initializer list*/
 }
 
@@ -404,8 +417,9 @@ void ModularAlgorithmAssembler::CreateNewSimulation(
     }
     if (level > 1) { // Level One may never be coarsened.
       coarsable_list.clear();
-      DetermineRemeshingNodes({level - 1}, coarsable_list,
-                              refinement_list); // Called on parent level
+      RemeshingAnalyzer(topology_, tree_, multiresolution_, communicator_)
+          .DetermineRemeshingNodes({level - 1}, coarsable_list,
+                                   refinement_list); // Called on parent level
 
       MpiUtilities::LocalToGlobalData(coarsable_list, MPI_LONG_LONG_INT,
                                       MpiUtilities::NumberOfRanks(),
@@ -550,6 +564,8 @@ void ModularAlgorithmAssembler::Advance() {
 
   // These variables are only for profiling
   double function_timer = 0.0;
+  // Start of the leaf compute time measurements for the load balancing
+  double compute_timer = 0.0;
 
   unsigned int const maximum_level = all_levels_.back();
 
@@ -568,6 +584,16 @@ void ModularAlgorithmAssembler::Advance() {
   bool exist_multi_nodes_global = MpiUtilities::GloballyReducedBool(
       !nodes_needing_multiphase_treatment.empty());
 
+  // The halo update of intermediate stages can only be overlapped with the
+  // right-hand side computation of the next stage if the latter is local to
+  // each leaf
+  constexpr bool halo_update_overlap_possible =
+      CC::HaloUpdateOverlapActive() && !CC::ParameterModelActive() &&
+      !(convective_term_solver == ConvectiveTermSolvers::FluxSplitting &&
+        FluxSplittingSettings::flux_splitting_scheme ==
+            FluxSplitting::GlobalLaxFriedrichs);
+  bool right_hand_side_computed_ahead = false;
+
   double time_measurement_start = 0.0;
   double time_measurement_end = 0.0;
 
@@ -581,7 +607,14 @@ void ModularAlgorithmAssembler::Advance() {
       time_measurement_start = MPI_Wtime();
     }
 
-    time_integrator_.AppendMicroTimestep(ComputeTimestepSize());
+    // The control commands polled on rank zero are distributed along with the
+    // time-step size
+    ControlCommands control_commands = input_output_.PollControlCommands();
+    time_integrator_.AppendMicroTimestep(ComputeTimestepSize(control_commands));
+    input_output_.ScheduleControlCommands(
+        control_commands, time_integrator_.CurrentRunTime(),
+        time_integrator_.MicroTimestepSizes().back() *
+            number_of_timesteps_on_finest_level);
     LogElapsedTimeSinceInProfileRuns(function_timer,
                                      "ComputeTimestepSize                ");
     ProvideDebugInformation("ComputeTimestepSize - Done ", plot_this_step,
@@ -609,7 +642,9 @@ void ModularAlgorithmAssembler::Advance() {
       // buffers.
       if (exist_multi_nodes_global) {
         SetTimeInProfileRuns(function_timer);
+        SetTimeInLeafCostMeasurements(compute_timer);
         ComputeLevelsetRightHandSide(nodes_needing_multiphase_treatment, stage);
+        AccumulateLeafComputeTimeSince(compute_timer);
         LogElapsedTimeSinceInProfileRuns(function_timer,
                                          "ComputeLevelsetRightHandSide       ");
         ProvideDebugInformation("ComputeLevelsetRightHandSide - Done ",
@@ -624,7 +659,9 @@ void ModularAlgorithmAssembler::Advance() {
                                 plot_this_step, log_this_step, debug_key);
 
         SetTimeInProfileRuns(function_timer);
+        SetTimeInLeafCostMeasurements(compute_timer);
         IntegrateLevelset(nodes_needing_multiphase_treatment, stage);
+        AccumulateLeafComputeTimeSince(compute_timer);
         LogElapsedTimeSinceInProfileRuns(function_timer,
                                          "IntegrateLevelset                  ");
         ProvideDebugInformation("IntegrateLevelset - Done ", plot_this_step,
@@ -646,13 +683,16 @@ void ModularAlgorithmAssembler::Advance() {
       }
 
       // compute rhs on all levels which need to be updated this integer
-      // timestep
-      SetTimeInProfileRuns(function_timer);
-      ComputeRightHandSide(levels_to_update_descending, stage);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "ComputeRightHandSide               ");
-      ProvideDebugInformation("ComputeRightHandSide - Done ", plot_this_step,
-                              log_this_step, debug_key);
+      // timestep (unless done during the halo update of the previous stage)
+      if (!right_hand_side_computed_ahead) {
+        SetTimeInProfileRuns(function_timer);
+        ComputeRightHandSide(levels_to_update_descending, stage);
+        LogElapsedTimeSinceInProfileRuns(function_timer,
+                                         "ComputeRightHandSide               ");
+        ProvideDebugInformation("ComputeRightHandSide - Done ", plot_this_step,
+                                log_this_step, debug_key);
+      }
+      right_hand_side_computed_ahead = false;
 
       // Flux averaging from levels which run this timestep down to the lowest
       // neighbor level or parent
@@ -682,7 +722,9 @@ void ModularAlgorithmAssembler::Advance() {
       levels_with_updated_parents_descending.pop_back();
 
       SetTimeInProfileRuns(function_timer);
+      SetTimeInLeafCostMeasurements(compute_timer);
       Integrate(levels_to_update_descending, stage);
+      AccumulateLeafComputeTimeSince(compute_timer);
       LogElapsedTimeSinceInProfileRuns(function_timer,
                                        "Integrate                          ");
       ProvideDebugInformation("Integration - Done ", plot_this_step,
@@ -692,8 +734,10 @@ void ModularAlgorithmAssembler::Advance() {
       // reinitialized values for the next iteration.
       if (exist_multi_nodes_global) {
         SetTimeInProfileRuns(function_timer);
+        SetTimeInLeafCostMeasurements(compute_timer);
         multi_phase_manager_.PropagateLevelset(
             nodes_needing_multiphase_treatment);
+        AccumulateLeafComputeTimeSince(compute_timer);
         LogElapsedTimeSinceInProfileRuns(function_timer,
                                          "PropagateLevelset                  ");
         ProvideDebugInformation(
@@ -721,10 +765,22 @@ void ModularAlgorithmAssembler::Advance() {
                                 log_this_step, debug_key);
       }
 
-      // boundary exchange mean values and jumps on finished levels
+      // boundary exchange mean values and jumps on finished levels. In
+      // intermediate stages of single-phase simulations the swap, the prime
+      // state computation and the next right-hand side are carried out during
+      // the halo update.
+      bool const overlap_halo_update = halo_update_overlap_possible &&
+                                       !time_integrator_.IsLastStage(stage) &&
+                                       !exist_multi_nodes_global;
       SetTimeInProfileRuns(function_timer);
-      halo_manager_.MaterialHaloUpdate(levels_to_update_ascending,
-                                       MaterialFieldType::Conservatives, true);
+      if (overlap_halo_update) {
+        AdvanceToNextStageDuringHaloUpdate(levels_to_update_descending,
+                                           levels_to_update_ascending, stage);
+        right_hand_side_computed_ahead = true;
+      } else {
+        halo_manager_.MaterialHaloUpdate(
+            levels_to_update_ascending, MaterialFieldType::Conservatives, true);
+      }
       LogElapsedTimeSinceInProfileRuns(function_timer,
                                        "UpdateHalos ( cut_jumps )            ");
       ProvideDebugInformation(
@@ -732,6 +788,14 @@ void ModularAlgorithmAssembler::Advance() {
           plot_this_step, log_this_step, debug_key);
 
       if (time_integrator_.IsLastStage(stage)) {
+        // The measured compute time is attributed to the leaves of this micro
+        // time step before they are changed
+        if constexpr (CC::MeasuredLeafCostsActive()) {
+          topology_.AccumulateLeafCostSample(levels_to_update_descending,
+                                             leaf_compute_time_of_timestep_);
+          leaf_compute_time_of_timestep_ = 0.0;
+        }
+
         if (exist_multi_nodes_global) {
           SetTimeInProfileRuns(function_timer);
           SenseVanishedInterface(levels_to_update_descending);
@@ -825,23 +889,25 @@ void ModularAlgorithmAssembler::Advance() {
                                 debug_key);
       }
 
-      // SWAP on levels which were integrated this step
-      SetTimeInProfileRuns(function_timer);
-      SwapBuffers(levels_to_update_descending, stage);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "Swap                               ");
-      ProvideDebugInformation("SwapOnLevel - Done ", plot_this_step,
-                              log_this_step, debug_key);
+      if (!overlap_halo_update) {
+        // SWAP on levels which were integrated this step
+        SetTimeInProfileRuns(function_timer);
+        SwapBuffers(levels_to_update_descending, stage);
+        LogElapsedTimeSinceInProfileRuns(function_timer,
+                                         "Swap                               ");
+        ProvideDebugInformation("SwapOnLevel - Done ", plot_this_step,
+                                log_this_step, debug_key);
 
-      // Calculate the prime states based on the integrated conservatives and
-      // save them in the prime state buffer.
-      SetTimeInProfileRuns(function_timer);
-      ObtainPrimeStatesFromConservatives<ConservativeBufferType::Average>(
-          levels_to_update_descending);
-      LogElapsedTimeSinceInProfileRuns(function_timer,
-                                       "ObtainPrimeStatesFromConservatives ");
-      ProvideDebugInformation("ObtainPrimeStatesFromConservatives - Done ",
-                              plot_this_step, log_this_step, debug_key);
+        // Calculate the prime states based on the integrated conservatives and
+        // save them in the prime state buffer.
+        SetTimeInProfileRuns(function_timer);
+        ObtainPrimeStatesFromConservatives<ConservativeBufferType::Average>(
+            levels_to_update_descending);
+        LogElapsedTimeSinceInProfileRuns(function_timer,
+                                         "ObtainPrimeStatesFromConservatives ");
+        ProvideDebugInformation("ObtainPrimeStatesFromConservatives - Done ",
+                                plot_this_step, log_this_step, debug_key);
+      }
 
       // Calculate the parameters based on the prime states and save them in the
       // parameter buffer.
@@ -900,9 +966,10 @@ void ModularAlgorithmAssembler::Advance() {
 
     // Safe stop of the code ( after every micro timestep, therefore not in
     // ComputeLoop )
-    if (input_output_.CheckIfAbortfileExists()) {
-      logger_.LogMessage("The file 'ABORTFILE' was found in the output folder. "
-                         "Simulation is being terminated");
+    if (control_commands.abort_) {
+      logger_.LogMessage("An abort was requested through the output folder "
+                         "('ABORTFILE' or 'CONTROLFILE'). Simulation is being "
+                         "terminated");
       throw std::runtime_error("The simulation was aborted by the user! \n");
     }
   }
@@ -987,24 +1054,123 @@ void ModularAlgorithmAssembler::ComputeRightHandSide(
                   MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
     space_solver_.SetFluxFunctionGlobalEigenvalues(max_eigenvalues);
   }
+  // Only the leaf-local computation counts towards the leaf costs
+  double compute_timer = 0.0;
+  SetTimeInLeafCostMeasurements(compute_timer);
   for (auto const &level : levels) {
-    for (Node &node : tree_.LeavesOnLevel(level)) {
-      time_integrator_.FillInitialBuffer(node, stage);
-
-      // compute fluxes for levelset and materials ( including single phase and
-      // interface contributions! )
-      space_solver_.UpdateFluxes(node);
-
-      // Integration can only be performed on conservatives, but not on volume
-      // averaged conservatives. Thus, we have to transform the volume averaged
-      // conservatives, which are currently saved in the average buffer, to
-      // conservatives.
-      multi_phase_manager_.TransformToConservatives(node);
-
-      // Conservative as well as levelset buffers are prepared for integration
-      time_integrator_.PrepareBufferForIntegration(node, stage);
-    } // node
-  }   // level
+    ContainerOperations::ForEachInParallel(
+        tree_.LeavesOnLevel(level),
+        [this, stage](Node &node) { ComputeRightHandSideOfLeaf(node, stage); });
+  } // level
+  AccumulateLeafComputeTimeSince(compute_timer);
+}
+
+/**
+ * @brief Computes the f( u ) term in the Runge-Kutta function for a single
+ * leaf. Stores the result in the right-hand side buffers.
+ * @param node The leaf for which the right-hand side is computed.
+ * @param stage The current Runge-Kutta stage.
+ */
+void ModularAlgorithmAssembler::ComputeRightHandSideOfLeaf(
+    Node &node, unsigned int const stage) {
+  time_integrator_.FillInitialBuffer(node, stage);
+
+  // compute fluxes for levelset and materials ( including single phase and
+  // interface contributions! )
+  space_solver_.UpdateFluxes(node);
+
+  // Integration can only be performed on conservatives, but not on volume
+  // averaged conservatives. Thus, we have to transform the volume averaged
+  // conservatives, which are currently saved in the average buffer, to
+  // conservatives.
+  multi_phase_manager_.TransformToConservatives(node);
+
+  // Conservative as well as levelset buffers are prepared for integration
+  time_integrator_.PrepareBufferForIntegration(node, stage);
+}
+
+/**
+ * @brief Carries out the halo update of the integrated conservatives at the end
+ * of an intermediate stage together with the remaining work of the stage and
+ * the right-hand side computation of the next stage. Leaves whose halos are
+ * filled by rank-local copies only are advanced while the mpi messages of the
+ * halo update are in flight, all other nodes once the update is completed.
+ * Gives the same result as MaterialHaloUpdate (cut jumps), SwapBuffers,
+ * ObtainPrimeStatesFromConservatives and ComputeRightHandSide of the next
+ * stage.
+ * @param levels_descending The levels integrated in the current stage in
+ * descending order.
+ * @param levels_ascending The same levels in ascending order.
+ * @param stage The current Runge-Kutta stage, must not be the last one.
+ * @note Only valid if no multi-phase nodes exist and the right-hand side of a
+ * leaf depends on its own data only (no global Lax-Friedrichs, no parameter
+ * models).
+ */
+void ModularAlgorithmAssembler::AdvanceToNextStageDuringHaloUpdate(
+    std::vector<unsigned int> const &levels_descending,
+    std::vector<unsigned int> const &levels_ascending,
+    unsigned int const stage) {
+  halo_manager_.BeginMaterialHaloUpdate(levels_ascending,
+                                        MaterialFieldType::Conservatives);
+
+  std::vector<nid_t> leaves_ahead;
+  for (unsigned int const level : levels_descending) {
+    std::vector<nid_t> const &leaves = communicator_.RankLocalHaloLeaves(level);
+    leaves_ahead.insert(leaves_ahead.end(), leaves.begin(), leaves.end());
+  }
+  std::vector<std::reference_wrapper<Node>> nodes_ahead;
+  nodes_ahead.reserve(leaves_ahead.size());
+  for (nid_t const id : leaves_ahead) {
+    nodes_ahead.emplace_back(tree_.GetNodeWithId(id));
+  }
+  AdvanceLeavesToNextStage(nodes_ahead, stage);
+
+  halo_manager_.EndMaterialHaloUpdate(levels_ascending,
+                                      MaterialFieldType::Conservatives, true);
+
+  std::sort(leaves_ahead.begin(), leaves_ahead.end());
+  std::vector<std::reference_wrapper<Node>> remaining_leaves;
+  std::vector<std::reference_wrapper<Node>> remaining_parents;
+  for (unsigned int const level : levels_descending) {
+    for (auto &[id, node] : tree_.GetLevelContent(level)) {
+      if (!std::binary_search(leaves_ahead.begin(), leaves_ahead.end(), id)) {
+        if (topology_.NodeIsLeaf(id)) {
+          remaining_leaves.emplace_back(node);
+        } else {
+          remaining_parents.emplace_back(node);
+        }
+      }
+    }
+  }
+  ContainerOperations::ForEachInParallel(
+      remaining_parents, [this](Node &parent) {
+        time_integrator_.SwapBuffersForNextStage(parent);
+      });
+  AdvanceLeavesToNextStage(remaining_leaves, stage);
+}
+
+/**
+ * @brief Swaps the buffers of leaves after an intermediate stage, obtains their
+ * prime states and computes the right-hand side of the next stage in the same
+ * way as ComputeRightHandSide.
+ * @param leaves The leaves to be advanced.
+ * @param stage The current Runge-Kutta stage, must not be the last one.
+ */
+void ModularAlgorithmAssembler::AdvanceLeavesToNextStage(
+    std::vector<std::reference_wrapper<Node>> const &leaves,
+    unsigned int const stage) {
+  ContainerOperations::ForEachInParallel(leaves, [this](Node &leaf) {
+    time_integrator_.SwapBuffersForNextStage(leaf);
+    DoObtainPrimeStatesFromConservativesForNonLevelsetNodes<
+        ConservativeBufferType::Average>(leaf);
+  });
+  // Only the leaf-local computation counts towards the leaf costs
+  double compute_timer = 0.0;
+  SetTimeInLeafCostMeasurements(compute_timer);
+  ContainerOperations::ForEachInParallel(leaves, [this, stage](Node &leaf) {
+    ComputeRightHandSideOfLeaf(leaf, stage + 1);
+  });
+  AccumulateLeafComputeTimeSince(compute_timer);
 }
 
 /**
@@ -1046,16 +1212,17 @@ void ModularAlgorithmAssembler::SwapBuffers(
     unsigned int const stage) const {
 
   for (auto const &level : updated_levels) {
-    for (Node &node : tree_.NodesOnLevel(level)) {
-      if (time_integrator_.IsLastStage(stage) && node.HasLevelset()) {
-        BO::Interface::CopyInterfaceDescriptionBufferForNode<
-            InterfaceDescriptionBufferType::Reinitialized,
-            InterfaceDescriptionBufferType::RightHandSide>(node);
-      } // node with level set and final stage
-
-      time_integrator_.SwapBuffersForNextStage(node);
-    } // nodes
-  }   // levels
+    ContainerOperations::ForEachInParallel(
+        tree_.NodesOnLevel(level), [this, stage](Node &node) {
+          if (time_integrator_.IsLastStage(stage) && node.HasLevelset()) {
+            BO::Interface::CopyInterfaceDescriptionBufferForNode<
+                InterfaceDescriptionBufferType::Reinitialized,
+                InterfaceDescriptionBufferType::RightHandSide>(node);
+          } // node with level set and final stage
+
+          time_integrator_.SwapBuffersForNextStage(node);
+        }); // nodes
+  }         // levels
 }
 
 /**
@@ -1073,9 +1240,11 @@ void ModularAlgorithmAssembler::Integrate(
         1 << (all_levels_.back() - level); // 2^x
 
     // We integrate all leaves
-    for (Node &node : tree_.LeavesOnLevel(level)) {
-      time_integrator_.IntegrateNode(node, stage, number_of_timesteps);
-    }
+    ContainerOperations::ForEachInParallel(
+        tree_.LeavesOnLevel(level),
+        [this, stage, number_of_timesteps](Node &node) {
+          time_integrator_.IntegrateNode(node, stage, number_of_timesteps);
+        });
 
     /* We need to integrate the values in jump halos. However, as two jump halos
      * may overlap, we integrate ALL halos values if the node has ANY jump. The
@@ -1343,6 +1512,8 @@ void ModularAlgorithmAssembler::SenseVanishedInterface(
  *        - Resetting the jump buffers
  * @param finished_levels_descending Levels which ran this time instance and
  * thus have correct values in their jump buffers.
+ * @note Jump buffers of nodes on other ranks are exchanged non-blocking and
+ * aggregated per partner rank by the JumpBufferExchanger.
  */
 void ModularAlgorithmAssembler::JumpFluxAdjustment(
     std::vector<unsigned int> const finished_levels_descending) const {
@@ -1358,54 +1529,12 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
   std::vector<unsigned int> level_exchanging(finished_levels_descending);
   level_exchanging.erase(level_exchanging.begin());
   int const my_rank = communicator_.MyRankId();
+  constexpr std::size_t face_size = JumpBufferSendingSize();
+  JumpBufferExchanger jump_buffer_exchanger(topology_, tree_);
 
   /*** Sending Down ***/
   // First the parents' jump buffers are filled form the childrens values.
-  for (auto const &level : levels_averaging_down) {
-    for (auto const &child_id : topology_.IdsOnLevel(level)) {
-      nid_t const parent_id = ParentIdOfNode(child_id);
-      int const rank_of_child = topology_.GetRankOfNode(child_id);
-      int const rank_of_parent = topology_.GetRankOfNode(parent_id);
-      if (rank_of_child == my_rank && rank_of_parent == my_rank) {
-        // Non MPI Averaging
-        Node &parent = tree_.GetNodeWithId(parent_id);
-        Node const &child = tree_.GetNodeWithId(child_id);
-        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
-          Multiresolution::AverageJumpBuffer(
-              child.GetPhaseByMaterial(material).GetBoundaryJumpConservatives(),
-              parent.GetPhaseByMaterial(material)
-                  .GetBoundaryJumpConservatives(),
-              child_id);
-        }
-      } else if (rank_of_child == my_rank && rank_of_parent != my_rank) {
-        // MPI_ISend
-        Node const &child = tree_.GetNodeWithId(child_id);
-        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
-          MPI_Send(&child.GetPhaseByMaterial(material)
-                        .GetBoundaryJumpConservatives(),
-                   CC::SIDES(), communicator_.JumpSurfaceDatatype(),
-                   rank_of_parent, communicator_.TagForRank(rank_of_parent),
-                   MPI_COMM_WORLD);
-        }
-      } else if (rank_of_child != my_rank && rank_of_parent == my_rank) {
-        SurfaceBuffer childs_jump_buffer;
-
-        // MPI_Recv
-        Node &parent = tree_.GetNodeWithId(parent_id);
-        for (auto const material : topology_.GetMaterialsOfNode(child_id)) {
-          MPI_Recv(&childs_jump_buffer, CC::SIDES(),
-                   communicator_.JumpSurfaceDatatype(), rank_of_child,
-                   communicator_.TagForRank(rank_of_child), MPI_COMM_WORLD,
-                   MPI_STATUS_IGNORE);
-          Multiresolution::AverageJumpBuffer(
-              childs_jump_buffer,
-              parent.GetPhaseByMaterial(material)
-                  .GetBoundaryJumpConservatives(),
-              child_id);
-        }
-      }
-    }
-  }
+  jump_buffer_exchanger.AverageJumpBuffersDown(levels_averaging_down);
 
   /*** Exchanging ***/
 
@@ -1415,11 +1544,24 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
    * 3. ) Its neighbor is not a leaf
    */
 
-  nid_t neighbor_id;
-  bool neighbor_exists;
-  bool neighbor_is_leaf;
+  // The order of the leaves must be identical on all ranks
+  std::vector<std::vector<nid_t>> leaf_ids_on_levels;
+  for (auto const &level : level_exchanging) {
+    leaf_ids_on_levels.push_back(topology_.LeafIdsOnLevel(level));
+    std::sort(leaf_ids_on_levels.back().begin(),
+              leaf_ids_on_levels.back().end());
+  }
+
+  std::vector<std::vector<double>> const &received_faces =
+      jump_buffer_exchanger.ExchangeCoarseNeighborFaces(leaf_ids_on_levels);
+
+  // Read position in the faces received from each partner rank
+  std::vector<double const *> received_face(received_faces.size());
+  for (std::size_t rank = 0; rank < received_faces.size(); ++rank) {
+    received_face[rank] = received_faces[rank].data();
+  }
+
   BoundaryLocation neighbor_location;
-  std::vector<nid_t> leaf_ids_on_level;
   unsigned int x_start;
   unsigned int x_end;
   unsigned int y_start;
@@ -1446,18 +1588,19 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
       }
     }
   }
-  for (auto const &level : level_exchanging) {
-    leaf_ids_on_level = topology_.LeafIdsOnLevel(level);
+  for (auto const &leaf_ids_on_level : leaf_ids_on_levels) {
     for (auto const &leaf_id : leaf_ids_on_level) {
+      // I must have the Node to collect the data and update
+      if (!topology_.NodeIsOnRank(leaf_id, my_rank)) {
+        continue;
+      }
       for (MaterialName const material :
            topology_.GetMaterialsOfNode(leaf_id)) {
         for (auto const &location : CC::ANBS()) {
-          neighbor_id = topology_.GetTopologyNeighborId(leaf_id, location);
-          neighbor_exists = topology_.NodeExists(neighbor_id);
-          if (neighbor_exists) {
-            neighbor_is_leaf = topology_.NodeIsLeaf(neighbor_id);
-          } else {
-            neighbor_is_leaf = false;
+          nid_t const neighbor_id =
+              topology_.GetTopologyNeighborId(leaf_id, location);
+          if (!jump_buffer_exchanger.NeighborIsParent(neighbor_id)) {
+            continue;
           }
           neighbor_location = OppositeDirection(location);
           x_start = CC::FICX();
@@ -1466,173 +1609,150 @@ void ModularAlgorithmAssembler::JumpFluxAdjustment(
           y_end = CC::LICY();
           z_start = CC::FICZ();
           z_end = CC::LICZ();
-          if (neighbor_exists && !neighbor_is_leaf) {
-            if (topology_.NodeIsOnRank(
-                    leaf_id, my_rank)) { // I have the Node, I must collect the
-                                         // data and update
-
-              direction = 0.0;
-              switch (location) {
-              case BoundaryLocation::East:
-                x_start = CC::LICX();
-                direction = -1.0;
-                break;
-              case BoundaryLocation::West:
-                x_end = CC::FICX();
-                direction = 1.0;
-                break;
-              case BoundaryLocation::North:
-                y_start = CC::LICY();
-                direction = -1.0;
-                break;
-              case BoundaryLocation::South:
-                y_end = CC::FICY();
-                direction = 1.0;
-                break;
-              case BoundaryLocation::Top:
-                z_start = CC::LICZ();
-                direction = -1.0;
-                break;
-              case BoundaryLocation::Bottom:
-                z_end = CC::FICZ();
-                direction = 1.0;
-                break;
-              default:
+
+          direction = 0.0;
+          switch (location) {
+          case BoundaryLocation::East:
+            x_start = CC::LICX();
+            direction = -1.0;
+            break;
+          case BoundaryLocation::West:
+            x_end = CC::FICX();
+            direction = 1.0;
+            break;
+          case BoundaryLocation::North:
+            y_start = CC::LICY();
+            direction = -1.0;
+            break;
+          case BoundaryLocation::South:
+            y_end = CC::FICY();
+            direction = 1.0;
+            break;
+          case BoundaryLocation::Top:
+            z_start = CC::LICZ();
+            direction = -1.0;
+            break;
+          case BoundaryLocation::Bottom:
+            z_end = CC::FICZ();
+            direction = 1.0;
+            break;
+          default:
 #ifdef PERFORMANCE
-                break;
+            break;
 #else
-                throw std::invalid_argument(
-                    " Why, oh why, did my simulation break?");
+            throw std::invalid_argument(
+                " Why, oh why, did my simulation break?");
 #endif
-              }
+          }
 #ifndef PERFORMANCE
-              if (direction == 0.0) {
-                throw std::logic_error("No no no");
-              }
+          if (direction == 0.0) {
+            throw std::logic_error("No no no");
+          }
 #endif
-              Node &node = tree_.GetNodeWithId(leaf_id);
-              one_cell_size = 1.0 / node.GetCellSize();
-              Block &block = node.GetPhaseByMaterial(material);
-              double(&jump_buffer)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-                  block.GetBoundaryJumpConservatives(location);
-              unsigned int jump_index_one = 0;
-              unsigned int jump_index_two = 0;
-
-              // Update Setup One
-              for (Equation const eq : MF::ASOE()) {
-                jump_index_one = 0;
-                jump_index_two = 0;
-                for (unsigned int i = x_start; i <= x_end; ++i) {
-                  for (unsigned int j = y_start; j <= y_end; ++j) {
-                    for (unsigned int k = z_start; k <= z_end; ++k) {
-                      coarse_fluxes[LTI(location)][ETI(eq)][i][j][k] =
-                          jump_buffer[ETI(eq)][jump_index_one][jump_index_two] *
-                          one_cell_size * direction;
-                      jump_index_two++;
-                      // 3D: counter equal to IC, 2D: equal to 1, hence use
-                      // std::min
-                      if (jump_index_two ==
-                          std::min(CC::ICX(), std::min(CC::ICY(), CC::ICZ()))) {
-                        jump_index_one++;
-                        jump_index_two = 0;
-                      }
-                    }
+          Node &node = tree_.GetNodeWithId(leaf_id);
+          one_cell_size = 1.0 / node.GetCellSize();
+          Block &block = node.GetPhaseByMaterial(material);
+          double(&jump_buffer)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+              block.GetBoundaryJumpConservatives(location);
+          unsigned int jump_index_one = 0;
+          unsigned int jump_index_two = 0;
+
+          // Update Setup One
+          for (Equation const eq : MF::ASOE()) {
+            jump_index_one = 0;
+            jump_index_two = 0;
+            for (unsigned int i = x_start; i <= x_end; ++i) {
+              for (unsigned int j = y_start; j <= y_end; ++j) {
+                for (unsigned int k = z_start; k <= z_end; ++k) {
+                  coarse_fluxes[LTI(location)][ETI(eq)][i][j][k] =
+                      jump_buffer[ETI(eq)][jump_index_one][jump_index_two] *
+                      one_cell_size * direction;
+                  jump_index_two++;
+                  // 3D: counter equal to IC, 2D: equal to 1, hence use
+                  // std::min
+                  if (jump_index_two ==
+                      std::min(CC::ICX(), std::min(CC::ICY(), CC::ICZ()))) {
+                    jump_index_one++;
+                    jump_index_two = 0;
                   }
                 }
               }
-              if (topology_.NodeIsOnRank(neighbor_id, my_rank)) {
-                // Non-MPI
-                double const(
-                    &neighbor_jump_buffer)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-                    tree_.GetNodeWithId(neighbor_id)
-                        .GetPhaseByMaterial(material)
-                        .GetBoundaryJumpConservatives(neighbor_location);
-                for (unsigned int e = 0; e < MF::ANOE(); ++e) {
-                  for (unsigned int i = 0; i < CC::ICY(); ++i) {
-                    for (unsigned int j = 0; j < CC::ICZ(); ++j) {
-                      jump_buffer[e][i][j] = neighbor_jump_buffer[e][i][j];
-                    }
-                  }
+            }
+          }
+          if (topology_.NodeIsOnRank(neighbor_id, my_rank)) {
+            // Non-MPI
+            double const(
+                &neighbor_jump_buffer)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
+                tree_.GetNodeWithId(neighbor_id)
+                    .GetPhaseByMaterial(material)
+                    .GetBoundaryJumpConservatives(neighbor_location);
+            for (unsigned int e = 0; e < MF::ANOE(); ++e) {
+              for (unsigned int i = 0; i < CC::ICY(); ++i) {
+                for (unsigned int j = 0; j < CC::ICZ(); ++j) {
+                  jump_buffer[e][i][j] = neighbor_jump_buffer[e][i][j];
                 }
-              } else {
-                // MPI Recv
-                // Overwrites directly into the jump_buffer
-                MPI_Recv(jump_buffer, JumpBufferSendingSize(), MPI_DOUBLE,
-                         topology_.GetRankOfNode(neighbor_id), 0,
-                         MPI_COMM_WORLD, MPI_STATUS_IGNORE);
               }
+            }
+          } else {
+            // Overwrites directly into the jump_buffer
+            double const *&face =
+                received_face[topology_.GetRankOfNode(neighbor_id)];
+            std::copy_n(face, face_size, &jump_buffer[0][0][0]);
+            face += face_size;
+          }
 
-              // Update Step 2
-              jump_index_one = 0;
-              jump_index_two = 0;
-              for (Equation const eq : MF::ASOE()) {
-                jump_index_one = 0;
-                jump_index_two = 0;
-                for (unsigned int i = x_start; i <= x_end; ++i) {
-                  for (unsigned int j = y_start; j <= y_end; ++j) {
-                    for (unsigned int k = z_start; k <= z_end; ++k) {
-                      fine_fluxes[LTI(location)][ETI(eq)][i][j][k] =
-                          jump_buffer[ETI(eq)][jump_index_one][jump_index_two] *
-                          one_cell_size * direction;
-                      jump_index_two++;
-                      // 3D: counter equal to IC, 2D: equal to 1, hence use
-                      // std::min
-                      if (jump_index_two ==
-                          std::min(CC::ICX(), std::min(CC::ICY(), CC::ICZ()))) {
-                        jump_index_one++;
-                        jump_index_two = 0;
-                      }
-                    }
+          // Update Step 2
+          jump_index_one = 0;
+          jump_index_two = 0;
+          for (Equation const eq : MF::ASOE()) {
+            jump_index_one = 0;
+            jump_index_two = 0;
+            for (unsigned int i = x_start; i <= x_end; ++i) {
+              for (unsigned int j = y_start; j <= y_end; ++j) {
+                for (unsigned int k = z_start; k <= z_end; ++k) {
+                  fine_fluxes[LTI(location)][ETI(eq)][i][j][k] =
+                      jump_buffer[ETI(eq)][jump_index_one][jump_index_two] *
+                      one_cell_size * direction;
+                  jump_index_two++;
+                  // 3D: counter equal to IC, 2D: equal to 1, hence use
+                  // std::min
+                  if (jump_index_two ==
+                      std::min(CC::ICX(), std::min(CC::ICY(), CC::ICZ()))) {
+                    jump_index_one++;
+                    jump_index_two = 0;
                   }
                 }
               }
-            } else {
-              if (topology_.NodeIsOnRank(
-                      neighbor_id,
-                      my_rank)) { // I do not have the Node but I do have the
-                                  // Neighbor and must send it
-                // Send MPI
-                double(
-                    &neighbor_jump_buffer)[MF::ANOE()][CC::ICY()][CC::ICZ()] =
-                    tree_.GetNodeWithId(neighbor_id)
-                        .GetPhaseByMaterial(material)
-                        .GetBoundaryJumpConservatives(neighbor_location);
-                MPI_Send(neighbor_jump_buffer, JumpBufferSendingSize(),
-                         MPI_DOUBLE, topology_.GetRankOfNode(leaf_id), 0,
-                         MPI_COMM_WORLD);
-              }
             }
-          } // Neighbor qualifies for exchange
-        }   // location
+          }
+        } // location
 
         // Now add up/subtract everything here
-        if (topology_.NodeIsOnRank(leaf_id, my_rank)) {
-          Node &node = tree_.GetNodeWithId(leaf_id);
-          Block &block = node.GetPhaseByMaterial(material);
-          for (Equation const eq : MF::ASOE()) {
-            double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-                block.GetRightHandSideBuffer(eq);
-            for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
-              for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
-                for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
-                  cells[i][j][k] -= ConsistencyManagedSum(
-                      coarse_fluxes[0][ETI(eq)][i][j][k] +
-                          coarse_fluxes[1][ETI(eq)][i][j][k],
-                      coarse_fluxes[2][ETI(eq)][i][j][k] +
-                          coarse_fluxes[3][ETI(eq)][i][j][k],
-                      coarse_fluxes[4][ETI(eq)][i][j][k] +
-                          coarse_fluxes[5][ETI(eq)][i][j][k]);
-                  cells[i][j][k] += ConsistencyManagedSum(
-                      fine_fluxes[0][ETI(eq)][i][j][k] +
-                          fine_fluxes[1][ETI(eq)][i][j][k],
-                      fine_fluxes[2][ETI(eq)][i][j][k] +
-                          fine_fluxes[3][ETI(eq)][i][j][k],
-                      fine_fluxes[4][ETI(eq)][i][j][k] +
-                          fine_fluxes[5][ETI(eq)][i][j][k]);
-                  for (unsigned int b = 0; b < 6; b++) {
-                    coarse_fluxes[b][ETI(eq)][i][j][k] = 0.0;
-                    fine_fluxes[b][ETI(eq)][i][j][k] = 0.0;
-                  }
+        Node &node = tree_.GetNodeWithId(leaf_id);
+        Block &block = node.GetPhaseByMaterial(material);
+        for (Equation const eq : MF::ASOE()) {
+          double(&cells)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+              block.GetRightHandSideBuffer(eq);
+          for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+            for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+              for (unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k) {
+                cells[i][j][k] -= ConsistencyManagedSum(
+                    coarse_fluxes[0][ETI(eq)][i][j][k] +
+                        coarse_fluxes[1][ETI(eq)][i][j][k],
+                    coarse_fluxes[2][ETI(eq)][i][j][k] +
+                        coarse_fluxes[3][ETI(eq)][i][j][k],
+                    coarse_fluxes[4][ETI(eq)][i][j][k] +
+                        coarse_fluxes[5][ETI(eq)][i][j][k]);
+                cells[i][j][k] += ConsistencyManagedSum(
+                    fine_fluxes[0][ETI(eq)][i][j][k] +
+                        fine_fluxes[1][ETI(eq)][i][j][k],
+                    fine_fluxes[2][ETI(eq)][i][j][k] +
+                        fine_fluxes[3][ETI(eq)][i][j][k],
+                    fine_fluxes[4][ETI(eq)][i][j][k] +
+                        fine_fluxes[5][ETI(eq)][i][j][k]);
+                for (unsigned int b = 0; b < 6; b++) {
+                  coarse_fluxes[b][ETI(eq)][i][j][k] = 0.0;
+                  fine_fluxes[b][ETI(eq)][i][j][k] = 0.0;
                 }
               }
             }
@@ -1661,14 +1781,16 @@ void ModularAlgorithmAssembler::ObtainPrimeStatesFromConservatives(
     std::vector<unsigned int> const updated_levels,
     bool const skip_interface_nodes) const {
   for (unsigned int const &level : updated_levels) {
-    for (Node &non_levelset_node : tree_.NonLevelsetLeaves(level)) {
-      DoObtainPrimeStatesFromConservativesForNonLevelsetNodes<C>(
-          non_levelset_node);
-    } // nodes without interface
+    ContainerOperations::ForEachInParallel(
+        tree_.NonLevelsetLeaves(level), [this](Node &non_levelset_node) {
+          DoObtainPrimeStatesFromConservativesForNonLevelsetNodes<C>(
+              non_levelset_node);
+        }); // nodes without interface
     if (!skip_interface_nodes && level == all_levels_.back()) {
-      for (Node &node : tree_.NodesWithLevelset()) {
-        DoObtainPrimeStatesFromConservativesForLevelsetNodes<C>(node);
-      }
+      ContainerOperations::ForEachInParallel(
+          tree_.NodesWithLevelset(), [this](Node &node) {
+            DoObtainPrimeStatesFromConservativesForLevelsetNodes<C>(node);
+          });
     } // nodes with interface
   }   // levels
 }
@@ -1771,12 +1893,15 @@ void ModularAlgorithmAssembler::
 
 /**
  * @brief Determines the maximal allowed size of the next time step ( on the
- * finest level ).
+ * finest level ). The control commands of rank zero are distributed within the
+ * same reduction.
+ * @param control_commands The control commands polled on rank zero (indirect
+ * return: the commands of rank zero on all ranks).
  * @return Largest non-cfl-violating time step size on the finest level.
  */
-double ModularAlgorithmAssembler::ComputeTimestepSize() const {
+double ModularAlgorithmAssembler::ComputeTimestepSize(
+    ControlCommands &control_commands) const {
 
-  std::array<double, DTI(CC::DIM())> velocity_plus_sound;
   double dt = 0.0;
   double sum_of_signalspeeds = 0.0;
 
@@ -1794,7 +1919,15 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
   constexpr double thermal_diffusivity_dt_constant = 0.1;
   double thermal_diffusivity = 0.0;
 
-  for (Node &node : tree_.Leaves()) {
+  // Only maxima are accumulated, hence, the result is independent of the
+  // distribution of the leaves among threads
+  std::vector<std::reference_wrapper<Node>> const leaves = tree_.Leaves();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)                                     \
+    reduction(max : sum_of_signalspeeds, nu, sigma, g, thermal_diffusivity)
+#endif
+  for (std::size_t leaf_index = 0; leaf_index < leaves.size(); ++leaf_index) {
+    Node const &node = leaves[leaf_index];
     for (auto const &[material, block] : node.GetPhases()) {
       if constexpr (CC::SolidBoundaryActive()) {
         if (material_manager_.IsSolidBoundary(material))
@@ -1836,6 +1969,25 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
                          gravity_[2] * gravity_[2])));
       }
 
+      // Without interface all internal cells are considered, hence, the speed
+      // of sound is evaluated in batches along z instead of cell by cell
+      bool const batched_speed_of_sound =
+          CC::InviscidExchangeActive() &&
+          active_equations != EquationSet::GammaModel && !node.HasLevelset();
+      double speed_of_sound[CC::ICX()][CC::ICY()][CC::ICZ()];
+      if (batched_speed_of_sound) {
+        EquationOfState const &eos =
+            material_manager_.GetMaterial(material).GetEquationOfState();
+        for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
+          for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
+            eos.SpeedOfSoundBatch(
+                CC::ICZ(), &prime_states[PrimeState::Density][i][j][CC::FICZ()],
+                &prime_states[PrimeState::Pressure][i][j][CC::FICZ()],
+                speed_of_sound[i - CC::FICX()][j - CC::FICY()]);
+          }
+        }
+      }
+
       // Loop through all iternal cells
       for (unsigned int i = CC::FICX(); i <= CC::LICX(); ++i) {
         for (unsigned int j = CC::FICY(); j <= CC::LICY(); ++j) {
@@ -1847,7 +1999,10 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
               // only required when Euler equations are solved
               if constexpr (CC::InviscidExchangeActive()) {
                 double const c =
-                    active_equations == EquationSet::GammaModel
+                    batched_speed_of_sound
+                        ? speed_of_sound[i - CC::FICX()][j - CC::FICY()]
+                                        [k - CC::FICZ()]
+                    : active_equations == EquationSet::GammaModel
                         ? GammaModelStiffenedGas::CalculateSpeedOfSound(
                               prime_states[PrimeState::Density][i][j][k],
                               prime_states[PrimeState::Pressure][i][j][k],
@@ -1859,6 +2014,7 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
                                   prime_states[PrimeState::Density][i][j][k],
                                   prime_states[PrimeState::Pressure][i][j][k]);
 
+                std::array<double, DTI(CC::DIM())> velocity_plus_sound;
                 for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
                   velocity_plus_sound[d] =
                       std::abs(prime_states[MF::AV()[d]][i][j][k]) + c;
@@ -1981,11 +2137,31 @@ double ModularAlgorithmAssembler::ComputeTimestepSize() const {
     }
   }
 
-  double global_min_dt;
   // NH 2016-10-28 dt_in_finest_level needs to be the GLOBAL minimum of the
-  // computed values
-  MPI_Allreduce(&local_dt_on_finest_level, &global_min_dt, 1, MPI_DOUBLE,
+  // computed values. The control commands piggyback on the reduction: rank
+  // zero contributes them, all other ranks the neutral element
+  double const neutral = std::numeric_limits<double>::max();
+  std::array<double, 3> local_values = {local_dt_on_finest_level, neutral,
+                                        neutral};
+  if (MpiUtilities::MyRankId() == 0) {
+    local_values[1] = (control_commands.abort_ ? 1.0 : 0.0) +
+                      (control_commands.write_restart_ ? 2.0 : 0.0) +
+                      (control_commands.write_output_ ? 4.0 : 0.0);
+    if (control_commands.output_interval_ > 0.0) {
+      local_values[2] = control_commands.output_interval_;
+    }
+  }
+  std::array<double, 3> global_values;
+  MPI_Allreduce(local_values.data(), global_values.data(), 3, MPI_DOUBLE,
                 MPI_MIN, MPI_COMM_WORLD);
+  double const global_min_dt = global_values[0];
+  unsigned int const command_flags =
+      static_cast<unsigned int>(global_values[1]);
+  control_commands.abort_ = command_flags & 1U;
+  control_commands.write_restart_ = command_flags & 2U;
+  control_commands.write_output_ = command_flags & 4U;
+  control_commands.output_interval_ =
+      global_values[2] < neutral ? global_values[2] : 0.0;
 
   logger_.LogMessage(
       "Timestep = " +
@@ -2044,6 +2220,9 @@ void ModularAlgorithmAssembler::LoadBalancing(
     std::vector<unsigned int> const updated_levels_descending,
     bool const force) {
   if (topology_.IsLoadBalancingNecessary() || force) {
+    if constexpr (CC::MeasuredLeafCostsActive()) {
+      topology_.CalibrateLeafCosts();
+    }
     // id - Current Rank - Future Rank
     std::vector<std::tuple<nid_t const, int const, int const>> const
         ids_rank_map = topology_.PrepareLoadBalancedTopology(
@@ -2055,6 +2234,8 @@ void ModularAlgorithmAssembler::LoadBalancing(
 
     MPI_Datatype const conservatives_datatype =
         communicator_.ConservativesDatatype();
+    MPI_Datatype const initial_conservatives_datatype =
+        communicator_.InitialConservativesDatatype();
     MPI_Datatype const boundary_jump_datatype =
         communicator_.JumpSurfaceDatatype();
 
@@ -2084,7 +2265,8 @@ void ModularAlgorithmAssembler::LoadBalancing(
             communicator_.Send(&block.GetAverageBuffer(), MF::ANOE(),
                                conservatives_datatype, future_rank, requests);
             communicator_.Send(&block.GetInitialBuffer(), MF::ANOE(),
-                               conservatives_datatype, future_rank, requests);
+                               initial_conservatives_datatype, future_rank,
+                               requests);
           }
           communicator_.Send(&block.GetBoundaryJumpFluxes(), CC::SIDES(),
                              boundary_jump_datatype, future_rank, requests);
@@ -2143,7 +2325,8 @@ void ModularAlgorithmAssembler::LoadBalancing(
             communicator_.Recv(&block.GetAverageBuffer(), MF::ANOE(),
                                conservatives_datatype, current_rank, requests);
             communicator_.Recv(&block.GetInitialBuffer(), MF::ANOE(),
-                               conservatives_datatype, current_rank, requests);
+                               initial_conservatives_datatype, current_rank,
+                               requests);
           }
           communicator_.Recv(&block.GetBoundaryJumpFluxes(), CC::SIDES(),
                              boundary_jump_datatype, current_rank, requests);
@@ -2314,8 +2497,9 @@ void ModularAlgorithmAssembler::Remesh(
       parent_levels.end());
   std::vector<nid_t> nodes_to_be_coarsened;
   std::vector<nid_t> nodes_needing_refinement;
-  DetermineRemeshingNodes(parent_levels, nodes_to_be_coarsened,
-                          nodes_needing_refinement);
+  RemeshingAnalyzer(topology_, tree_, multiresolution_, communicator_)
+      .DetermineRemeshingNodes(parent_levels, nodes_to_be_coarsened,
+                               nodes_needing_refinement);
 
   /* First we deal with the refinement. We keep the nodes to be coarsened until
    * after the halo update, which is need in the refinement process, to reduce
@@ -2413,123 +2597,6 @@ void ModularAlgorithmAssembler::Remesh(
   }
 }
 
-/**
- * @brief Gives the ids of nodes which may be coarsened or need refinement
- * according to the wavelet-analysis of \cite Harten 1993
- * @param parent_levels The levels of the parents, i.e. Children of these
- * parents might be coarsened.
- * @param remove_list A list of all ids of nodes which may be coarsened (
- * indirect return parameter ).
- * @param refine_list A list of all ids of nodes which must be refined (
- * indirect return parameter ).
- */
-void ModularAlgorithmAssembler::DetermineRemeshingNodes(
-    std::vector<unsigned int> const parent_levels,
-    std::vector<nid_t> &remove_list, std::vector<nid_t> &refine_list) const {
-
-  std::vector<RemeshIdentifier> remesh_list;
-  int const my_rank = communicator_.MyRankId();
-  /**
-   *  We need to check whether or not a node may be coarsened stay or even be
-   * refined. This is done by an analysis between the node and its parent. We
-   * only coarse or refine leaves and siblings may only be coarsened together.
-   *  In two-phase simulations further checks are needed as multi nodes may only
-   * be leaves if they reside on Lmax.
-   */
-  MPI_Datatype const conservatives_struct_ =
-      communicator_.ConservativesDatatype();
-  for (auto const &level_of_parent : parent_levels) {
-    for (auto const &parent_id : topology_.IdsOnLevel(level_of_parent)) {
-      bool const parent_on_my_rank = topology_.NodeIsOnRank(parent_id, my_rank);
-      std::vector<nid_t> const children = IdsOfChildren(parent_id);
-      for (auto const &child_id : children) {
-        if (topology_.NodeExists(child_id)) {
-          if (!topology_.IsNodeMultiPhase(
-                  child_id)) { // only single nodes may be coarsened or refined
-            if (topology_.NodeIsLeaf(child_id)) { // We only check leaves ( for
-                                                  // now, TODO-19 NH ).
-              bool const child_on_my_rank =
-                  topology_.NodeIsOnRank(child_id, my_rank);
-              if (parent_on_my_rank) {
-                if (child_on_my_rank) { // We hold parent and Child -> NO MPI
-
-                  remesh_list.emplace_back(
-                      multiresolution_.ChildNeedsRemeshing<CC::NFWA()>(
-                          tree_.GetNodeWithId(parent_id).GetPhaseByMaterial(
-                              topology_.SingleMaterialOfNode(child_id)),
-                          tree_.GetNodeWithId(child_id).GetSinglePhase(),
-                          child_id));
-
-                } else { // We hold parent but not the Child ( which exists ) ->
-                         // MPI_Receive
-
-                  // get material of child via topology ( since it is
-                  // single-phase taking front() of the material vector is valid
-                  // )
-                  Block received_child_block = Block();
-                  int const sender_rank = topology_.GetRankOfNode(child_id);
-                  MPI_Recv(&received_child_block.GetRightHandSideBuffer(),
-                           MF::ANOE(), conservatives_struct_, sender_rank, 0,
-                           MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-                  remesh_list.emplace_back(
-                      multiresolution_.ChildNeedsRemeshing<CC::NFWA()>(
-                          tree_.GetNodeWithId(parent_id).GetPhaseByMaterial(
-                              topology_.SingleMaterialOfNode(child_id)),
-                          received_child_block, child_id));
-                }
-              } else {
-                if (child_on_my_rank) { // We do NOT hold the parent, but do
-                                        // hold the Child -> MPI Send
-                  int receiver_rank = topology_.GetRankOfNode(parent_id);
-                  Block const &send_child =
-                      tree_.GetNodeWithId(child_id).GetSinglePhase();
-                  MPI_Send(&send_child.GetRightHandSideBuffer(), MF::ANOE(),
-                           conservatives_struct_, receiver_rank, 0,
-                           MPI_COMM_WORLD);
-                }
-              }
-            } else { // IF: IsLeaf
-              // Add a meshing-lock, i. e. neutral
-              if (parent_on_my_rank) { // Only the parent needs to fill this
-                                       // list.
-                remesh_list.emplace_back(RemeshIdentifier::Neutral);
-              }
-            } // ELSE: IsLeaf
-
-          } else { // Child is multi-phase
-            // In case the child is multi-phase we don't do anything
-            if (parent_on_my_rank) {
-              remesh_list.emplace_back(RemeshIdentifier::Neutral);
-            }
-          } // else : child is multi-phase
-        }   // child node exists
-      }     // children
-
-      // Now we have checked all siblings
-#ifndef PERFORMANCE
-      if (!remesh_list.empty() && remesh_list.size() != children.size()) {
-        throw std::logic_error("This must not happen");
-      }
-#endif
-      for (unsigned int i = 0; i < remesh_list.size(); ++i) {
-        if (remesh_list[i] == RemeshIdentifier::Refine) {
-          refine_list.emplace_back(children[i]);
-        }
-      }
-      // siblings may only be coarsened together. List can be empty if children
-      // do not exist.
-      if (!remesh_list.empty() && !topology_.IsNodeMultiPhase(parent_id) &&
-          std::all_of(remesh_list.begin(), remesh_list.end(),
-                      [](const RemeshIdentifier condition) {
-                        return condition == RemeshIdentifier::Coarse;
-                      })) {
-        remove_list.insert(remove_list.end(), children.begin(), children.end());
-      }
-      remesh_list.clear();
-    } // parents
-  }   // level_of_parent
-}
 
 /**
  * @brief Triggers the MPI consistent refinement of the node with the given id.
@@ -2616,6 +2683,19 @@ void ModularAlgorithmAssembler::LogPerformanceNumbers(
           number_of_leaves * CC::ICX() * CC::ICY() * CC::ICZ(), 5));
 }
 
+/**
+ * @brief Adds the time elapsed since the given start to the compute time spent
+ * on the local leaves in the current micro time step, which calibrates the leaf
+ * costs in the next load balancing.
+ * @param start_time The time at which the measured computation started.
+ */
+void ModularAlgorithmAssembler::AccumulateLeafComputeTimeSince(
+    double const start_time) {
+  if constexpr (CC::MeasuredLeafCostsActive()) {
+    leaf_compute_time_of_timestep_ += MPI_Wtime() - start_time;
+  }
+}
+
 void ModularAlgorithmAssembler::LogElapsedTimeSinceInProfileRuns(
     double const start_time, std::string const function_name) {
   if (DP::Profile()) {
@@ -88,6 +88,9 @@ class ModularAlgorithmAssembler {
 
   LogWriter &logger_;
 
+  // Compute time spent on the local leaves in the current micro time step
+  double leaf_compute_time_of_timestep_;
+
   void CreateNewSimulation(InitialCondition &initial_condition);
   void FinalizeSimulationRestart(double const restart_time);
 
@@ -98,9 +101,18 @@ class ModularAlgorithmAssembler {
                                double &debug_key) const;
   void LogElapsedTimeSinceInProfileRuns(double const start_time,
                                         std::string const message);
+  void AccumulateLeafComputeTimeSince(double const start_time);
 
   void ComputeRightHandSide(std::vector<unsigned int> const levels,
                             unsigned int const stage);
+  void ComputeRightHandSideOfLeaf(Node &node, unsigned int const stage);
+  void AdvanceToNextStageDuringHaloUpdate(
+      std::vector<unsigned int> const &levels_descending,
+      std::vector<unsigned int> const &levels_ascending,
+      unsigned int const stage);
+  void AdvanceLeavesToNextStage(
+      std::vector<std::reference_wrapper<Node>> const &leaves,
+      unsigned int const stage);
   void ComputeLevelsetRightHandSide(
       std::vector<std::reference_wrapper<Node>> const &nodes,
       unsigned int const stage);
@@ -113,7 +125,7 @@ class ModularAlgorithmAssembler {
   void JumpFluxAdjustment(
       std::vector<unsigned int> const finished_levels_descending) const;
 
-  double ComputeTimestepSize() const;
+  double ComputeTimestepSize(ControlCommands &control_commands) const;
 
   void ResetAllJumpBuffers() const;
   void
@@ -134,9 +146,6 @@ class ModularAlgorithmAssembler {
   SenseVanishedInterface(std::vector<unsigned int> const levels_descending);
 
   void Remesh(std::vector<unsigned int> const levels_to_update_ascending);
-  void DetermineRemeshingNodes(std::vector<unsigned int> const parent_levels,
-                               std::vector<nid_t> &remove_list,
-                               std::vector<nid_t> &refine_list) const;
 
   void RefineNode(nid_t const node_id);
 
@@ -297,16 +297,15 @@ void Multiresolution::Prediction(
  */
 template <>
 RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Linfinity>(
-    Block const &parent, Block const &child, nid_t const child_id) const {
+    Conservatives const &parent, Conservatives const &child,
+    nid_t const child_id) const {
 
   double predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
   double max_detail = 0.0;
 
   for (Equation const eq : MF::EWA()) {
-    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        child.GetRightHandSideBuffer(eq);
-    Multiresolution::Prediction(parent.GetRightHandSideBuffer(eq),
-                                predicted_values, child_id);
+    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] = child[eq];
+    Multiresolution::Prediction(parent[eq], predicted_values, child_id);
     for (unsigned int i = 0; i < CC::TCX(); ++i) {
       for (unsigned int j = 0; j < CC::TCY(); ++j) {
         for (unsigned int k = 0; k < CC::TCZ(); ++k) {
@@ -328,7 +327,8 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Linfinity>(
  */
 template <>
 RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Lone>(
-    Block const &parent, Block const &child, nid_t const child_id) const {
+    Conservatives const &parent, Conservatives const &child,
+    nid_t const child_id) const {
 
   double predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
   double max_detail = 0.0;
@@ -337,10 +337,8 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Lone>(
   double const one_number_of_cells = 1.0 / (CC::TCX() * CC::TCY() * CC::TCZ());
 
   for (Equation const eq : MF::EWA()) {
-    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        child.GetRightHandSideBuffer(eq);
-    Multiresolution::Prediction(parent.GetRightHandSideBuffer(eq),
-                                predicted_values, child_id);
+    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] = child[eq];
+    Multiresolution::Prediction(parent[eq], predicted_values, child_id);
     error_norm = 0.0;
     for (unsigned int i = 0; i < CC::TCX(); ++i) {
       for (unsigned int j = 0; j < CC::TCY(); ++j) {
@@ -366,7 +364,8 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Lone>(
  */
 template <>
 RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Ltwo>(
-    Block const &parent, Block const &child, nid_t const child_id) const {
+    Conservatives const &parent, Conservatives const &child,
+    nid_t const child_id) const {
 
   double predicted_values[CC::TCX()][CC::TCY()][CC::TCZ()];
   double max_detail = 0.0;
@@ -375,10 +374,8 @@ RemeshIdentifier Multiresolution::ChildNeedsRemeshing<Norm::Ltwo>(
   double const one_number_of_cells = 1.0 / (CC::TCX() * CC::TCY() * CC::TCZ());
 
   for (Equation const eq : MF::EWA()) {
-    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] =
-        child.GetRightHandSideBuffer(eq);
-    Multiresolution::Prediction(parent.GetRightHandSideBuffer(eq),
-                                predicted_values, child_id);
+    double const(&exact_values)[CC::TCX()][CC::TCY()][CC::TCZ()] = child[eq];
+    Multiresolution::Prediction(parent[eq], predicted_values, child_id);
     error_norm = 0.0;
     for (unsigned int i = 0; i < CC::TCX(); ++i) {
       for (unsigned int j = 0; j < CC::TCY(); ++j) {
@@ -79,7 +79,8 @@ public:
    * @tparam N The Norm used to decide whether the children should be coarsened.
    */
   template <Norm N>
-  RemeshIdentifier ChildNeedsRemeshing(Block const &parent, Block const &child,
+  RemeshIdentifier ChildNeedsRemeshing(Conservatives const &parent,
+                                       Conservatives const &child,
                                        nid_t const child_id) const;
 
   /**
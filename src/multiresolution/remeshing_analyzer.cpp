@@ -0,0 +1,279 @@
+//===--------------------- remeshing_analyzer.cpp -------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "multiresolution/remeshing_analyzer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <mpi.h>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "communication/mpi_utilities.h"
+#include "enums/remesh_identifier.h"
+#include "topology/id_information.h"
+
+namespace {
+// Fixed tags suffice, as at most one message of each kind is exchanged between
+// two ranks
+constexpr int parent_tag = 0;
+constexpr int decision_tag = 1;
+} // namespace
+
+/**
+ * @brief Default constructor.
+ * @param topology TopologyManager providing the global node information.
+ * @param tree Tree holding the local nodes.
+ * @param multiresolution Multiresolution object performing the wavelet
+ * analysis.
+ * @param communication_types Provider of the MPI datatype of the conservative
+ * buffers.
+ */
+RemeshingAnalyzer::RemeshingAnalyzer(
+    TopologyManager const &topology, Tree const &tree,
+    Multiresolution const &multiresolution,
+    CommunicationTypes const &communication_types)
+    : topology_(topology), tree_(tree), multiresolution_(multiresolution),
+      communication_types_(communication_types),
+      my_rank_(MpiUtilities::MyRankId()),
+      number_of_ranks_(MpiUtilities::NumberOfRanks()) {
+  /** Empty besides initializer list */
+}
+
+/**
+ * @brief Gives the ids of nodes which may be coarsened or need refinement
+ * according to the wavelet-analysis of \cite Harten 1993
+ * @param parent_levels The levels of the parents, i.e. Children of these
+ * parents might be coarsened.
+ * @param remove_list A list of all ids of nodes which may be coarsened (
+ * indirect return parameter ).
+ * @param refine_list A list of all ids of nodes which must be refined (
+ * indirect return parameter ).
+ */
+void RemeshingAnalyzer::DetermineRemeshingNodes(
+    std::vector<unsigned int> const &parent_levels,
+    std::vector<nid_t> &remove_list, std::vector<nid_t> &refine_list) const {
+
+  /**
+   *  We need to check whether or not a node may be coarsened stay or even be
+   * refined. This is done by an analysis between the node and its parent. We
+   * only coarse or refine leaves and siblings may only be coarsened together.
+   *  In two-phase simulations further checks are needed as multi nodes may only
+   * be leaves if they reside on Lmax.
+   */
+  std::vector<nid_t> local_parents;
+  std::unordered_map<nid_t, RemeshIdentifier> remesh_decisions;
+  // (parent id, child id) pairs which are both held by this rank
+  std::vector<std::pair<nid_t, nid_t>> local_analyses;
+  // Per partner rank: (parent id, material) of the parent blocks to be
+  // exchanged. A multi-phase parent may be needed for several materials
+  std::vector<std::vector<std::pair<nid_t, MaterialName>>> parents_to_send(
+      number_of_ranks_);
+  std::vector<std::vector<std::pair<nid_t, MaterialName>>> parents_to_receive(
+      number_of_ranks_);
+  // Per partner rank: (child id, index of the received parent) of the local
+  // children analyzed for the partner and the ids of the children analyzed by
+  // the partner
+  std::vector<std::vector<std::pair<nid_t, std::size_t>>> children_analyzed_here(
+      number_of_ranks_);
+  std::vector<std::vector<nid_t>> children_analyzed_remotely(number_of_ranks_);
+
+  // Entries of one parent are appended consecutively, hence only the tail needs
+  // to be searched for duplicates
+  auto const index_of_parent =
+      [](std::vector<std::pair<nid_t, MaterialName>> &parents,
+         nid_t const parent_id, MaterialName const material) {
+        for (std::size_t index = parents.size();
+             index > 0 && parents[index - 1].first == parent_id; --index) {
+          if (parents[index - 1].second == material) {
+            return index - 1;
+          }
+        }
+        parents.emplace_back(parent_id, material);
+        return parents.size() - 1;
+      };
+
+  for (auto const &level_of_parent : parent_levels) {
+    // The order of the parents must be identical on all ranks
+    std::vector<nid_t> parent_ids = topology_.IdsOnLevel(level_of_parent);
+    std::sort(parent_ids.begin(), parent_ids.end());
+    for (auto const &parent_id : parent_ids) {
+      bool const parent_on_my_rank =
+          topology_.NodeIsOnRank(parent_id, my_rank_);
+      if (parent_on_my_rank) {
+        local_parents.push_back(parent_id);
+      }
+      for (auto const &child_id : IdsOfChildren(parent_id)) {
+        if (!topology_.NodeExists(child_id)) {
+          continue;
+        }
+        // Only single leaves may be coarsened or refined ( for now, TODO-19 NH
+        // ). Others get a meshing-lock, i. e. neutral
+        if (topology_.IsNodeMultiPhase(child_id) ||
+            !topology_.NodeIsLeaf(child_id)) {
+          if (parent_on_my_rank) { // Only the parent needs the decision.
+            remesh_decisions[child_id] = RemeshIdentifier::Neutral;
+          }
+          continue;
+        }
+        int const rank_of_child = topology_.GetRankOfNode(child_id);
+        if (parent_on_my_rank) {
+          if (rank_of_child == my_rank_) { // We hold parent and Child -> NO MPI
+            local_analyses.emplace_back(parent_id, child_id);
+          } else { // We hold parent but not the Child -> Send parent
+            index_of_parent(parents_to_send[rank_of_child], parent_id,
+                            topology_.SingleMaterialOfNode(child_id));
+            children_analyzed_remotely[rank_of_child].push_back(child_id);
+          }
+        } else if (rank_of_child == my_rank_) { // We do NOT hold the parent, but
+                                               // do hold the Child -> Receive
+                                               // parent
+          int const rank_of_parent = topology_.GetRankOfNode(parent_id);
+          std::size_t const parent_index =
+              index_of_parent(parents_to_receive[rank_of_parent], parent_id,
+                              topology_.SingleMaterialOfNode(child_id));
+          children_analyzed_here[rank_of_parent].emplace_back(child_id,
+                                                              parent_index);
+        }
+      } // children
+    }   // parents
+  }     // level_of_parent
+
+  // Pre-post all receives and send the parents aggregated per partner rank
+  MPI_Datatype const conservatives_datatype =
+      communication_types_.ConservativesDatatype();
+  std::vector<std::vector<Conservatives>> received_parents(number_of_ranks_);
+  std::vector<std::vector<Conservatives>> sent_parents(number_of_ranks_);
+  std::vector<std::vector<int>> received_decisions(number_of_ranks_);
+  std::vector<std::vector<int>> sent_decisions(number_of_ranks_);
+  std::vector<MPI_Request> parent_requests;
+  std::vector<MPI_Request> decision_requests;
+  for (int rank = 0; rank < number_of_ranks_; ++rank) {
+    if (!parents_to_receive[rank].empty()) {
+      received_parents[rank].resize(parents_to_receive[rank].size());
+      parent_requests.push_back(MPI_Request());
+      MPI_Irecv(received_parents[rank].data(),
+                received_parents[rank].size() * MF::ANOE(),
+                conservatives_datatype, rank, parent_tag, MPI_COMM_WORLD,
+                &parent_requests.back());
+    }
+    if (!children_analyzed_remotely[rank].empty()) {
+      received_decisions[rank].resize(children_analyzed_remotely[rank].size());
+      decision_requests.push_back(MPI_Request());
+      MPI_Irecv(received_decisions[rank].data(),
+                received_decisions[rank].size(), MPI_INT, rank, decision_tag,
+                MPI_COMM_WORLD, &decision_requests.back());
+    }
+    if (!parents_to_send[rank].empty()) {
+      sent_parents[rank].reserve(parents_to_send[rank].size());
+      for (auto const &[parent_id, material] : parents_to_send[rank]) {
+        sent_parents[rank].push_back(tree_.GetNodeWithId(parent_id)
+                                         .GetPhaseByMaterial(material)
+                                         .GetRightHandSideBuffer());
+      }
+      parent_requests.push_back(MPI_Request());
+      MPI_Isend(sent_parents[rank].data(),
+                sent_parents[rank].size() * MF::ANOE(), conservatives_datatype,
+                rank, parent_tag, MPI_COMM_WORLD, &parent_requests.back());
+    }
+  }
+
+  // The rank-local analyses overlap with the communication
+  for (auto const &[parent_id, child_id] : local_analyses) {
+    remesh_decisions[child_id] =
+        multiresolution_.ChildNeedsRemeshing<CC::NFWA()>(
+            tree_.GetNodeWithId(parent_id)
+                .GetPhaseByMaterial(topology_.SingleMaterialOfNode(child_id))
+                .GetRightHandSideBuffer(),
+            tree_.GetNodeWithId(child_id)
+                .GetSinglePhase()
+                .GetRightHandSideBuffer(),
+            child_id);
+  }
+
+  MPI_Waitall(parent_requests.size(), parent_requests.data(),
+              MPI_STATUSES_IGNORE);
+
+  // Analyze the local children of remote parents and return the decisions
+  for (int rank = 0; rank < number_of_ranks_; ++rank) {
+    if (children_analyzed_here[rank].empty()) {
+      continue;
+    }
+    sent_decisions[rank].reserve(children_analyzed_here[rank].size());
+    for (auto const &[child_id, parent_index] : children_analyzed_here[rank]) {
+      sent_decisions[rank].push_back(static_cast<int>(
+          multiresolution_.ChildNeedsRemeshing<CC::NFWA()>(
+              received_parents[rank][parent_index],
+              tree_.GetNodeWithId(child_id)
+                  .GetSinglePhase()
+                  .GetRightHandSideBuffer(),
+              child_id)));
+    }
+    decision_requests.push_back(MPI_Request());
+    MPI_Isend(sent_decisions[rank].data(), sent_decisions[rank].size(),
+              MPI_INT, rank, decision_tag, MPI_COMM_WORLD,
+              &decision_requests.back());
+  }
+
+  MPI_Waitall(decision_requests.size(), decision_requests.data(),
+              MPI_STATUSES_IGNORE);
+
+  for (int rank = 0; rank < number_of_ranks_; ++rank) {
+    for (std::size_t i = 0; i < children_analyzed_remotely[rank].size(); ++i) {
+      remesh_decisions[children_analyzed_remotely[rank][i]] =
+          static_cast<RemeshIdentifier>(received_decisions[rank][i]);
+    }
+  }
+
+  std::vector<RemeshIdentifier> remesh_list;
+  for (auto const &parent_id : local_parents) {
+    std::vector<nid_t> const children = IdsOfChildren(parent_id);
+    for (auto const &child_id : children) {
+      auto const decision = remesh_decisions.find(child_id);
+      if (decision != remesh_decisions.end()) {
+        remesh_list.push_back(decision->second);
+      }
+    }
+
+    // Now we have checked all siblings
+#ifndef PERFORMANCE
+    if (!remesh_list.empty() && remesh_list.size() != children.size()) {
+      throw std::logic_error("This must not happen");
+    }
+#endif
+    for (unsigned int i = 0; i < remesh_list.size(); ++i) {
+      if (remesh_list[i] == RemeshIdentifier::Refine) {
+        refine_list.emplace_back(children[i]);
+      }
+    }
+    // siblings may only be coarsened together. List can be empty if children
+    // do not exist.
+    if (!remesh_list.empty() && !topology_.IsNodeMultiPhase(parent_id) &&
+        std::all_of(remesh_list.begin(), remesh_list.end(),
+                    [](const RemeshIdentifier condition) {
+                      return condition == RemeshIdentifier::Coarse;
+                    })) {
+      remove_list.insert(remove_list.end(), children.begin(), children.end());
+    }
+    remesh_list.clear();
+  } // parents
+}
@@ -0,0 +1,69 @@
+//===---------------------- remeshing_analyzer.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef REMESHING_ANALYZER_H
+#define REMESHING_ANALYZER_H
+
+#include "communication/communication_types.h"
+#include "multiresolution/multiresolution.h"
+#include "topology/node_id_type.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+#include <vector>
+
+/**
+ * @brief Determines the nodes to be coarsened or refined by the wavelet
+ * analysis between children and their parents. The analysis of a child is done
+ * on the rank holding the child. Parents of children on other ranks are sent
+ * once per partner rank (all parent levels in one message) and only the
+ * remeshing decisions are sent back to the rank of the parent. All messages are
+ * non-blocking.
+ * @note All ranks walk the parents in ascending id order, hence the packing
+ * order on the sender matches the unpacking order on the receiver without
+ * per-message tags.
+ */
+class RemeshingAnalyzer {
+
+  TopologyManager const &topology_;
+  Tree const &tree_;
+  Multiresolution const &multiresolution_;
+  CommunicationTypes const &communication_types_;
+
+  int const my_rank_;
+  int const number_of_ranks_;
+
+public:
+  RemeshingAnalyzer() = delete;
+  explicit RemeshingAnalyzer(TopologyManager const &topology, Tree const &tree,
+                             Multiresolution const &multiresolution,
+                             CommunicationTypes const &communication_types);
+  ~RemeshingAnalyzer() = default;
+  RemeshingAnalyzer(RemeshingAnalyzer const &) = delete;
+  RemeshingAnalyzer &operator=(RemeshingAnalyzer const &) = delete;
+  RemeshingAnalyzer(RemeshingAnalyzer &&) = delete;
+  RemeshingAnalyzer &operator=(RemeshingAnalyzer &&) = delete;
+
+  void DetermineRemeshingNodes(std::vector<unsigned int> const &parent_levels,
+                               std::vector<nid_t> &remove_list,
+                               std::vector<nid_t> &refine_list) const;
+};
+
+#endif // REMESHING_ANALYZER_H
@@ -60,6 +60,108 @@ class PrimeStateHandler {
         conservatives_container, prime_states_container);
   }
 
+  /**
+   * @brief Converts prime states to conservatives for all cells of the given
+   * buffers. Each equation of state function is evaluated once for the whole
+   * buffer instead of once per cell.
+   * @param material Material identifier of the material under consideration.
+   * @param prime_states The input PrimeStates buffer.
+   * @param conservatives The output Conservatives buffer.
+   * @note Not usable for the gamma model, where the equation of state is
+   * given by the prime states themselves.
+   */
+  void DoConvertPrimeStatesToConservativesBatch(
+      MaterialName const &material, PrimeStates const &prime_states,
+      Conservatives &conservatives) const {
+    constexpr unsigned int number_of_cells = CC::TCX() * CC::TCY() * CC::TCZ();
+    double const *const density = &prime_states[PrimeState::Density][0][0][0];
+    if constexpr (MF::IsEquationActive(Equation::Mass)) {
+      double *const mass = &conservatives[Equation::Mass][0][0][0];
+      for (unsigned int c = 0; c < number_of_cells; ++c) {
+        mass[c] = density[c];
+      }
+    }
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      double const *const velocity = &prime_states[MF::AV()[d]][0][0][0];
+      double *const momentum = &conservatives[MF::AME()[d]][0][0][0];
+      for (unsigned int c = 0; c < number_of_cells; ++c) {
+        momentum[c] = velocity[c] * density[c];
+      }
+    }
+    if constexpr (MF::IsEquationActive(Equation::Energy) &&
+                  MF::IsPrimeStateActive(PrimeState::Pressure)) {
+      material_manager_.GetMaterial(material).GetEquationOfState().EnergyBatch(
+          number_of_cells, density,
+          &prime_states[PrimeState::VelocityX][0][0][0],
+          CC::DIM() != Dimension::One
+              ? &prime_states[PrimeState::VelocityY][0][0][0]
+              : nullptr,
+          CC::DIM() == Dimension::Three
+              ? &prime_states[PrimeState::VelocityZ][0][0][0]
+              : nullptr,
+          &prime_states[PrimeState::Pressure][0][0][0],
+          &conservatives[Equation::Energy][0][0][0]);
+    }
+  }
+
+  /**
+   * @brief Converts conservatives to prime states for all cells of the given
+   * buffers. Each equation of state function is evaluated once for the whole
+   * buffer instead of once per cell.
+   * @param material Material identifier of the material under consideration.
+   * @param conservatives The input Conservatives buffer.
+   * @param prime_states The output PrimeStates buffer.
+   * @note Not usable for the gamma model, where the equation of state is
+   * given by the prime states themselves.
+   */
+  void DoConvertConservativesToPrimeStatesBatch(
+      MaterialName const &material, Conservatives const &conservatives,
+      PrimeStates &prime_states) const {
+    constexpr unsigned int number_of_cells = CC::TCX() * CC::TCY() * CC::TCZ();
+    EquationOfState const &eos =
+        material_manager_.GetMaterial(material).GetEquationOfState();
+    double const *const mass = &conservatives[Equation::Mass][0][0][0];
+    double const *const momentum_x =
+        &conservatives[Equation::MomentumX][0][0][0];
+    double const *const momentum_y =
+        CC::DIM() != Dimension::One
+            ? &conservatives[Equation::MomentumY][0][0][0]
+            : nullptr;
+    double const *const momentum_z =
+        CC::DIM() == Dimension::Three
+            ? &conservatives[Equation::MomentumZ][0][0][0]
+            : nullptr;
+    double const *const energy =
+        MF::IsEquationActive(Equation::Energy)
+            ? &conservatives[Equation::Energy][0][0][0]
+            : nullptr;
+
+    if constexpr (MF::IsPrimeStateActive(PrimeState::Density)) {
+      double *const density = &prime_states[PrimeState::Density][0][0][0];
+      for (unsigned int c = 0; c < number_of_cells; ++c) {
+        density[c] = mass[c];
+      }
+    }
+    for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+      double const *const momentum = &conservatives[MF::AME()[d]][0][0][0];
+      double *const velocity = &prime_states[MF::AV()[d]][0][0][0];
+      for (unsigned int c = 0; c < number_of_cells; ++c) {
+        velocity[c] = momentum[c] * (1.0 / mass[c]);
+      }
+    }
+    if constexpr (MF::IsPrimeStateActive(PrimeState::Pressure)) {
+      eos.PressureBatch(number_of_cells, mass, momentum_x, momentum_y,
+                        momentum_z, energy,
+                        &prime_states[PrimeState::Pressure][0][0][0]);
+    }
+    if constexpr (MF::IsPrimeStateActive(PrimeState::Temperature) &&
+                  MF::IsEquationActive(Equation::Energy)) {
+      eos.TemperatureBatch(number_of_cells, mass, momentum_x, momentum_y,
+                           momentum_z, energy,
+                           &prime_states[PrimeState::Temperature][0][0][0]);
+    }
+  }
+
 public:
   explicit PrimeStateHandler(MaterialManager const &material_manager)
       : material_manager_(material_manager) {}
@@ -79,13 +181,18 @@ public:
   void ConvertPrimeStatesToConservatives(MaterialName const &material,
                                          PrimeStates const &prime_states,
                                          Conservatives &conservatives) const {
-    for (unsigned int i = 0; i < CC::TCX(); ++i) {
-      for (unsigned int j = 0; j < CC::TCY(); ++j) {
-        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-          ConvertPrimeStatesToConservatives(material, prime_states,
-                                            conservatives, i, j, k);
+    if constexpr (active_equations == EquationSet::GammaModel) {
+      for (unsigned int i = 0; i < CC::TCX(); ++i) {
+        for (unsigned int j = 0; j < CC::TCY(); ++j) {
+          for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+            ConvertPrimeStatesToConservatives(material, prime_states,
+                                              conservatives, i, j, k);
+          }
         }
       }
+    } else {
+      DoConvertPrimeStatesToConservativesBatch(material, prime_states,
+                                               conservatives);
     }
   }
 
@@ -141,13 +248,18 @@ public:
   void ConvertConservativesToPrimeStates(MaterialName const &material,
                                          Conservatives const &conservatives,
                                          PrimeStates &prime_states) const {
-    for (unsigned int i = 0; i < CC::TCX(); ++i) {
-      for (unsigned int j = 0; j < CC::TCY(); ++j) {
-        for (unsigned int k = 0; k < CC::TCZ(); ++k) {
-          ConvertConservativesToPrimeStates(material, conservatives,
-                                            prime_states, i, j, k);
+    if constexpr (active_equations == EquationSet::GammaModel) {
+      for (unsigned int i = 0; i < CC::TCX(); ++i) {
+        for (unsigned int j = 0; j < CC::TCY(); ++j) {
+          for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+            ConvertConservativesToPrimeStates(material, conservatives,
+                                              prime_states, i, j, k);
+          }
         }
       }
+    } else {
+      DoConvertConservativesToPrimeStatesBatch(material, conservatives,
+                                               prime_states);
     }
   }
 
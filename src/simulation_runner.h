@@ -121,9 +121,9 @@ void Run(InputReader const &input_reader) {
   // Instance to restart simulation from snapshot and write output files (cannot
   // be const due to vector eraseing inside)
   OutputWriter const output_writer(Instantiation::InstantiateOutputWriter(
-      topology_manager, tree, material_manager, unit_handler));
+      input_reader, topology_manager, tree, material_manager, unit_handler));
   RestartManager const restart_manager(Instantiation::InstantiateRestartManager(
-      topology_manager, tree, unit_handler));
+      input_reader, topology_manager, tree, unit_handler));
   InputOutputManager input_output_manager(
       Instantiation::InstantiateInputOutputManager(
           input_reader, output_writer, restart_manager, unit_handler,
@@ -22,6 +22,7 @@
 #ifndef CONVECTIVE_TERM_SOLVER_SETUP_H
 #define CONVECTIVE_TERM_SOLVER_SETUP_H
 
+#include "solvers/convective_term_contributions/finite_volume_pencil_scheme.h"
 #include "solvers/convective_term_contributions/finite_volume_scheme.h"
 #include "solvers/convective_term_contributions/flux_splitting_scheme.h"
 #include "user_specifications/riemann_solver_settings.h"
@@ -53,6 +54,12 @@ template <> struct Concretize<ConvectiveTermSolvers::FluxSplitting> {
 template <> struct Concretize<ConvectiveTermSolvers::FiniteVolume> {
   typedef FiniteVolumeScheme type;
 };
+/**
+ * @brief See generic implementation.
+ */
+template <> struct Concretize<ConvectiveTermSolvers::FiniteVolumePencil> {
+  typedef FiniteVolumePencilScheme type;
+};
 
 } // namespace ConvectiveTermSolverSetup
 
@@ -0,0 +1,380 @@
+//===----------------- finite_volume_pencil_scheme.cpp --------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#include "solvers/convective_term_contributions/finite_volume_pencil_scheme.h"
+
+#include <array>
+#include <limits>
+
+#include "solvers/convective_term_contributions/riemann_solvers/pencil_face_states.h"
+#include "stencils/stencil_utilities.h"
+
+namespace {
+/**
+ * @brief Gives the total number of cells of a pencil in the given direction.
+ * @tparam DIR Direction of the pencil.
+ */
+template <Direction DIR> constexpr unsigned int PencilLength() {
+  return DIR == Direction::X   ? CC::TCX()
+         : DIR == Direction::Y ? CC::TCY()
+                               : CC::TCZ();
+}
+
+/**
+ * @brief Gives the number of cell faces of a pencil in the given direction for
+ * which fluxes are computed.
+ * @tparam DIR Direction of the pencil.
+ */
+template <Direction DIR> constexpr unsigned int NumberOfPencilFaces() {
+  return (DIR == Direction::X   ? CC::ICX()
+          : DIR == Direction::Y ? CC::ICY()
+                                : CC::ICZ()) +
+         1;
+}
+
+/**
+ * @brief Gives the index of the first internal cell of a pencil in the given
+ * direction.
+ * @tparam DIR Direction of the pencil.
+ */
+template <Direction DIR> constexpr unsigned int FirstInternalPencilCell() {
+  return DIR == Direction::X   ? CC::FICX()
+         : DIR == Direction::Y ? CC::FICY()
+                               : CC::FICZ();
+}
+
+/**
+ * @brief Gives the block indices of a cell in a pencil.
+ * @param m Index of the cell along the pencil.
+ * @param a,b Indices of the pencil in the two other directions (ordered x, y,
+ * z).
+ * @return Indices of the cell in the block.
+ * @tparam DIR Direction of the pencil.
+ */
+template <Direction DIR>
+constexpr std::array<unsigned int, 3> PencilCellIndices(unsigned int const m,
+                                                        unsigned int const a,
+                                                        unsigned int const b) {
+  if constexpr (DIR == Direction::X) {
+    return {m, a, b};
+  } else if constexpr (DIR == Direction::Y) {
+    return {a, m, b};
+  } else {
+    return {a, b, m};
+  }
+}
+
+/**
+ * @brief Completes the reconstructed states of a pencil with the quantities
+ * required by the Riemann solver and flags the faces with invalid states (e.g.
+ * due to the ghost fluid method). Invalid faces get a harmless dummy state.
+ * @param eos Equation of state of the phase under consideration.
+ * @param reconstructed_primes The reconstructed prime states (only used for
+ * primitive reconstruction).
+ * @param states The face states, holding the reconstructed conservatives for
+ * conservative reconstruction (indirect return).
+ * @param valid_faces Flags whether the face has a valid state. Must be
+ * initialized, invalid faces remain invalid (indirect return).
+ * @tparam DIR Direction of the pencil.
+ * @tparam V Number of reconstructed variables.
+ * @tparam N Number of faces in the pencil.
+ * @note Hotpath function.
+ */
+template <Direction DIR, unsigned int V, unsigned int N>
+void CompletePencilFaceStates(
+    EquationOfState const &eos,
+    [[maybe_unused]] double const (&reconstructed_primes)[V][N],
+    PencilFaceStates<N> &states, bool (&valid_faces)[N]) {
+
+  constexpr unsigned int mass_index = ETI(Equation::Mass);
+  constexpr unsigned int energy_index = ETI(Equation::Energy);
+  constexpr unsigned int principal_momentum_index = ETI(MF::AME()[DTI(DIR)]);
+  constexpr unsigned int principal_velocity_index = PTI(MF::AV()[DTI(DIR)]);
+  double const B = eos.B();
+
+  /** Mass and momenta, invalid densities (e.g. due to the ghost fluid method)
+   * are replaced by a dummy state to allow the batched evaluation of the
+   * equation of state for the whole pencil */
+  for (unsigned int f = 0; f < N; ++f) {
+    if constexpr (state_reconstruction_type ==
+                  StateReconstructionType::Primitive) {
+      double const density = reconstructed_primes[PTI(PrimeState::Density)][f];
+      states.conservatives_[mass_index][f] = density;
+      for (unsigned int d = 0; d < DTI(CC::DIM()); ++d) {
+        states.conservatives_[ETI(MF::AME()[d])][f] =
+            reconstructed_primes[PTI(MF::AV()[d])][f] * density;
+      }
+      states.pressure_[f] = reconstructed_primes[PTI(PrimeState::Pressure)][f];
+      states.velocity_[f] = reconstructed_primes[principal_velocity_index][f];
+    }
+    valid_faces[f] =
+        valid_faces[f] && states.conservatives_[mass_index][f] >
+                              std::numeric_limits<double>::epsilon();
+    if (!valid_faces[f]) {
+      for (unsigned int e = 0; e < MF::ANOE(); ++e) {
+        states.conservatives_[e][f] = 0.0;
+      }
+      states.conservatives_[mass_index][f] = 1.0;
+      states.conservatives_[energy_index][f] = 1.0;
+      states.pressure_[f] = 1.0;
+      states.velocity_[f] = 0.0;
+    }
+  }
+
+  /** Energy or pressure of the whole pencil in one equation of state call */
+  if constexpr (state_reconstruction_type ==
+                StateReconstructionType::Primitive) {
+    // velocities of invalid faces are irrelevant since their energy is reset
+    eos.EnergyBatch(N, states.conservatives_[mass_index],
+                    reconstructed_primes[PTI(PrimeState::VelocityX)],
+                    CC::DIM() != Dimension::One
+                        ? reconstructed_primes[PTI(PrimeState::VelocityY)]
+                        : nullptr,
+                    CC::DIM() == Dimension::Three
+                        ? reconstructed_primes[PTI(PrimeState::VelocityZ)]
+                        : nullptr,
+                    states.pressure_, states.conservatives_[energy_index]);
+  } else {
+    eos.PressureBatch(N, states.conservatives_[mass_index],
+                      states.conservatives_[ETI(Equation::MomentumX)],
+                      CC::DIM() != Dimension::One
+                          ? states.conservatives_[ETI(Equation::MomentumY)]
+                          : nullptr,
+                      CC::DIM() == Dimension::Three
+                          ? states.conservatives_[ETI(Equation::MomentumZ)]
+                          : nullptr,
+                      states.conservatives_[energy_index], states.pressure_);
+    for (unsigned int f = 0; f < N; ++f) {
+      states.velocity_[f] = states.conservatives_[principal_momentum_index][f] *
+                            (1.0 / states.conservatives_[mass_index][f]);
+    }
+  }
+  for (unsigned int f = 0; f < N; ++f) {
+    valid_faces[f] = valid_faces[f] && states.pressure_[f] > -B;
+    if (!valid_faces[f]) {
+      states.conservatives_[mass_index][f] = 1.0;
+      states.pressure_[f] = 1.0;
+    }
+  }
+
+  /** Speed of sound of the whole pencil in one equation of state call */
+  eos.SpeedOfSoundBatch(N, states.conservatives_[mass_index], states.pressure_,
+                        states.speed_of_sound_);
+
+  /** Dummy state at rest for invalid faces, their fluxes are discarded */
+  for (unsigned int f = 0; f < N; ++f) {
+    if (!valid_faces[f]) {
+      for (unsigned int e = 0; e < MF::ANOE(); ++e) {
+        states.conservatives_[e][f] = 0.0;
+      }
+      states.conservatives_[mass_index][f] = 1.0;
+      states.conservatives_[energy_index][f] = 1.0;
+      states.pressure_[f] = 1.0;
+      states.velocity_[f] = 0.0;
+      states.speed_of_sound_[f] = 1.0;
+    }
+  }
+}
+} // namespace
+
+static_assert(FiniteVolumePencilScheme::IsApplicable() ||
+                  convective_term_solver !=
+                      ConvectiveTermSolvers::FiniteVolumePencil,
+              "The finite-volume pencil scheme is only implemented for the "
+              "Euler and Navier-Stokes equations with conservative or "
+              "primitive state reconstruction and the HLLC or HLL Riemann "
+              "solver!");
+
+/**
+ * @brief Standard constructor using an already existing MaterialManager and
+ * EigenDecomposition object.
+ * @param material_manager .
+ * @param eigendecomposition_calculator .
+ */
+FiniteVolumePencilScheme::FiniteVolumePencilScheme(
+    MaterialManager const &material_manager,
+    EigenDecomposition const &eigendecomposition_calculator)
+    : ConvectiveTermSolver(material_manager, eigendecomposition_calculator),
+      riemann_solver_(material_manager, eigendecomposition_calculator_) {
+  /* Empty besides initializer list*/
+}
+
+/**
+ * @brief Solving the convective term of the system. Using dimension splitting
+ * for fluxes in x, y, and z- direction. Also See base class.
+ * @note Hotpath function.
+ */
+void FiniteVolumePencilScheme::UpdateImplementation(
+    std::pair<MaterialName const, Block> const &mat_block,
+    double const cell_size,
+    double (&fluxes_x)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+    double (&fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+    double (&fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+    double (&)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
+
+  // The scheme is only instantiated for supported settings (see static_assert)
+  if constexpr (FiniteVolumePencilScheme::IsApplicable()) {
+    ComputeFluxes<Direction::X>(mat_block, fluxes_x, cell_size);
+    if constexpr (CC::DIM() != Dimension::One) {
+      ComputeFluxes<Direction::Y>(mat_block, fluxes_y, cell_size);
+    }
+    if constexpr (CC::DIM() == Dimension::Three) {
+      ComputeFluxes<Direction::Z>(mat_block, fluxes_z, cell_size);
+    }
+  } else {
+    (void)mat_block;
+    (void)cell_size;
+    (void)fluxes_x;
+    (void)fluxes_y;
+    (void)fluxes_z;
+  }
+}
+
+/**
+ * @brief Computes the convective cell face fluxes pencil by pencil. For each
+ * pencil, the cell data is gathered into contiguous buffers, the states are
+ * reconstructed at all faces and the Riemann problems of all faces are solved.
+ * @param mat_block The block and material information of the phase under
+ * consideration.
+ * @param fluxes Reference to an array which is filled with the computed fluxes
+ * (indirect return parameter).
+ * @param cell_size .
+ * @tparam DIR Indicates which spatial direction is to be computed.
+ * @note Hotpath function.
+ */
+template <Direction DIR>
+void FiniteVolumePencilScheme::ComputeFluxes(
+    std::pair<MaterialName const, Block> const &mat_block,
+    double (&fluxes)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+    double const cell_size) const {
+
+  using ReconstructionStencil =
+      typename ReconstructionStencilSetup::Concretize<
+          reconstruction_stencil>::type;
+  constexpr bool reconstruct_primes =
+      state_reconstruction_type == StateReconstructionType::Primitive;
+  constexpr unsigned int number_of_variables =
+      reconstruct_primes ? MF::ANOP() : MF::ANOE();
+
+  constexpr unsigned int pencil_length = PencilLength<DIR>();
+  constexpr unsigned int number_of_faces = NumberOfPencilFaces<DIR>();
+  // The first face lies between the last halo cell and the first internal cell
+  constexpr unsigned int first_stencil_cell =
+      FirstInternalPencilCell<DIR>() - 1 -
+      ReconstructionStencil::DownstreamStencilSize();
+
+  // Ranges of the pencils in the two other directions (ordered x, y, z)
+  constexpr unsigned int a_start =
+      DIR == Direction::X ? CC::FICY() : CC::FICX();
+  constexpr unsigned int a_end = DIR == Direction::X ? CC::LICY() : CC::LICX();
+  constexpr unsigned int b_start =
+      DIR == Direction::Z ? CC::FICY() : CC::FICZ();
+  constexpr unsigned int b_end = DIR == Direction::Z ? CC::LICY() : CC::LICZ();
+
+  constexpr int total_to_internal_offset_x = CC::FICX() - 1;
+  constexpr int total_to_internal_offset_y =
+      CC::DIM() != Dimension::One ? static_cast<int>(CC::FICY()) - 1 : -1;
+  constexpr int total_to_internal_offset_z =
+      CC::DIM() == Dimension::Three ? static_cast<int>(CC::FICZ()) - 1 : -1;
+
+  // Access the pair's elements directly.
+  auto const &[material, block] = mat_block;
+  EquationOfState const &eos =
+      material_manager_.GetMaterial(material).GetEquationOfState();
+
+  // Contiguous pencil buffers
+  double pencil[number_of_variables][pencil_length];
+  double reconstructed_left[number_of_variables][number_of_faces];
+  double reconstructed_right[number_of_variables][number_of_faces];
+  PencilFaceStates<number_of_faces> states_left;
+  PencilFaceStates<number_of_faces> states_right;
+  bool valid_faces[number_of_faces];
+  double face_fluxes[MF::ANOE()][number_of_faces];
+
+  for (unsigned int a = a_start; a <= a_end; ++a) {
+    for (unsigned int b = b_start; b <= b_end; ++b) {
+
+      /** Gather the pencil data */
+      for (unsigned int n = 0; n < number_of_variables; ++n) {
+        double const(&buffer)[CC::TCX()][CC::TCY()][CC::TCZ()] =
+            reconstruct_primes ? block.GetPrimeStateBuffer(MF::ASOP()[n])
+                               : block.GetAverageBuffer(MF::ASOE()[n]);
+        for (unsigned int m = 0; m < pencil_length; ++m) {
+          auto const [i, j, k] = PencilCellIndices<DIR>(m, a, b);
+          pencil[n][m] = buffer[i][j][k];
+        }
+      }
+
+      /** Reconstruct the states at all faces */
+      for (unsigned int n = 0; n < number_of_variables; ++n) {
+        for (unsigned int f = 0; f < number_of_faces; ++f) {
+          std::array<double, ReconstructionStencil::StencilSize()>
+              reconstruction_array;
+          for (unsigned int m = 0; m < ReconstructionStencil::StencilSize();
+               ++m) {
+            reconstruction_array[m] = pencil[n][first_stencil_cell + f + m];
+          }
+          reconstructed_left[n][f] =
+              SU::Reconstruction<ReconstructionStencil, SP::UpwindLeft>(
+                  reconstruction_array, cell_size);
+          reconstructed_right[n][f] =
+              SU::Reconstruction<ReconstructionStencil, SP::UpwindRight>(
+                  reconstruction_array, cell_size);
+        }
+      }
+      if constexpr (!reconstruct_primes) {
+        for (unsigned int n = 0; n < MF::ANOE(); ++n) {
+          for (unsigned int f = 0; f < number_of_faces; ++f) {
+            states_left.conservatives_[n][f] = reconstructed_left[n][f];
+            states_right.conservatives_[n][f] = reconstructed_right[n][f];
+          }
+        }
+      }
+
+      /** Complete the face states and solve the Riemann problems */
+      for (unsigned int f = 0; f < number_of_faces; ++f) {
+        valid_faces[f] = true;
+      }
+      CompletePencilFaceStates<DIR>(eos, reconstructed_left, states_left,
+                                    valid_faces);
+      CompletePencilFaceStates<DIR>(eos, reconstructed_right, states_right,
+                                    valid_faces);
+      riemann_solver_.template SolveRiemannProblemPencil<DIR>(
+          material, states_left, states_right, face_fluxes);
+
+      /** Scatter the fluxes of all valid faces */
+      for (unsigned int f = 0; f < number_of_faces; ++f) {
+        if (!valid_faces[f]) {
+          continue;
+        }
+        // Shifted indices to match block index system and flux index system
+        auto const [i, j, k] = PencilCellIndices<DIR>(
+            FirstInternalPencilCell<DIR>() - 1 + f, a, b);
+        int const i_index = i - total_to_internal_offset_x;
+        int const j_index = j - total_to_internal_offset_y;
+        int const k_index = k - total_to_internal_offset_z;
+        for (unsigned int n = 0; n < MF::ANOE(); ++n) {
+          fluxes[n][i_index][j_index][k_index] += face_fluxes[n][f];
+        }
+      }
+    } // b
+  }   // a
+}
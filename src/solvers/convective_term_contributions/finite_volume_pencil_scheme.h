@@ -0,0 +1,105 @@
+//===------------------ finite_volume_pencil_scheme.h ---------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef FINITE_VOLUME_PENCIL_SCHEME_H
+#define FINITE_VOLUME_PENCIL_SCHEME_H
+
+#include "block_definitions/block.h"
+#include "enums/direction_definition.h"
+#include "materials/equation_of_state.h"
+#include "materials/material_manager.h"
+#include "solvers/convective_term_contributions/convective_term_solver.h"
+#include "solvers/convective_term_contributions/riemann_solvers/riemann_solver_setup.h"
+#include "user_specifications/compile_time_constants.h"
+#include "user_specifications/equation_settings.h"
+#include "user_specifications/riemann_solver_settings.h"
+#include "user_specifications/state_reconstruction_settings.h"
+
+/**
+ * @brief Discretization of the convective term solver using a finite-volume
+ * procedure that works on whole pencils, i.e. lines of cells in one spatial
+ * direction. The cell data of a pencil is gathered into contiguous buffers
+ * (structure of arrays). The state reconstruction and the Riemann solver are
+ * then applied in loops over all faces of the pencil, which allows the compiler
+ * to vectorize them. Gives the same fluxes as the FiniteVolumeScheme.
+ * @note Only available for the Euler and Navier-Stokes equations with
+ * conservative or primitive state reconstruction and the HLLC or HLL Riemann
+ * solver.
+ */
+class FiniteVolumePencilScheme
+    : public ConvectiveTermSolver<FiniteVolumePencilScheme> {
+
+  friend ConvectiveTermSolver;
+
+  using RiemannSolverConcretization = RiemannSolverSetup::Concretize<
+      FiniteVolumeSettings::riemann_solver>::type;
+  RiemannSolverConcretization const riemann_solver_;
+
+  template <Direction DIR>
+  void ComputeFluxes(
+      std::pair<MaterialName const, Block> const &mat_block,
+      double (&fluxes)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+      double const cell_size) const;
+
+  void UpdateImplementation(
+      std::pair<MaterialName const, Block> const &mat_block,
+      double const cell_size,
+      double (
+          &fluxes_x)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+      double (
+          &fluxes_y)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+      double (
+          &fluxes_z)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
+      double (
+          &volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const;
+
+public:
+  FiniteVolumePencilScheme() = delete;
+  explicit FiniteVolumePencilScheme(
+      MaterialManager const &material_manager,
+      EigenDecomposition const &eigendecomposition_calculator);
+  ~FiniteVolumePencilScheme() = default;
+  FiniteVolumePencilScheme(FiniteVolumePencilScheme const &) = delete;
+  FiniteVolumePencilScheme &
+  operator=(FiniteVolumePencilScheme const &) = delete;
+  FiniteVolumePencilScheme(FiniteVolumePencilScheme &&) = delete;
+  FiniteVolumePencilScheme &operator=(FiniteVolumePencilScheme &&) = delete;
+
+  /**
+   * @brief Indicates whether the pencil scheme is implemented for the compiled
+   * settings, i.e. the Euler or Navier-Stokes equations with conservative or
+   * primitive state reconstruction and the HLLC or HLL Riemann solver.
+   * @return True if the scheme computes fluxes, false otherwise.
+   */
+  static constexpr bool IsApplicable() {
+    return (active_equations == EquationSet::Euler ||
+            active_equations == EquationSet::NavierStokes) &&
+           (state_reconstruction_type ==
+                StateReconstructionType::Conservative ||
+            state_reconstruction_type == StateReconstructionType::Primitive) &&
+           (FiniteVolumeSettings::riemann_solver ==
+                FiniteVolumeSettings::RiemannSolvers::Hllc ||
+            FiniteVolumeSettings::riemann_solver ==
+                FiniteVolumeSettings::RiemannSolvers::Hll);
+  }
+};
+
+#endif // FINITE_VOLUME_PENCIL_SCHEME_H
@@ -51,68 +51,18 @@ void FiniteVolumeScheme::UpdateImplementation(
     double (
         &volume_forces)[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()]) const {
 
-  double roe_eigenvectors_left[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                              [MF::ANOE()][MF::ANOE()];
-  double roe_eigenvectors_right[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                               [MF::ANOE()][MF::ANOE()];
-  double roe_eigenvalues[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                        [MF::ANOE()];
-
   double u_hllc_x[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
   double u_hllc_y[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
   double u_hllc_z[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
 
-  constexpr bool require_eigendecomposition =
-      (active_equations == EquationSet::NavierStokes ||
-       active_equations == EquationSet::Euler) &&
-      state_reconstruction_type == StateReconstructionType::Characteristic;
-
-  if constexpr (require_eigendecomposition) {
-    // Setting the eigenvectors, eigenvalues to zero is necessary for two-phase
-    // simulations as not every entry is necessarily set during
-    // eigendecomposition
-    for (unsigned int i = 0; i < CC::ICX() + 1; ++i) {
-      for (unsigned int j = 0; j < CC::ICY() + 1; ++j) {
-        for (unsigned int k = 0; k < CC::ICZ() + 1; ++k) {
-          for (unsigned int e = 0; e < MF::ANOE(); ++e) {
-            for (unsigned int f = 0; f < MF::ANOE(); ++f) {
-              roe_eigenvectors_left[i][j][k][e][f] = 0.0;
-              roe_eigenvectors_right[i][j][k][e][f] = 0.0;
-            }
-            roe_eigenvalues[i][j][k][e] = 0.0;
-          }
-        }
-      }
-    }
-
-    eigendecomposition_calculator_.ComputeRoeEigendecomposition<Direction::X>(
-        mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
-        roe_eigenvalues);
-  }
-  ComputeFluxes<Direction::X>(mat_block, fluxes_x, u_hllc_x,
-                              roe_eigenvectors_left, roe_eigenvectors_right,
-                              cell_size);
+  ComputeFluxes<Direction::X>(mat_block, fluxes_x, u_hllc_x, cell_size);
 
   if constexpr (CC::DIM() != Dimension::One) {
-    if constexpr (require_eigendecomposition) {
-      eigendecomposition_calculator_.ComputeRoeEigendecomposition<Direction::Y>(
-          mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
-          roe_eigenvalues);
-    }
-    ComputeFluxes<Direction::Y>(mat_block, fluxes_y, u_hllc_y,
-                                roe_eigenvectors_left, roe_eigenvectors_right,
-                                cell_size);
+    ComputeFluxes<Direction::Y>(mat_block, fluxes_y, u_hllc_y, cell_size);
   }
 
   if constexpr (CC::DIM() == Dimension::Three) {
-    if constexpr (require_eigendecomposition) {
-      eigendecomposition_calculator_.ComputeRoeEigendecomposition<Direction::Z>(
-          mat_block, roe_eigenvectors_left, roe_eigenvectors_right,
-          roe_eigenvalues);
-    }
-    ComputeFluxes<Direction::Z>(mat_block, fluxes_z, u_hllc_z,
-                                roe_eigenvectors_left, roe_eigenvectors_right,
-                                cell_size);
+    ComputeFluxes<Direction::Z>(mat_block, fluxes_z, u_hllc_z, cell_size);
   }
 
   if constexpr (active_equations == EquationSet::GammaModel) {
@@ -151,25 +101,24 @@ void FiniteVolumeScheme::UpdateImplementation(
  * consideration.
  * @param fluxes Reference to an array which is filled with the computed fluxes
  * (indirect return parameter).
- * @param roe_eigenvectors_left .
- * @param roe_eigenvectors_right .
  * @param cell_size .
  * @tparam DIR Indicates which spatial direction is to be computed.
- * @note Hotpath function.
+ * @note Hotpath function. For characteristic reconstruction, the Roe
+ * eigendecomposition is computed on the fly for each face to avoid
+ * block-sized eigenvector buffers.
  */
 template <Direction DIR>
 void FiniteVolumeScheme::ComputeFluxes(
     std::pair<MaterialName const, Block> const &mat_block,
     double (&fluxes)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
     double (&u_hllc)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-    double const (
-        &Roe_eigenvectors_left)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                               [MF::ANOE()][MF::ANOE()],
-    double const (
-        &Roe_eigenvectors_right)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                                [MF::ANOE()][MF::ANOE()],
     double const cell_size) const {
 
+  constexpr bool require_eigendecomposition =
+      (active_equations == EquationSet::NavierStokes ||
+       active_equations == EquationSet::Euler) &&
+      state_reconstruction_type == StateReconstructionType::Characteristic;
+
   constexpr unsigned int x_start =
       DIR == Direction::X ? CC::FICX() - 1 : CC::FICX();
   constexpr unsigned int y_start =
@@ -190,14 +139,31 @@ void FiniteVolumeScheme::ComputeFluxes(
   // Access the pair's elements directly.
   auto const &[material, block] = mat_block;
 
+  // Roe eigendecomposition of the face under consideration (only computed for
+  // characteristic reconstruction)
+  double roe_eigenvectors_left[MF::ANOE()][MF::ANOE()];
+  double roe_eigenvectors_right[MF::ANOE()][MF::ANOE()];
+  double roe_eigenvalues[MF::ANOE()];
+
   for (unsigned int i = x_start; i <= x_end; ++i) {
     for (unsigned int j = y_start; j <= y_end; ++j) {
       for (unsigned int k = z_start; k <= z_end; ++k) {
-        // Shifted indices to match block index system and roe-ev index system
+        // Shifted indices to match block index system and flux index system
         int const i_index = i - total_to_internal_offset_x;
         int const j_index = j - total_to_internal_offset_y;
         int const k_index = k - total_to_internal_offset_z;
 
+        if constexpr (require_eigendecomposition) {
+          // Faces next to ghost-material cells without valid states (ghost
+          // fluid method) do not contribute a flux
+          if (!eigendecomposition_calculator_
+                   .ComputeRoeEigendecompositionAtFace<DIR, false>(
+                       mat_block, i, j, k, roe_eigenvectors_left,
+                       roe_eigenvectors_right, roe_eigenvalues)) {
+            continue;
+          }
+        }
+
         auto const [reconstructed_conservatives_left,
                     reconstructed_conservatives_right,
                     reconstructed_primes_left, reconstructed_primes_right] =
@@ -205,9 +171,8 @@ void FiniteVolumeScheme::ComputeFluxes(
                 DIR, reconstruction_stencil>(
                 block,
                 material_manager_.GetMaterial(material).GetEquationOfState(),
-                Roe_eigenvectors_left[i_index][j_index][k_index],
-                Roe_eigenvectors_right[i_index][j_index][k_index], cell_size, i,
-                j, k);
+                roe_eigenvectors_left, roe_eigenvectors_right, cell_size, i, j,
+                k);
         // To check for invalid cells due to ghost fluid method
         if constexpr (active_equations != EquationSet::GammaModel) {
           double const B = active_equations == EquationSet::Isentropic
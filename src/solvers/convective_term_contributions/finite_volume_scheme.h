@@ -52,12 +52,6 @@ class FiniteVolumeScheme : public ConvectiveTermSolver<FiniteVolumeScheme> {
       std::pair<MaterialName const, Block> const &mat_block,
       double (&fluxes)[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
       double (&u_hllc)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1],
-      double const (
-          &Roe_eigenvectors_left)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                                 [MF::ANOE()][MF::ANOE()],
-      double const (
-          &Roe_eigenvectors_right)[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1]
-                                  [MF::ANOE()][MF::ANOE()],
       double const cell_size) const;
 
   void UpdateImplementation(
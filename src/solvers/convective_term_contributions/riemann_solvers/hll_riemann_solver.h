@@ -142,6 +142,100 @@ class HllRiemannSolver : public RiemannSolver<HllRiemannSolver> {
     return fluxes;
   }
 
+  /**
+   * @brief Computes approximate solutions of the Riemann problems of all faces
+   * of a pencil using the HLL procedure. Identical to the single face
+   * procedure, but organized as one loop over the faces that can be vectorized.
+   * @param material Material information of the phase under consideration.
+   * @param states_left The initial left states of all faces.
+   * @param states_right The initial right states of all faces.
+   * @param fluxes The fluxes over all faces (indirect return parameter).
+   * @tparam DIR Indicates which spatial direction is to be computed.
+   * @tparam N Number of faces in the pencil.
+   * @note Hotpath function.
+   */
+  template <Direction DIR, unsigned int N>
+  void SolveRiemannProblemPencilImplementation(
+      MaterialName const material, PencilFaceStates<N> const &states_left,
+      PencilFaceStates<N> const &states_right,
+      double (&fluxes)[MF::ANOE()][N]) const {
+
+    constexpr unsigned int mass_index = ETI(Equation::Mass);
+    constexpr unsigned int energy_index = ETI(Equation::Energy);
+    constexpr unsigned int principal_momentum_index = ETI(MF::AME()[DTI(DIR)]);
+
+    // For Toro signal speeds
+    double const gamma =
+        material_manager_.GetMaterial(material).GetEquationOfState().Gamma();
+
+    for (unsigned int f = 0; f < N; ++f) {
+      double const density_left = states_left.conservatives_[mass_index][f];
+      double const density_right = states_right.conservatives_[mass_index][f];
+      double const momentum_left =
+          states_left.conservatives_[principal_momentum_index][f];
+      double const momentum_right =
+          states_right.conservatives_[principal_momentum_index][f];
+      double const energy_left = states_left.conservatives_[energy_index][f];
+      double const energy_right = states_right.conservatives_[energy_index][f];
+      double const pressure_left = states_left.pressure_[f];
+      double const pressure_right = states_right.pressure_[f];
+      double const velocity_left = states_left.velocity_[f];
+      double const velocity_right = states_right.velocity_[f];
+      double const one_density_left = 1.0 / density_left;
+      double const one_density_right = 1.0 / density_right;
+
+      // Calculation of signal speeds
+      auto const [wave_speed_left_simple, wave_speed_right_simple] =
+          CalculateSignalSpeed(density_left, density_right, velocity_left,
+                               velocity_right, pressure_left, pressure_right,
+                               states_left.speed_of_sound_[f],
+                               states_right.speed_of_sound_[f], gamma);
+      double const wave_speed_left = std::min(wave_speed_left_simple, 0.0);
+      double const wave_speed_right = std::max(wave_speed_right_simple, 0.0);
+
+      // Combines the fluxes and states of both sides
+      auto const face_flux = [&](double const flux_left,
+                                 double const conservative_left,
+                                 double const flux_right,
+                                 double const conservative_right) {
+        return (((wave_speed_right * flux_left) -
+                 (wave_speed_left * flux_right)) +
+                ((wave_speed_right * wave_speed_left) *
+                 (conservative_right - conservative_left))) /
+               (wave_speed_right - wave_speed_left);
+      };
+
+      fluxes[mass_index][f] = face_flux(momentum_left, density_left,
+                                        momentum_right, density_right);
+      fluxes[principal_momentum_index][f] =
+          face_flux(((momentum_left * momentum_left) * one_density_left) +
+                        pressure_left,
+                    momentum_left,
+                    ((momentum_right * momentum_right) * one_density_right) +
+                        pressure_right,
+                    momentum_right);
+      fluxes[energy_index][f] =
+          face_flux(velocity_left * (energy_left + pressure_left), energy_left,
+                    velocity_right * (energy_right + pressure_right),
+                    energy_right);
+
+      // minor momenta
+      for (unsigned int d = 0; d < DTI(CC::DIM()) - 1; ++d) {
+        // get the index of this minor momentum
+        unsigned int const minor_momentum_index =
+            ETI(MF::AME()[DTI(GetMinorDirection<DIR>(d))]);
+        double const minor_momentum_left =
+            states_left.conservatives_[minor_momentum_index][f];
+        double const minor_momentum_right =
+            states_right.conservatives_[minor_momentum_index][f];
+        fluxes[minor_momentum_index][f] =
+            face_flux(velocity_left * minor_momentum_left, minor_momentum_left,
+                      velocity_right * minor_momentum_right,
+                      minor_momentum_right);
+      }
+    }
+  }
+
 public:
   HllRiemannSolver() = delete;
   explicit HllRiemannSolver(
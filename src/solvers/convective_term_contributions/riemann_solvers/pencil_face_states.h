@@ -0,0 +1,41 @@
+//===---------------------- pencil_face_states.h --------------------------===//
+//
+//                                 ALPACA
+//
+// Part of ALPACA, under the GNU General Public License as published by
+// the Free Software Foundation version 3.
+// SPDX-License-Identifier: GPL-3.0-only
+//
+// If using this code in an academic setting, please cite the following:
+// @article{hoppe2022parallel,
+//  title={A parallel modular computing environment for three-dimensional
+//  multiresolution simulations of compressible flows},
+//  author={Hoppe, Nils and Adami, Stefan and Adams, Nikolaus A},
+//  journal={Computer Methods in Applied Mechanics and Engineering},
+//  volume={391},
+//  pages={114486},
+//  year={2022},
+//  publisher={Elsevier}
+// }
+//
+//===----------------------------------------------------------------------===//
+#ifndef PENCIL_FACE_STATES_H
+#define PENCIL_FACE_STATES_H
+
+#include "block_definitions/field_material_definitions.h"
+
+/**
+ * @brief Holds the reconstructed states on one side of all cell faces of a
+ * pencil, i.e. a line of cells in one spatial direction. The data is stored as
+ * structure of arrays, such that operations on all faces can be vectorized.
+ * @tparam N Number of faces in the pencil.
+ */
+template <unsigned int N> struct PencilFaceStates {
+  double conservatives_[MF::ANOE()][N];
+  // Velocity normal to the faces
+  double velocity_[N];
+  double pressure_[N];
+  double speed_of_sound_[N];
+};
+
+#endif // PENCIL_FACE_STATES_H
@@ -25,6 +25,7 @@
 
 #include "block_definitions/block.h"
 #include "materials/material_manager.h"
+#include "solvers/convective_term_contributions/riemann_solvers/pencil_face_states.h"
 #include "solvers/eigendecomposition.h"
 
 /**
@@ -79,6 +80,26 @@ public:
             prime_state_right);
   }
 
+  /**
+   * @brief Solves the first-order Riemann problems of all faces of a pencil.
+   * @tparam DIR Direction of the pencil.
+   * @tparam N Number of faces in the pencil.
+   * @param material Material of the phase under consideration.
+   * @param states_left, states_right The reconstructed left/right states of
+   * all faces.
+   * @param fluxes The fluxes over all faces as computed by this Riemann solver
+   * (indirect return parameter).
+   */
+  template <Direction DIR, unsigned int N>
+  void SolveRiemannProblemPencil(MaterialName const material,
+                                 PencilFaceStates<N> const &states_left,
+                                 PencilFaceStates<N> const &states_right,
+                                 double (&fluxes)[MF::ANOE()][N]) const {
+    static_cast<DerivedRiemannSolver const &>(*this)
+        .template SolveRiemannProblemPencilImplementation<DIR, N>(
+            material, states_left, states_right, fluxes);
+  }
+
   /**
    * @brief Solves the first-order Riemann problem using left and right state
    * vectors.
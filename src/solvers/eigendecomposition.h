@@ -63,6 +63,13 @@ public:
                                       [CC::ICZ() + 1][MF::ANOE()][MF::ANOE()],
       double (&fluxfunction_eigenvalues)[CC::ICX() + 1][CC::ICY() + 1]
                                         [CC::ICZ() + 1][MF::ANOE()]) const;
+  template <Direction DIR, bool compute_eigenvalues = true>
+  bool ComputeRoeEigendecompositionAtFace(
+      std::pair<MaterialName const, Block> const &mat_block,
+      unsigned int const i, unsigned int const j, unsigned int const k,
+      double (&left_eigenvector)[MF::ANOE()][MF::ANOE()],
+      double (&right_eigenvector)[MF::ANOE()][MF::ANOE()],
+      double (&eigenvalues)[MF::ANOE()]) const;
 
   void ComputeMaxEigenvaluesOnBlock(
       std::pair<MaterialName const, Block> const &mat_block,
@@ -201,6 +208,52 @@ void EigenDecomposition::ComputeRoeEigendecomposition(
   constexpr unsigned int start_z =
       DIR == Direction::Z ? CC::FICZ() - 1 : CC::FICZ();
 
+  for (unsigned int i = start_x; i <= CC::LICX(); ++i) {
+    for (unsigned int j = start_y; j <= CC::LICY(); ++j) {
+      for (unsigned int k = start_z; k <= CC::LICZ(); ++k) {
+        // Shifted indices to match block index system and roe-ev index system
+        int const i_index = i - total_to_internal_offset_x;
+        int const j_index = j - total_to_internal_offset_y;
+        int const k_index = k - total_to_internal_offset_z;
+        ComputeRoeEigendecompositionAtFace<DIR>(
+            mat_block, i, j, k,
+            roe_eigenvectors_left[i_index][j_index][k_index],
+            roe_eigenvectors_right[i_index][j_index][k_index],
+            fluxfunction_eigenvalues[i_index][j_index][k_index]);
+      } // k
+    }   // j
+  }     // i
+}
+
+/**
+ * @brief Computes the Roe left and right eigenvectors and the Roe eigenvalues
+ * at a single cell face according to \cite Fedkiw1999a. The face lies between
+ * cell (i,j,k) and its neighbor in direction DIR. Allows to compute the
+ * eigendecomposition on the fly without block-sized buffers.
+ * @param mat_block The block and material information of the phase under
+ * consideration.
+ * @param i,j,k Indices of the cell left of the face.
+ * @param left_eigenvector Reference to an array which is filled with the
+ * computed left eigenvectors (indirect return parameter).
+ * @param right_eigenvector Reference to an array which is filled with the
+ * computed right eigenvectors (indirect return parameter).
+ * @param eigenvalues Reference to an array which is filled with the computed
+ * eigenvalues (indirect return parameter).
+ * @tparam DIR Direction of the face normal.
+ * @tparam compute_eigenvalues Flag whether the eigenvalues are computed. If
+ * not, the eigenvalues are not touched.
+ * @return False if no eigendecomposition can be computed at the face due to
+ * ghost-material cells. In this case, no output is written.
+ * @note Hotpath function.
+ */
+template <Direction DIR, bool compute_eigenvalues>
+bool EigenDecomposition::ComputeRoeEigendecompositionAtFace(
+    std::pair<MaterialName const, Block> const &mat_block, unsigned int const i,
+    unsigned int const j, unsigned int const k,
+    double (&left_eigenvector)[MF::ANOE()][MF::ANOE()],
+    double (&right_eigenvector)[MF::ANOE()][MF::ANOE()],
+    double (&eigenvalues)[MF::ANOE()]) const {
+
   constexpr unsigned int x_varying = DIR == Direction::X ? 1 : 0;
   constexpr unsigned int y_varying = DIR == Direction::Y ? 1 : 0;
   constexpr unsigned int z_varying = DIR == Direction::Z ? 1 : 0;
@@ -235,235 +288,231 @@ void EigenDecomposition::ComputeRoeEigendecomposition(
                                             .GetEquationOfState()
                                             .Gruneisen();
 
-  for (unsigned int i = start_x; i <= CC::LICX(); ++i) {
-    for (unsigned int j = start_y; j <= CC::LICY(); ++j) {
-      for (unsigned int k = start_z; k <= CC::LICZ(); ++k) {
-        // clang-format off
-            // Indices of neighbor cell
-            unsigned int const in = i + x_varying;
-            unsigned int const jn = j + y_varying;
-            unsigned int const kn = k + z_varying;
-            /**
-             * This if statement is necessary due to the ghost-fluid method. In ghost-material cells which do not lie on the extension band, i.e. therein
-             * we do not have extended or integrated values, the density is zero. Therefore, we cannot compute Roe eigenvalues in those cells.
-             */
-            if(density[i][j][k] <= 0.0 || density[in][jn][kn] <= 0.0) continue;
-
-            // References to write directly to the buffers of the currently considered cell face
-            auto& left_eigenvector  = roe_eigenvectors_left   [i - total_to_internal_offset_x][j - total_to_internal_offset_y][k - total_to_internal_offset_z];
-            auto& right_eigenvector = roe_eigenvectors_right  [i - total_to_internal_offset_x][j - total_to_internal_offset_y][k - total_to_internal_offset_z];
-            auto& eigenvalues       = fluxfunction_eigenvalues[i - total_to_internal_offset_x][j - total_to_internal_offset_y][k - total_to_internal_offset_z];
-
-            // extract required conservatives and primes
-            double const rho_target                 =       density[i][j][k];
-            double const one_rho_target             = 1.0 / density[i][j][k];
-            double const energy_target              =     energy[i][j][k];
-            double const x_momentum_target          = conservatives[Equation::MomentumX][i][j][k];
-            double const y_momentum_target          = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][i][j][k] : 0.0;
-            double const z_momentum_target          = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][i][j][k] : 0.0;
-            double const principal_velocity_target  = prime_states[MF::AV()[principal]][i][j][k];
-            double const minor1_velocity_target     = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][i][j][k] : 0.0;
-            double const minor2_velocity_target     = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][i][j][k] : 0.0;
-            double const pressure_target            = pressure[i][j][k];
-            double const generalized_psi_target     = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_target, one_rho_target);
-            double const gruneisen_target           = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_target) : 0.0;
-
-            double const rho_neighbor               =       density[in][jn][kn];
-            double const one_rho_neighbor           = 1.0 / density[in][jn][kn];
-            double const energy_neighbor            =     energy[in][jn][kn];
-            double const x_momentum_neighbor        = conservatives[Equation::MomentumX][in][jn][kn];
-            double const y_momentum_neighbor        = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][in][jn][kn] : 0.0;
-            double const z_momentum_neighbor        = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][in][jn][kn] : 0.0;
-            double const principal_velocity_neighbor= prime_states[MF::AV()[principal]][in][jn][kn];
-            double const minor1_velocity_neighbor   = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][in][jn][kn] : 0.0;
-            double const minor2_velocity_neighbor   = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][in][jn][kn] : 0.0;
-            double const pressure_neighbor          =   pressure[in][jn][kn];
-            double const generalized_psi_neighbor   = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_neighbor, one_rho_neighbor);
-            double const gruneisen_neighbor         = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_neighbor) : 0.0;
-
-            // compute expensive and frequently used temporaries
-            double const sqrt_rho_target   = std::sqrt(rho_target);
-            double const sqrt_rho_neighbor = std::sqrt(rho_neighbor);
-            double const rho_div = 1.0 / ( sqrt_rho_target + sqrt_rho_neighbor );
-            double const density_roe_ave = sqrt_rho_target * sqrt_rho_neighbor;
-            double const one_density_roe_ave = 1.0 / density_roe_ave;
-
-            // compute Roe averages
-            double const principal_velocity_roe_ave = ((principal_velocity_target * sqrt_rho_target) + (principal_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const minor1_velocity_roe_ave = ((minor1_velocity_target * sqrt_rho_target) + (minor1_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const minor2_velocity_roe_ave = ((minor2_velocity_target * sqrt_rho_target) + (minor2_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const generalized_psi_roe_ave = ((generalized_psi_target * sqrt_rho_target) + (generalized_psi_neighbor * sqrt_rho_neighbor)) * rho_div;
-            double const gruneisen_roe_ave = CC::GruneisenDensityDependent() ? ((gruneisen_target * sqrt_rho_target) + (gruneisen_neighbor * sqrt_rho_neighbor)) * rho_div : gruneisen_coefficient_material;
-            double const enthalpy_roe_ave = ( material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_target,   x_momentum_target,   y_momentum_target,   z_momentum_target,   energy_target )   * sqrt_rho_target
-                                            + material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_neighbor, x_momentum_neighbor, y_momentum_neighbor, z_momentum_neighbor, energy_neighbor ) * sqrt_rho_neighbor)
-                                            * rho_div;
-
-            // Absolute roe averaged velocity, speed of sound
-            double const q_squared  = DimensionAwareConsistencyManagedSum( principal_velocity_roe_ave * principal_velocity_roe_ave, minor1_velocity_roe_ave * minor1_velocity_roe_ave, minor2_velocity_roe_ave * minor2_velocity_roe_ave);
-            double const tmp = DimensionAwareConsistencyManagedSum( (principal_velocity_target - principal_velocity_neighbor) * (principal_velocity_target - principal_velocity_neighbor),
-                                                         (minor1_velocity_target    - minor1_velocity_neighbor)    * (minor1_velocity_target    - minor1_velocity_neighbor),
-                                                         (minor2_velocity_target    - minor2_velocity_neighbor)    * (minor2_velocity_target    - minor2_velocity_neighbor) );
-            double const pressure_over_density_roe_ave = ((pressure_target*one_rho_target) * sqrt_rho_target + (pressure_neighbor*one_rho_neighbor) * sqrt_rho_neighbor) * rho_div
-                                                           + 0.5 * density_roe_ave * (rho_div * rho_div) * tmp;
-            double const cc = generalized_psi_roe_ave + gruneisen_roe_ave * pressure_over_density_roe_ave;
-            double const one_cc = 1.0 / cc;
-            double const c = std::sqrt(cc);
-
-            // LEFT EIGENVECTORS **********************************************
-            // ****************************************************************
-
-            // Eigenvector for lambda = u-c
-            left_eigenvector[         0     ][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave + (principal_velocity_roe_ave+c) * c);
-            left_eigenvector[         0     ][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave * gruneisen_roe_ave - c);
-            if constexpr( CC::DIM() != Dimension::One )
-               left_eigenvector[      0     ][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
-            if constexpr( CC::DIM() == Dimension::Three )
-               left_eigenvector[      0     ][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
-            left_eigenvector[         0     ][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
-
-            if constexpr( CC::DIM() != Dimension::One ) {
-               // Additional eigenvector for lambda = u related to second momentum equation (= first minor momentum)
-               left_eigenvector[      1     ][ETI(Equation::Mass)       ] = minor1_velocity_roe_ave * one_density_roe_ave;
-               left_eigenvector[      1     ][ETI(MF::AME()[principal]) ] = 0.0;
-               left_eigenvector[      1     ][ETI(MF::AME()[minor1])    ] = -one_density_roe_ave;
-               if constexpr( CC::DIM() == Dimension::Three )
-                  left_eigenvector[   1     ][ETI(MF::AME()[minor2])    ] = 0.0;
-               left_eigenvector[      1     ][ETI(Equation::Energy)     ] = 0.0;
-            }
-
-            if constexpr( CC::DIM() == Dimension::Three ) {
-               // Additional eigenvector for lambda = u related to third momentum equation (= second minor momentum)
-               left_eigenvector[      2     ][ETI(Equation::Mass)       ] = -minor2_velocity_roe_ave * one_density_roe_ave;
-               left_eigenvector[      2     ][ETI(MF::AME()[principal]) ] = 0.0;
-               left_eigenvector[      2     ][ETI(MF::AME()[minor1])    ] = 0.0;
-               left_eigenvector[      2     ][ETI(MF::AME()[minor2])    ] = one_density_roe_ave;
-               left_eigenvector[      2     ][ETI(Equation::Energy)     ] = 0.0;
-            }
-
-            // Eigenvector for lambda = u related to principal momentum direction
-            left_eigenvector[   ev_principal][ETI(Equation::Mass)       ] =  one_cc * (enthalpy_roe_ave - q_squared);
-            left_eigenvector[   ev_principal][ETI(MF::AME()[principal]) ] =  one_cc * principal_velocity_roe_ave;
-            if constexpr( CC::DIM() != Dimension::One )
-               left_eigenvector[ev_principal][ETI(MF::AME()[minor1])    ] =  one_cc * minor1_velocity_roe_ave;
-            if constexpr( CC::DIM() == Dimension::Three )
-               left_eigenvector[ev_principal][ETI(MF::AME()[minor2])    ] =  one_cc * minor2_velocity_roe_ave;
-            left_eigenvector[   ev_principal][ETI(Equation::Energy)     ] = -one_cc;
-
-            // eigenvector for lambda = u+c
-            left_eigenvector[   MF::ANOE()-1][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave - (principal_velocity_roe_ave-c) * c);
-            left_eigenvector[   MF::ANOE()-1][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave*gruneisen_roe_ave + c);
-            if constexpr( CC::DIM() != Dimension::One )
-               left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
-            if constexpr( CC::DIM() == Dimension::Three )
-               left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
-            left_eigenvector[   MF::ANOE()-1][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
-
-
-            // RIGHT EIGENVECTORS *********************************************
-            // ****************************************************************
-
-            // Mass equation entries of right eigenvectors
-            right_eigenvector[   ETI(Equation::Mass)      ][      0     ] = 1.0;
-            if constexpr( CC::DIM() != Dimension::One )
-               right_eigenvector[ETI(Equation::Mass)      ][      1     ] = 0.0;
-            if constexpr( CC::DIM() == Dimension::Three )
-               right_eigenvector[ETI(Equation::Mass)      ][      2     ] = 0.0;
-            right_eigenvector[   ETI(Equation::Mass)      ][ev_principal] = gruneisen_roe_ave;
-            right_eigenvector[   ETI(Equation::Mass)      ][MF::ANOE()-1] = 1.0;
-
-            // principal momentum equation entries
-            right_eigenvector[   ETI(MF::AME()[principal])][      0     ] = principal_velocity_roe_ave - c;
-            if constexpr( CC::DIM() != Dimension::One )
-               right_eigenvector[ETI(MF::AME()[principal])][      1     ] = 0.0;
-            if constexpr( CC::DIM() == Dimension::Three )
-               right_eigenvector[ETI(MF::AME()[principal])][      2     ] = 0.0;
-            right_eigenvector[   ETI(MF::AME()[principal])][ev_principal] = gruneisen_roe_ave * principal_velocity_roe_ave;
-            right_eigenvector[   ETI(MF::AME()[principal])][MF::ANOE()-1] = principal_velocity_roe_ave + c;
-
-            if constexpr( CC::DIM() != Dimension::One ) {
-               // first minor momentum equation entries
-               right_eigenvector[   ETI(MF::AME()[minor1])][      0     ] = minor1_velocity_roe_ave;
-               right_eigenvector[   ETI(MF::AME()[minor1])][      1     ] = -density_roe_ave;
-               if constexpr( CC::DIM() == Dimension::Three )
-                  right_eigenvector[ETI(MF::AME()[minor1])][      2     ] = 0.0;
-               right_eigenvector[   ETI(MF::AME()[minor1])][ev_principal] = gruneisen_roe_ave * minor1_velocity_roe_ave;
-               right_eigenvector[   ETI(MF::AME()[minor1])][MF::ANOE()-1] = minor1_velocity_roe_ave;
-            }
-
-            if constexpr( CC::DIM() == Dimension::Three ) {
-               // second minor momentum equation entries
-               right_eigenvector[ETI(MF::AME()[minor2])   ][      0     ] = minor2_velocity_roe_ave;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][      1     ] = 0.0;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][      2     ] = density_roe_ave;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][ev_principal] = gruneisen_roe_ave * minor2_velocity_roe_ave;
-               right_eigenvector[ETI(MF::AME()[minor2])   ][MF::ANOE()-1] = minor2_velocity_roe_ave;
-            }
-
-            // Energy equation entries
-            right_eigenvector[   ETI(Equation::Energy)    ][      0     ] = enthalpy_roe_ave - principal_velocity_roe_ave * c;
-            if constexpr( CC::DIM() != Dimension::One )
-               right_eigenvector[ETI(Equation::Energy)    ][      1     ] = -minor1_velocity_roe_ave * density_roe_ave;
-            if constexpr( CC::DIM() == Dimension::Three )
-               right_eigenvector[ETI(Equation::Energy)    ][      2     ] = density_roe_ave * minor2_velocity_roe_ave;
-            right_eigenvector[   ETI(Equation::Energy)    ][ev_principal] = gruneisen_roe_ave * enthalpy_roe_ave - c*c;
-            right_eigenvector[   ETI(Equation::Energy)    ][MF::ANOE()-1] = enthalpy_roe_ave + principal_velocity_roe_ave * c;
-
-
-            // EIGENVALUES ****************************************************
-            // ****************************************************************
-
-            // Flux-function artificial viscosity -> Roe eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe ) {
-               SaveForAllFields( eigenvalues,
-                  std::abs(principal_velocity_roe_ave - c),
-                  std::abs(principal_velocity_roe_ave),
-                  std::abs(principal_velocity_roe_ave + c) );
-            }
-
-            // Flux-function artificial viscosity -> Roe-M eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe_M ) {
-               SaveForAllFields( eigenvalues,
-                  std::abs( principal_velocity_roe_ave - std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ),
-                  std::abs( principal_velocity_roe_ave ),
-                  std::abs( principal_velocity_roe_ave + std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ) );
-            }
-
-            // Flux-function artificial viscosity -> Local-Lax-Friedrichs eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs ) {
-               double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
-               double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
-
-               SaveForAllFields( eigenvalues,
-                  std::max(std::abs(principal_velocity_target - c_target),std::abs(principal_velocity_neighbor - c_neighbor)),
-                  std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
-                  std::max(std::abs(principal_velocity_target + c_target),std::abs(principal_velocity_neighbor + c_neighbor)) );
-            }
-
-            // Flux-function artificial viscosity -> LLF-M eigenvalues
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs_M ) {
-               double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
-               double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
-
-               double const c_target_m   = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_target )  , c_target );
-               double const c_neighbor_m = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_neighbor ), c_neighbor );
-
-               SaveForAllFields( eigenvalues,
-                  std::max(std::abs(principal_velocity_target - c_target_m),std::abs(principal_velocity_neighbor - c_neighbor_m)),
-                  std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
-                  std::max(std::abs(principal_velocity_target + c_target_m),std::abs(principal_velocity_neighbor + c_neighbor_m)) );
-            }
-
-            // Flux-function artificial viscosity -> Global-Lax-Friedrichs or LaxFriedrichs scheme
-            if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::GlobalLaxFriedrichs ) {
-               for(unsigned int l = 0; l < MF::ANOE(); ++l) {
-                  eigenvalues[l] = global_eigenvalues_[0][l];
-               }
-            }
-
-        // clang-format on
-      } // k
-    }   // j
-  }     // i
+  // clang-format off
+  // Indices of neighbor cell
+  unsigned int const in = i + x_varying;
+  unsigned int const jn = j + y_varying;
+  unsigned int const kn = k + z_varying;
+  /**
+   * This if statement is necessary due to the ghost-fluid method. In ghost-material cells which do not lie on the extension band, i.e. therein
+   * we do not have extended or integrated values, the density is zero. Therefore, we cannot compute Roe eigenvalues in those cells.
+   */
+  if(density[i][j][k] <= 0.0 || density[in][jn][kn] <= 0.0) return false;
+
+
+  // extract required conservatives and primes
+  double const rho_target                 =       density[i][j][k];
+  double const one_rho_target             = 1.0 / density[i][j][k];
+  double const energy_target              =     energy[i][j][k];
+  double const x_momentum_target          = conservatives[Equation::MomentumX][i][j][k];
+  double const y_momentum_target          = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][i][j][k] : 0.0;
+  double const z_momentum_target          = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][i][j][k] : 0.0;
+  double const principal_velocity_target  = prime_states[MF::AV()[principal]][i][j][k];
+  double const minor1_velocity_target     = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][i][j][k] : 0.0;
+  double const minor2_velocity_target     = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][i][j][k] : 0.0;
+  double const pressure_target            = pressure[i][j][k];
+  double const generalized_psi_target     = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_target, one_rho_target);
+  double const gruneisen_target           = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_target) : 0.0;
+
+  double const rho_neighbor               =       density[in][jn][kn];
+  double const one_rho_neighbor           = 1.0 / density[in][jn][kn];
+  double const energy_neighbor            =     energy[in][jn][kn];
+  double const x_momentum_neighbor        = conservatives[Equation::MomentumX][in][jn][kn];
+  double const y_momentum_neighbor        = CC::DIM() != Dimension::One ? conservatives[Equation::MomentumY][in][jn][kn] : 0.0;
+  double const z_momentum_neighbor        = CC::DIM() == Dimension::Three ? conservatives[Equation::MomentumZ][in][jn][kn] : 0.0;
+  double const principal_velocity_neighbor= prime_states[MF::AV()[principal]][in][jn][kn];
+  double const minor1_velocity_neighbor   = CC::DIM() != Dimension::One   ? prime_states[MF::AV()[minor1]][in][jn][kn] : 0.0;
+  double const minor2_velocity_neighbor   = CC::DIM() == Dimension::Three ? prime_states[MF::AV()[minor2]][in][jn][kn] : 0.0;
+  double const pressure_neighbor          =   pressure[in][jn][kn];
+  double const generalized_psi_neighbor   = material_manager_.GetMaterial(material).GetEquationOfState().Psi(pressure_neighbor, one_rho_neighbor);
+  double const gruneisen_neighbor         = CC::GruneisenDensityDependent() ? material_manager_.GetMaterial(material).GetEquationOfState().Gruneisen(rho_neighbor) : 0.0;
+
+  // compute expensive and frequently used temporaries
+  double const sqrt_rho_target   = std::sqrt(rho_target);
+  double const sqrt_rho_neighbor = std::sqrt(rho_neighbor);
+  double const rho_div = 1.0 / ( sqrt_rho_target + sqrt_rho_neighbor );
+  double const density_roe_ave = sqrt_rho_target * sqrt_rho_neighbor;
+  double const one_density_roe_ave = 1.0 / density_roe_ave;
+
+  // compute Roe averages
+  double const principal_velocity_roe_ave = ((principal_velocity_target * sqrt_rho_target) + (principal_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const minor1_velocity_roe_ave = ((minor1_velocity_target * sqrt_rho_target) + (minor1_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const minor2_velocity_roe_ave = ((minor2_velocity_target * sqrt_rho_target) + (minor2_velocity_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const generalized_psi_roe_ave = ((generalized_psi_target * sqrt_rho_target) + (generalized_psi_neighbor * sqrt_rho_neighbor)) * rho_div;
+  double const gruneisen_roe_ave = CC::GruneisenDensityDependent() ? ((gruneisen_target * sqrt_rho_target) + (gruneisen_neighbor * sqrt_rho_neighbor)) * rho_div : gruneisen_coefficient_material;
+  double const enthalpy_roe_ave = ( material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_target,   x_momentum_target,   y_momentum_target,   z_momentum_target,   energy_target )   * sqrt_rho_target
+                                  + material_manager_.GetMaterial(material).GetEquationOfState().Enthalpy(rho_neighbor, x_momentum_neighbor, y_momentum_neighbor, z_momentum_neighbor, energy_neighbor ) * sqrt_rho_neighbor)
+                                  * rho_div;
+
+  // Absolute roe averaged velocity, speed of sound
+  double const q_squared  = DimensionAwareConsistencyManagedSum( principal_velocity_roe_ave * principal_velocity_roe_ave, minor1_velocity_roe_ave * minor1_velocity_roe_ave, minor2_velocity_roe_ave * minor2_velocity_roe_ave);
+  double const tmp = DimensionAwareConsistencyManagedSum( (principal_velocity_target - principal_velocity_neighbor) * (principal_velocity_target - principal_velocity_neighbor),
+                                               (minor1_velocity_target    - minor1_velocity_neighbor)    * (minor1_velocity_target    - minor1_velocity_neighbor),
+                                               (minor2_velocity_target    - minor2_velocity_neighbor)    * (minor2_velocity_target    - minor2_velocity_neighbor) );
+  double const pressure_over_density_roe_ave = ((pressure_target*one_rho_target) * sqrt_rho_target + (pressure_neighbor*one_rho_neighbor) * sqrt_rho_neighbor) * rho_div
+                                                 + 0.5 * density_roe_ave * (rho_div * rho_div) * tmp;
+  double const cc = generalized_psi_roe_ave + gruneisen_roe_ave * pressure_over_density_roe_ave;
+  double const one_cc = 1.0 / cc;
+  double const c = std::sqrt(cc);
+
+  // LEFT EIGENVECTORS **********************************************
+  // ****************************************************************
+
+  // Eigenvector for lambda = u-c
+  left_eigenvector[         0     ][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave + (principal_velocity_roe_ave+c) * c);
+  left_eigenvector[         0     ][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave * gruneisen_roe_ave - c);
+  if constexpr( CC::DIM() != Dimension::One )
+     left_eigenvector[      0     ][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
+  if constexpr( CC::DIM() == Dimension::Three )
+     left_eigenvector[      0     ][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
+  left_eigenvector[         0     ][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
+
+  if constexpr( CC::DIM() != Dimension::One ) {
+     // Additional eigenvector for lambda = u related to second momentum equation (= first minor momentum)
+     left_eigenvector[      1     ][ETI(Equation::Mass)       ] = minor1_velocity_roe_ave * one_density_roe_ave;
+     left_eigenvector[      1     ][ETI(MF::AME()[principal]) ] = 0.0;
+     left_eigenvector[      1     ][ETI(MF::AME()[minor1])    ] = -one_density_roe_ave;
+     if constexpr( CC::DIM() == Dimension::Three )
+        left_eigenvector[   1     ][ETI(MF::AME()[minor2])    ] = 0.0;
+     left_eigenvector[      1     ][ETI(Equation::Energy)     ] = 0.0;
+  }
+
+  if constexpr( CC::DIM() == Dimension::Three ) {
+     // Additional eigenvector for lambda = u related to third momentum equation (= second minor momentum)
+     left_eigenvector[      2     ][ETI(Equation::Mass)       ] = -minor2_velocity_roe_ave * one_density_roe_ave;
+     left_eigenvector[      2     ][ETI(MF::AME()[principal]) ] = 0.0;
+     left_eigenvector[      2     ][ETI(MF::AME()[minor1])    ] = 0.0;
+     left_eigenvector[      2     ][ETI(MF::AME()[minor2])    ] = one_density_roe_ave;
+     left_eigenvector[      2     ][ETI(Equation::Energy)     ] = 0.0;
+  }
+
+  // Eigenvector for lambda = u related to principal momentum direction
+  left_eigenvector[   ev_principal][ETI(Equation::Mass)       ] =  one_cc * (enthalpy_roe_ave - q_squared);
+  left_eigenvector[   ev_principal][ETI(MF::AME()[principal]) ] =  one_cc * principal_velocity_roe_ave;
+  if constexpr( CC::DIM() != Dimension::One )
+     left_eigenvector[ev_principal][ETI(MF::AME()[minor1])    ] =  one_cc * minor1_velocity_roe_ave;
+  if constexpr( CC::DIM() == Dimension::Three )
+     left_eigenvector[ev_principal][ETI(MF::AME()[minor2])    ] =  one_cc * minor2_velocity_roe_ave;
+  left_eigenvector[   ev_principal][ETI(Equation::Energy)     ] = -one_cc;
+
+  // eigenvector for lambda = u+c
+  left_eigenvector[   MF::ANOE()-1][ETI(Equation::Mass)       ] = 0.5 * one_cc * (gruneisen_roe_ave*q_squared - gruneisen_roe_ave*enthalpy_roe_ave - (principal_velocity_roe_ave-c) * c);
+  left_eigenvector[   MF::ANOE()-1][ETI(MF::AME()[principal]) ] = 0.5 * one_cc * (-principal_velocity_roe_ave*gruneisen_roe_ave + c);
+  if constexpr( CC::DIM() != Dimension::One )
+     left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor1])    ] = 0.5 * one_cc * (-minor1_velocity_roe_ave*gruneisen_roe_ave);
+  if constexpr( CC::DIM() == Dimension::Three )
+     left_eigenvector[MF::ANOE()-1][ETI(MF::AME()[minor2])    ] = 0.5 * one_cc * (-minor2_velocity_roe_ave*gruneisen_roe_ave);
+  left_eigenvector[   MF::ANOE()-1][ETI(Equation::Energy)     ] = 0.5 * one_cc * gruneisen_roe_ave;
+
+
+  // RIGHT EIGENVECTORS *********************************************
+  // ****************************************************************
+
+  // Mass equation entries of right eigenvectors
+  right_eigenvector[   ETI(Equation::Mass)      ][      0     ] = 1.0;
+  if constexpr( CC::DIM() != Dimension::One )
+     right_eigenvector[ETI(Equation::Mass)      ][      1     ] = 0.0;
+  if constexpr( CC::DIM() == Dimension::Three )
+     right_eigenvector[ETI(Equation::Mass)      ][      2     ] = 0.0;
+  right_eigenvector[   ETI(Equation::Mass)      ][ev_principal] = gruneisen_roe_ave;
+  right_eigenvector[   ETI(Equation::Mass)      ][MF::ANOE()-1] = 1.0;
+
+  // principal momentum equation entries
+  right_eigenvector[   ETI(MF::AME()[principal])][      0     ] = principal_velocity_roe_ave - c;
+  if constexpr( CC::DIM() != Dimension::One )
+     right_eigenvector[ETI(MF::AME()[principal])][      1     ] = 0.0;
+  if constexpr( CC::DIM() == Dimension::Three )
+     right_eigenvector[ETI(MF::AME()[principal])][      2     ] = 0.0;
+  right_eigenvector[   ETI(MF::AME()[principal])][ev_principal] = gruneisen_roe_ave * principal_velocity_roe_ave;
+  right_eigenvector[   ETI(MF::AME()[principal])][MF::ANOE()-1] = principal_velocity_roe_ave + c;
+
+  if constexpr( CC::DIM() != Dimension::One ) {
+     // first minor momentum equation entries
+     right_eigenvector[   ETI(MF::AME()[minor1])][      0     ] = minor1_velocity_roe_ave;
+     right_eigenvector[   ETI(MF::AME()[minor1])][      1     ] = -density_roe_ave;
+     if constexpr( CC::DIM() == Dimension::Three )
+        right_eigenvector[ETI(MF::AME()[minor1])][      2     ] = 0.0;
+     right_eigenvector[   ETI(MF::AME()[minor1])][ev_principal] = gruneisen_roe_ave * minor1_velocity_roe_ave;
+     right_eigenvector[   ETI(MF::AME()[minor1])][MF::ANOE()-1] = minor1_velocity_roe_ave;
+  }
+
+  if constexpr( CC::DIM() == Dimension::Three ) {
+     // second minor momentum equation entries
+     right_eigenvector[ETI(MF::AME()[minor2])   ][      0     ] = minor2_velocity_roe_ave;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][      1     ] = 0.0;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][      2     ] = density_roe_ave;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][ev_principal] = gruneisen_roe_ave * minor2_velocity_roe_ave;
+     right_eigenvector[ETI(MF::AME()[minor2])   ][MF::ANOE()-1] = minor2_velocity_roe_ave;
+  }
+
+  // Energy equation entries
+  right_eigenvector[   ETI(Equation::Energy)    ][      0     ] = enthalpy_roe_ave - principal_velocity_roe_ave * c;
+  if constexpr( CC::DIM() != Dimension::One )
+     right_eigenvector[ETI(Equation::Energy)    ][      1     ] = -minor1_velocity_roe_ave * density_roe_ave;
+  if constexpr( CC::DIM() == Dimension::Three )
+     right_eigenvector[ETI(Equation::Energy)    ][      2     ] = density_roe_ave * minor2_velocity_roe_ave;
+  right_eigenvector[   ETI(Equation::Energy)    ][ev_principal] = gruneisen_roe_ave * enthalpy_roe_ave - c*c;
+  right_eigenvector[   ETI(Equation::Energy)    ][MF::ANOE()-1] = enthalpy_roe_ave + principal_velocity_roe_ave * c;
+
+
+  // The eigenvalues are only required for flux-splitting schemes
+  if constexpr( !compute_eigenvalues ) {
+     return true;
+  }
+
+  // EIGENVALUES ****************************************************
+  // ****************************************************************
+
+  // Flux-function artificial viscosity -> Roe eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe ) {
+     SaveForAllFields( eigenvalues,
+        std::abs(principal_velocity_roe_ave - c),
+        std::abs(principal_velocity_roe_ave),
+        std::abs(principal_velocity_roe_ave + c) );
+  }
+
+  // Flux-function artificial viscosity -> Roe-M eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::Roe_M ) {
+     SaveForAllFields( eigenvalues,
+        std::abs( principal_velocity_roe_ave - std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ),
+        std::abs( principal_velocity_roe_ave ),
+        std::abs( principal_velocity_roe_ave + std::min( c, FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_roe_ave ) ) ) );
+  }
+
+  // Flux-function artificial viscosity -> Local-Lax-Friedrichs eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs ) {
+     double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
+     double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
+
+     SaveForAllFields( eigenvalues,
+        std::max(std::abs(principal_velocity_target - c_target),std::abs(principal_velocity_neighbor - c_neighbor)),
+        std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
+        std::max(std::abs(principal_velocity_target + c_target),std::abs(principal_velocity_neighbor + c_neighbor)) );
+  }
+
+  // Flux-function artificial viscosity -> LLF-M eigenvalues
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::LocalLaxFriedrichs_M ) {
+     double const c_target   = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_target,   pressure_target);
+     double const c_neighbor = material_manager_.GetMaterial(material).GetEquationOfState().SpeedOfSound(rho_neighbor, pressure_neighbor);
+
+     double const c_target_m   = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_target )  , c_target );
+     double const c_neighbor_m = std::min( FluxSplittingSettings::low_mach_number_limit_factor * std::abs( principal_velocity_neighbor ), c_neighbor );
+
+     SaveForAllFields( eigenvalues,
+        std::max(std::abs(principal_velocity_target - c_target_m),std::abs(principal_velocity_neighbor - c_neighbor_m)),
+        std::max(std::abs(principal_velocity_target), std::abs(principal_velocity_neighbor)),
+        std::max(std::abs(principal_velocity_target + c_target_m),std::abs(principal_velocity_neighbor + c_neighbor_m)) );
+  }
+
+  // Flux-function artificial viscosity -> Global-Lax-Friedrichs or LaxFriedrichs scheme
+  if constexpr( FluxSplittingSettings::flux_splitting_scheme == FluxSplitting::GlobalLaxFriedrichs ) {
+     for(unsigned int l = 0; l < MF::ANOE(); ++l) {
+        eigenvalues[l] = global_eigenvalues_[0][l];
+     }
+  }
+  // clang-format on
+
+  return true;
 }
 
 #endif // EIGENVALUE_CALCULATOR_H
@@ -175,6 +175,34 @@ constexpr bool TopInSiblingPack(nid_t const id) { return (id & 0x4) == 4; }
 constexpr bool BottomInSiblingPack(nid_t const id) { return (id & 0x4) == 0; }
 /**@}*/
 
+/**
+ * @brief Indicates whether the given face of a node lies on the boundary of its
+ * parent, i.e. whether the node is most east among its siblings for the east
+ * face (other locations respectively).
+ * @param id The id of the node.
+ * @param location The natural boundary location of the face.
+ * @return True if the face is part of the parent's face, False otherwise.
+ */
+constexpr bool FaceOnParentBoundary(nid_t const id,
+                                    BoundaryLocation const location) {
+  switch (location) {
+  case BoundaryLocation::East:
+    return EastInSiblingPack(id);
+  case BoundaryLocation::West:
+    return WestInSiblingPack(id);
+  case BoundaryLocation::North:
+    return NorthInSiblingPack(id);
+  case BoundaryLocation::South:
+    return SouthInSiblingPack(id);
+  case BoundaryLocation::Top:
+    return TopInSiblingPack(id);
+  case BoundaryLocation::Bottom:
+    return BottomInSiblingPack(id);
+  default:
+    return false;
+  }
+}
+
 /**
  * @brief Gives the Ids of all eight children of a Node.
  * @param id The Id of the parent node
@@ -170,14 +170,12 @@ std::vector<MaterialName> Node::GetMaterials() const {
  * @brief Gives the data of the phases present in this node.
  * @return Vector of block data.
  */
-std::unordered_map<MaterialName, Block> &Node::GetPhases() { return phases_; }
+PhaseMap &Node::GetPhases() { return phases_; }
 
 /**
  * @brief Const overload.
  */
-std::unordered_map<MaterialName, Block> const &Node::GetPhases() const {
-  return phases_;
-}
+PhaseMap const &Node::GetPhases() const { return phases_; }
 
 /**
  * @brief Returns the material data of the respective material.
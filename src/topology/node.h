@@ -27,12 +27,22 @@
 #include <vector>
 
 #include "block_definitions/block.h"
+#include "block_definitions/block_pool.h"
 #include "block_definitions/interface_block.h"
 #include "boundary_condition/boundary_specifications.h"
 #include "enums/interface_tag_definition.h"
 #include "materials/material_definitions.h"
 #include "topology/id_information.h"
 
+/**
+ * @brief Map of the blocks of all phases in a node. The blocks are stored in
+ * the block pool.
+ */
+using PhaseMap =
+    std::unordered_map<MaterialName, Block, std::hash<MaterialName>,
+                       std::equal_to<MaterialName>,
+                       PooledAllocator<std::pair<MaterialName const, Block>>>;
+
 /**
  * @brief Nodes are the members in the tree. A node holds a block for every
  * phase it contains; the Block then holds the material data. Node is a
@@ -44,7 +54,7 @@ class Node {
 
   double const node_size_;
   std::tuple<double const, double const, double const> const node_coordinates_;
-  std::unordered_map<MaterialName, Block> phases_;
+  PhaseMap phases_;
 
   // type std::int8_t due to definition of enum InterfaceTag. Needs to be
   // changed in case the enum type changes.
@@ -82,8 +92,8 @@ public:
   Block const &GetPhaseByMaterial(MaterialName const material) const;
   MaterialName GetSinglePhaseMaterial() const;
   std::vector<MaterialName> GetMaterials() const;
-  std::unordered_map<MaterialName, Block> &GetPhases();
-  std::unordered_map<MaterialName, Block> const &GetPhases() const;
+  PhaseMap &GetPhases();
+  PhaseMap const &GetPhases() const;
 
   void AddPhase(MaterialName const material);
   void RemovePhase(MaterialName const material);
@@ -22,6 +22,7 @@
 #ifndef SPACE_FILLING_CURVE_ORDER_H
 #define SPACE_FILLING_CURVE_ORDER_H
 
+#include "topology/id_information.h"
 #include "topology/node_id_type.h"
 #include "topology/space_filling_curve_index.h"
 #include "user_specifications/space_filling_curve_settings.h"
@@ -46,4 +47,31 @@ void OrderNodeIdsBySpaceFillingCurve(std::vector<nid_t> &ids_to_sort,
       [&index](nid_t const a, nid_t const b) { return index(a) < index(b); });
 }
 
+/**
+ * @brief Sorts a list of node ids, which may reside on different levels,
+ * according to the provided space-filling curve. Each node is ranked by the
+ * index of its first descendant on the given level. As the descendants of a
+ * node occupy a contiguous section of the curve, the leaves of all levels are
+ * brought into one consistent order.
+ * @param ids_to_sort The unsorted indices, which get sorted by this function.
+ * Indirect return parameter.
+ * @param maximum_level The level on which the indices are compared. Must not be
+ * smaller than the level of any of the given ids.
+ * @param index The index function of the respective space-filling curve.
+ */
+template <typename SpaceFillingCurveIndexFunction =
+              decltype(SpaceFillingCurveSettings::SfcIndex)>
+void OrderNodeIdsOfAllLevelsBySpaceFillingCurve(
+    std::vector<nid_t> &ids_to_sort, unsigned int const maximum_level,
+    SpaceFillingCurveIndexFunction index =
+        SpaceFillingCurveSettings::SfcIndex) {
+  auto const index_on_maximum_level = [&index, maximum_level](nid_t const id) {
+    return index(id << (3 * (maximum_level - LevelOfNode(id))));
+  };
+  std::sort(std::begin(ids_to_sort), std::end(ids_to_sort),
+            [&index_on_maximum_level](nid_t const a, nid_t const b) {
+              return index_on_maximum_level(a) < index_on_maximum_level(b);
+            });
+}
+
 #endif // SPACE_FILLING_CURVE_ORDER_H
@@ -22,7 +22,11 @@
 #include "topology_manager.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <mpi.h>
 #include <numeric>
 #include <stdexcept>
@@ -65,6 +69,128 @@ std::vector<std::size_t> ElementsPerRank(std::size_t const number_of_elements,
   return elements_per_rank;
 }
 
+/**
+ * @brief Gives a count of elements that should be on each respective rank to
+ * obtain a balanced load if the elements differ in cost. The ordered elements
+ * are cut into contiguous chunks of (approximately) equal cost.
+ * @param costs The costs of the elements in the order they are distributed.
+ * @param number_of_ranks The amount of ranks to distribute the elements onto.
+ * @return Vector of size number_of_ranks. Each entry gives the amount of
+ * elements the respective rank should hold in a well-balanced scenario.
+ * @note Each element is given to the rank whose share of the total cost holds
+ * the midpoint of the element's cost.
+ */
+std::vector<std::size_t> ElementsPerRankByCost(std::vector<double> const &costs,
+                                               int const number_of_ranks) {
+  std::size_t const rank_count = static_cast<std::size_t>(number_of_ranks);
+  double const total_cost =
+      std::accumulate(std::cbegin(costs), std::cend(costs), 0.0);
+  std::vector<std::size_t> elements_per_rank(rank_count, 0);
+  double preceding_cost = 0.0;
+  for (double const cost : costs) {
+    double const share = (preceding_cost + 0.5 * cost) / total_cost;
+    std::size_t const rank = std::min(
+        rank_count - 1, static_cast<std::size_t>(share * rank_count));
+    elements_per_rank[rank]++;
+    preceding_cost += cost;
+  }
+  return elements_per_rank;
+}
+
+/**
+ * @brief Gives the coarsest level on which the ancestors of two leaves differ.
+ * A cut of the space-filling curve between the two leaves splits the subtrees
+ * of all their common ancestors, i.e. those on the levels below the returned
+ * one.
+ * @param a, b The ids of the two leaves.
+ * @return The level on which the ancestors differ first.
+ */
+unsigned int SplitLevel(nid_t const a, nid_t const b) {
+  unsigned int const level_a = LevelOfNode(a);
+  unsigned int const level_b = LevelOfNode(b);
+  unsigned int level = 0;
+  while (level <= std::min(level_a, level_b) &&
+         (a >> (3 * (level_a - level))) == (b >> (3 * (level_b - level)))) {
+    level++;
+  }
+  return level;
+}
+
+/**
+ * @brief Gives a count of elements that should be on each respective rank if
+ * the elements differ in cost and subtrees should not be split. Each cut is
+ * placed on the boundary of the coarsest subtree that lies within the given
+ * tolerance around the balanced cut.
+ * @param leaves The ids of the leaves in the order they are distributed.
+ * @param costs The costs of the leaves in the same order.
+ * @param number_of_ranks The amount of ranks to distribute the elements onto.
+ * @param tolerance The allowed deviation of a cut from the balanced cut
+ * relative to the average cost per rank.
+ * @return Vector of size number_of_ranks. Each entry gives the amount of
+ * elements the respective rank should hold.
+ * @note Without a subtree boundary in the tolerance window the cut closest to
+ * the balanced cut is taken.
+ */
+std::vector<std::size_t>
+ElementsPerRankBySubtreeAffineCost(std::vector<nid_t> const &leaves,
+                                   std::vector<double> const &costs,
+                                   int const number_of_ranks,
+                                   double const tolerance) {
+  std::size_t const rank_count = static_cast<std::size_t>(number_of_ranks);
+  // Cost preceding each possible cut position
+  std::vector<double> preceding_costs(costs.size() + 1, 0.0);
+  std::partial_sum(std::cbegin(costs), std::cend(costs),
+                   std::next(std::begin(preceding_costs)));
+  double const average_cost = preceding_costs.back() / rank_count;
+  // Level-zero trees are never split by a cut at the ends of the curve
+  auto const split_level = [&leaves](std::size_t const cut) {
+    return cut == 0 || cut == leaves.size()
+               ? 0u
+               : SplitLevel(leaves[cut - 1], leaves[cut]);
+  };
+
+  std::vector<std::size_t> elements_per_rank(rank_count, 0);
+  std::size_t previous_cut = 0;
+  for (std::size_t rank = 1; rank < rank_count; ++rank) {
+    double const balanced_cost = rank * average_cost;
+    auto const first = std::next(std::cbegin(preceding_costs), previous_cut);
+    auto const closest = std::lower_bound(first, std::cend(preceding_costs),
+                                          balanced_cost);
+    std::size_t cut = std::distance(std::cbegin(preceding_costs), closest);
+    if (closest == std::cend(preceding_costs) ||
+        (closest != first && balanced_cost - *std::prev(closest) <
+                                 *closest - balanced_cost)) {
+      cut--;
+    }
+
+    // Search the coarsest subtree boundary within the tolerance
+    unsigned int best_level = split_level(cut);
+    double best_deviation = std::abs(preceding_costs[cut] - balanced_cost);
+    auto const window_begin =
+        std::lower_bound(first, std::cend(preceding_costs),
+                         balanced_cost - tolerance * average_cost);
+    auto const window_end =
+        std::upper_bound(window_begin, std::cend(preceding_costs),
+                         balanced_cost + tolerance * average_cost);
+    for (auto it = window_begin; it != window_end; ++it) {
+      std::size_t const candidate =
+          std::distance(std::cbegin(preceding_costs), it);
+      unsigned int const level = split_level(candidate);
+      double const deviation = std::abs(*it - balanced_cost);
+      if (level < best_level ||
+          (level == best_level && deviation < best_deviation)) {
+        cut = candidate;
+        best_level = level;
+        best_deviation = deviation;
+      }
+    }
+    elements_per_rank[rank - 1] = cut - previous_cut;
+    previous_cut = cut;
+  }
+  elements_per_rank.back() = leaves.size() - previous_cut;
+  return elements_per_rank;
+}
+
 /**
  * @brief Checks if the given node is a multiphase node.
  * @param node Topology node that is to be checked for the multiphase condition.
@@ -74,6 +200,16 @@ bool IsMultiPhase(TopologyNode const &node) {
   return node.NumberOfMaterials() > 1;
 }
 
+/**
+ * @brief Gives the number of time steps a node performs during one time step on
+ * level zero.
+ * @param id The id of the node.
+ * @return The number of time steps.
+ */
+double TimeStepsPerLevelZeroTimeStep(nid_t const id) {
+  return static_cast<double>(std::uint64_t{1} << LevelOfNode(id));
+}
+
 /**
  * @brief Creates a vector with elements from max_value in descending order
  * until zero included.
@@ -97,15 +233,27 @@ std::vector<unsigned int> ElementsDescendingFrom(unsigned int const max_value) {
  * blocks on level zero in the x/y/z-axis extension.
  * @param active_periodic_locations Side of the domain on which periodic
  * boundaries are activated.
+ * @param cost_weighted_load_balancing Indicates whether the leaves are
+ * distributed in chunks of equal cost rather than equal count per level.
+ * @param subtree_affine_load_balancing Indicates whether the leaves are
+ * distributed in chunks of equal cost whose cuts are moved onto subtree
+ * boundaries.
  */
 TopologyManager::TopologyManager(
     std::array<unsigned int, 3> const level_zero_blocks,
     unsigned int const maximum_level,
-    unsigned int const active_periodic_locations)
+    unsigned int const active_periodic_locations,
+    bool const cost_weighted_load_balancing,
+    bool const subtree_affine_load_balancing)
     : maximum_level_(maximum_level),
       active_periodic_locations_(active_periodic_locations),
-      number_of_nodes_on_level_zero_(level_zero_blocks), forest_{},
-      coarsenings_since_load_balance_{0}, refinements_since_load_balance_{0} {
+      number_of_nodes_on_level_zero_(level_zero_blocks),
+      cost_weighted_load_balancing_(cost_weighted_load_balancing),
+      subtree_affine_load_balancing_(subtree_affine_load_balancing),
+      multi_phase_leaf_cost_(CC::MultiPhaseLeafCost()),
+      leaf_cost_sample_{0.0, 0.0, 0.0}, forest_{},
+      coarsenings_since_load_balance_{0}, refinements_since_load_balance_{0},
+      revision_{0} {
   nid_t id = IdSeed();
 
   std::vector<nid_t> initialization_list;
@@ -145,90 +293,119 @@ TopologyManager::TopologyManager(
  * weights and material changes.
  * @return True if Communication_managers cache needs to be invalidated.
  * @note The coarsening list is specially guarded, it needs to be flushed before
- * it is considered here.
+ * it is considered here. All local changes are packed into a single buffer and
+ * distributed in one collective operation. The changes are applied in the order
+ * refinements, added materials, removed materials, each in ascending rank order.
  */
 bool TopologyManager::UpdateTopology() {
 
-  // Flag that specifies whether the communication manager should update its
-  // neighbor relations
-  bool invalidate_communication_manager_cache = false;
-  int const number_of_ranks = MpiUtilities::NumberOfRanks();
-
-  // Tree update
-  // refine
-  std::vector<nid_t> global_refine_list;
-  MpiUtilities::LocalToGlobalData(local_refine_list_, MPI_LONG_LONG_INT,
-                                  number_of_ranks, global_refine_list);
-
-  for (auto const &refine_id : global_refine_list) {
-    TopologyNode &parent = forest_.at(refine_id);
-    parent.MakeParent();
-    for (auto child_id : IdsOfChildren(refine_id)) {
-      forest_.emplace(std::piecewise_construct, std::make_tuple(child_id),
-                      std::make_tuple(parent.Rank()));
-    }
-  }
-  // Invalididate cache if any node has been refined
-  if (global_refine_list.size() > 0) {
-    invalidate_communication_manager_cache = true;
-  }
-
-  local_refine_list_.clear();
-
-  refinements_since_load_balance_ += global_refine_list.size();
-
-  // UPDATE MATERIALS OF NODES
-  std::tuple<std::vector<nid_t>, std::vector<MaterialName>>
-      global_materials_list;
-  MpiUtilities::LocalToGlobalData(std::get<0>(local_added_materials_list_),
-                                  MPI_LONG_LONG_INT, number_of_ranks,
-                                  std::get<0>(global_materials_list));
-  MpiUtilities::LocalToGlobalData(std::get<1>(local_added_materials_list_),
-                                  MPI_UNSIGNED_SHORT, number_of_ranks,
-                                  std::get<1>(global_materials_list));
-
 #ifndef PERFORMANCE
-  if (std::get<0>(global_materials_list).size() !=
-      std::get<1>(global_materials_list).size()) {
-    throw std::logic_error("Unequally sized material-add-lists encountered");
+  if (std::get<0>(local_added_materials_list_).size() !=
+          std::get<1>(local_added_materials_list_).size() ||
+      std::get<0>(local_removed_materials_list_).size() !=
+          std::get<1>(local_removed_materials_list_).size()) {
+    throw std::logic_error("Unequally sized material lists encountered");
   }
 #endif
 
-  for (unsigned int i = 0; i < std::get<0>(global_materials_list).size(); ++i) {
-    forest_.at(std::get<0>(global_materials_list)[i])
-        .AddMaterial(std::get<1>(global_materials_list)[i]);
+  // Each rank contributes a segment of the form: header ( number of refined
+  // nodes, added materials and removed materials ), refined ids, id-material
+  // pairs of added materials and id-material pairs of removed materials.
+  constexpr std::size_t header_size = 3;
+  std::vector<nid_t> local_changes;
+  local_changes.reserve(
+      header_size + local_refine_list_.size() +
+      2 * (std::get<0>(local_added_materials_list_).size() +
+           std::get<0>(local_removed_materials_list_).size()));
+  local_changes.push_back(local_refine_list_.size());
+  local_changes.push_back(std::get<0>(local_added_materials_list_).size());
+  local_changes.push_back(std::get<0>(local_removed_materials_list_).size());
+  local_changes.insert(std::end(local_changes), std::cbegin(local_refine_list_),
+                       std::cend(local_refine_list_));
+  for (auto const *const material_list :
+       {&local_added_materials_list_, &local_removed_materials_list_}) {
+    auto const &[ids, materials] = *material_list;
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+      local_changes.push_back(ids[i]);
+      local_changes.push_back(MTI(materials[i]));
+    }
   }
 
+  std::vector<nid_t> global_changes;
+  MpiUtilities::LocalToGlobalData(local_changes, MPI_LONG_LONG_INT,
+                                  MpiUtilities::NumberOfRanks(),
+                                  global_changes);
+
+  local_refine_list_.clear();
   std::get<0>(local_added_materials_list_).clear();
   std::get<1>(local_added_materials_list_).clear();
+  std::get<0>(local_removed_materials_list_).clear();
+  std::get<1>(local_removed_materials_list_).clear();
 
-  // We reuse the global list
-  std::get<0>(global_materials_list).clear();
-  std::get<1>(global_materials_list).clear();
-
-  MpiUtilities::LocalToGlobalData(std::get<0>(local_removed_materials_list_),
-                                  MPI_LONG_LONG_INT, number_of_ranks,
-                                  std::get<0>(global_materials_list));
-  MpiUtilities::LocalToGlobalData(std::get<1>(local_removed_materials_list_),
-                                  MPI_UNSIGNED_SHORT, number_of_ranks,
-                                  std::get<1>(global_materials_list));
+  // Gives the start of the segments ( refined ids, added materials, removed
+  // materials ) of each rank in the global changes
+  std::vector<std::array<std::size_t, header_size>> segment_starts;
+  for (std::size_t rank_start = 0; rank_start < global_changes.size();) {
+    std::size_t const refines = global_changes[rank_start];
+    std::size_t const added = global_changes[rank_start + 1];
+    std::size_t const removed = global_changes[rank_start + 2];
+    std::size_t const refine_start = rank_start + header_size;
+    segment_starts.push_back({refine_start, refine_start + refines,
+                              refine_start + refines + 2 * added});
+    rank_start = refine_start + refines + 2 * (added + removed);
+  }
+  auto const segment_end = [&segment_starts, &global_changes](
+                               std::size_t const rank,
+                               std::size_t const segment) {
+    if (segment + 1 < header_size) {
+      return segment_starts[rank][segment + 1];
+    }
+    return rank + 1 < segment_starts.size()
+               ? segment_starts[rank + 1][0] - header_size
+               : global_changes.size();
+  };
 
-#ifndef PERFORMANCE
-  if (std::get<0>(global_materials_list).size() !=
-      std::get<1>(global_materials_list).size()) {
-    throw std::logic_error("Created list of unequal length");
+  // Tree update
+  // refine
+  std::size_t number_of_refinements = 0;
+  for (std::size_t rank = 0; rank < segment_starts.size(); ++rank) {
+    for (std::size_t i = segment_starts[rank][0]; i < segment_end(rank, 0);
+         ++i) {
+      nid_t const refine_id = global_changes[i];
+      TopologyNode &parent = forest_.at(refine_id);
+      parent.MakeParent();
+      for (auto child_id : IdsOfChildren(refine_id)) {
+        forest_.emplace(std::piecewise_construct, std::make_tuple(child_id),
+                        std::make_tuple(parent.Rank()));
+      }
+      number_of_refinements++;
+    }
   }
-#endif
 
-  for (unsigned int i = 0; i < std::get<0>(global_materials_list).size(); ++i) {
-    forest_.at(std::get<0>(global_materials_list)[i])
-        .RemoveMaterial(std::get<1>(global_materials_list)[i]);
+  refinements_since_load_balance_ += number_of_refinements;
+
+  // UPDATE MATERIALS OF NODES
+  for (std::size_t rank = 0; rank < segment_starts.size(); ++rank) {
+    for (std::size_t i = segment_starts[rank][1]; i < segment_end(rank, 1);
+         i += 2) {
+      forest_.at(global_changes[i])
+          .AddMaterial(static_cast<MaterialName>(global_changes[i + 1]));
+    }
+  }
+  for (std::size_t rank = 0; rank < segment_starts.size(); ++rank) {
+    for (std::size_t i = segment_starts[rank][2]; i < segment_end(rank, 2);
+         i += 2) {
+      forest_.at(global_changes[i])
+          .RemoveMaterial(static_cast<MaterialName>(global_changes[i + 1]));
+    }
   }
 
-  std::get<0>(local_removed_materials_list_).clear();
-  std::get<1>(local_removed_materials_list_).clear();
+  if (global_changes.size() > header_size * segment_starts.size()) {
+    revision_++;
+  }
 
-  return invalidate_communication_manager_cache;
+  // Invalididate cache if any node has been refined
+  return number_of_refinements > 0;
 }
 
 /**
@@ -253,6 +430,7 @@ void TopologyManager::CoarseNodeWithId(nid_t const parent_id) {
       [&forest = forest_](auto const child_id) { forest.erase(child_id); });
   forest_.at(parent_id).MakeLeaf();
   coarsenings_since_load_balance_++;
+  revision_++;
 }
 
 /**
@@ -276,10 +454,15 @@ int TopologyManager::GetRankOfNode(nid_t const id) const {
  */
 std::vector<std::tuple<nid_t const, int const, int const>>
 TopologyManager::PrepareLoadBalancedTopology(int const number_of_ranks) {
-  AssignTargetRankToLeaves(number_of_ranks);
+  if (cost_weighted_load_balancing_ || subtree_affine_load_balancing_) {
+    AssignCostWeightedTargetRankToLeaves(number_of_ranks);
+  } else {
+    AssignTargetRankToLeaves(number_of_ranks);
+  }
   AssignTargetRankToParents();
   auto nodes_to_balance = NodesToBalance();
   SetCurrentRanksAccordingToTargetRanks();
+  revision_++;
   return nodes_to_balance;
 }
 
@@ -528,16 +711,16 @@ TopologyManager::LocalIdsOnLevel(unsigned int const level) const {
 
 /**
  * @brief Assigns the target rank to leaves ( rank on which the leaf SHOULD
- * reside ) such that leaves are distributed among all ranks equally.
+ * reside ) such that the leaves are cut into contiguous chunks of the given
+ * sizes.
  * @param leaves The list of leaves that are to be assigned with a target rank.
- * @param number_of_ranks The number of ranks available to distribute the load
- * onto.
+ * @param elements_per_rank The number of leaves each rank receives.
  */
 void TopologyManager::AssignTargetRanksToLeavesInList(
-    std::vector<nid_t> const &leaves, int const number_of_ranks) {
-  auto const elements_per_rank =
-      ElementsPerRank(leaves.size(), number_of_ranks);
+    std::vector<nid_t> const &leaves,
+    std::vector<std::size_t> const &elements_per_rank) {
   std::size_t start = 0;
+  int const number_of_ranks = static_cast<int>(elements_per_rank.size());
   for (int rank_id = 0; rank_id < number_of_ranks; ++rank_id) {
     for (std::size_t i = start; i < start + elements_per_rank[rank_id]; ++i) {
       forest_.at(leaves[i]).AssignTargetRank(rank_id);
@@ -567,8 +750,117 @@ void TopologyManager::AssignTargetRankToLeaves(int const number_of_ranks) {
     leaves.erase(start_multi, std::end(leaves));
     OrderNodeIdsBySpaceFillingCurve(leaves);
     OrderNodeIdsBySpaceFillingCurve(multiphase_leaves);
-    AssignTargetRanksToLeavesInList(leaves, number_of_ranks);
-    AssignTargetRanksToLeavesInList(multiphase_leaves, number_of_ranks);
+    AssignTargetRanksToLeavesInList(
+        leaves, ElementsPerRank(leaves.size(), number_of_ranks));
+    AssignTargetRanksToLeavesInList(
+        multiphase_leaves,
+        ElementsPerRank(multiphase_leaves.size(), number_of_ranks));
+  }
+}
+
+/**
+ * @brief Assigns the target rank to all leaves such that every rank holds a
+ * contiguous section of the space-filling curve of (approximately) equal cost.
+ * In contrast to AssignTargetRankToLeaves, the leaves of all levels and phases
+ * are distributed in a single cut of the curve. In the subtree-affine load
+ * balancing, the cuts are moved onto subtree boundaries where the balance
+ * allows, such that parents end up on the rank of all their children.
+ * @param number_of_ranks The number of ranks available to distribute the load
+ * onto.
+ */
+void TopologyManager::AssignCostWeightedTargetRankToLeaves(
+    int const number_of_ranks) {
+  std::vector<nid_t> leaves = LeafIds();
+  OrderNodeIdsOfAllLevelsBySpaceFillingCurve(leaves, maximum_level_);
+  std::vector<double> costs;
+  costs.reserve(leaves.size());
+  std::transform(std::cbegin(leaves), std::cend(leaves),
+                 std::back_inserter(costs), [this](nid_t const id) {
+                   return LeafCost(id, forest_.at(id));
+                 });
+  AssignTargetRanksToLeavesInList(
+      leaves, subtree_affine_load_balancing_
+                  ? ElementsPerRankBySubtreeAffineCost(
+                        leaves, costs, number_of_ranks,
+                        CC::SubtreeAffineCutTolerance())
+                  : ElementsPerRankByCost(costs, number_of_ranks));
+}
+
+/**
+ * @brief Gives the cost of a leaf in the cost-weighted load balancing, i.e. its
+ * number of time steps per level-zero time step weighted with the relative cost
+ * of multi-phase leaves.
+ * @param id The id of the leaf.
+ * @param node The topology node of the leaf.
+ * @return The cost of the leaf.
+ */
+double TopologyManager::LeafCost(nid_t const id,
+                                 TopologyNode const &node) const {
+  double const time_steps = TimeStepsPerLevelZeroTimeStep(id);
+  return IsMultiPhase(node) ? multi_phase_leaf_cost_ * time_steps : time_steps;
+}
+
+/**
+ * @brief Adds the updates of the local leaves on the given levels and the
+ * compute time spent on them to the sample of the next leaf cost calibration.
+ * Must be called before the leaves change, e.g. in remeshing or load balancing,
+ * such that the compute time is attributed to the leaves it was spent on.
+ * @param levels The levels whose leaves were updated.
+ * @param local_compute_time The compute time spent on the updates on this rank.
+ */
+void TopologyManager::AccumulateLeafCostSample(
+    std::vector<unsigned int> const &levels, double const local_compute_time) {
+  int const rank = MpiUtilities::MyRankId();
+  for (auto const &[id, node] : forest_) {
+    if (node.IsLeaf() && node.IsOnRank(rank) &&
+        std::find(std::cbegin(levels), std::cend(levels), LevelOfNode(id)) !=
+            std::cend(levels)) {
+      leaf_cost_sample_[IsMultiPhase(node) ? 1 : 0] += 1.0;
+    }
+  }
+  leaf_cost_sample_[2] += local_compute_time;
+}
+
+/**
+ * @brief Recalibrates the relative cost of multi-phase leaves from the compute
+ * times measured on all ranks. The compute time of each rank is modeled as the
+ * sum of its single- and multi-phase leaf updates, each multiplied with a
+ * per-leaf cost. The two per-leaf costs are fitted in a least-squares sense.
+ * The samples accumulated since the last calibration are used and reset.
+ * @note Collective operation. The previous cost is kept if the measurements do
+ * not determine the fit, e.g. without multi-phase leaves or on a single rank.
+ */
+void TopologyManager::CalibrateLeafCosts() {
+  std::array<double, 3> const local_sample = leaf_cost_sample_;
+  leaf_cost_sample_ = {0.0, 0.0, 0.0};
+  std::vector<double> samples(3 * MpiUtilities::NumberOfRanks());
+  MPI_Allgather(local_sample.data(), 3, MPI_DOUBLE, samples.data(), 3,
+                MPI_DOUBLE, MPI_COMM_WORLD);
+
+  // Normal equations of the least-squares fit
+  double single_single = 0.0;
+  double single_multi = 0.0;
+  double multi_multi = 0.0;
+  double single_time = 0.0;
+  double multi_time = 0.0;
+  for (std::size_t i = 0; i < samples.size(); i += 3) {
+    single_single += samples[i] * samples[i];
+    single_multi += samples[i] * samples[i + 1];
+    multi_multi += samples[i + 1] * samples[i + 1];
+    single_time += samples[i] * samples[i + 2];
+    multi_time += samples[i + 1] * samples[i + 2];
+  }
+  double const determinant =
+      single_single * multi_multi - single_multi * single_multi;
+  if (determinant <= 1.0e-8 * single_single * multi_multi) {
+    return;
+  }
+  double const single_phase_cost =
+      (single_time * multi_multi - multi_time * single_multi) / determinant;
+  double const multi_phase_cost =
+      (single_single * multi_time - single_multi * single_time) / determinant;
+  if (single_phase_cost > 0.0 && multi_phase_cost > 0.0) {
+    multi_phase_leaf_cost_ = multi_phase_cost / single_phase_cost;
   }
 }
 
@@ -753,6 +1045,23 @@ bool TopologyManager::IsLoadBalancingNecessary() {
   }
 }
 
+/**
+ * @brief Gives the cost of a multi-phase leaf relative to a single-phase leaf
+ * as used in the cost-weighted load balancing.
+ * @return The relative multi-phase leaf cost.
+ */
+double TopologyManager::GetMultiPhaseLeafCost() const {
+  return multi_phase_leaf_cost_;
+}
+
+/**
+ * @brief Gives a counter which increases with every change of the topology,
+ * i.e. of the node structure, the materials of the nodes or their ranks.
+ * @return The revision of the topology.
+ * @note Allows other classes to cache information derived from the topology.
+ */
+std::uint64_t TopologyManager::GetRevision() const { return revision_; }
+
 /**
  * @brief Gives the number of global nodes and leaves in a std::pair
  * @return std::pair<#Nodes, #Leaves>
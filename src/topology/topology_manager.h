@@ -26,6 +26,7 @@
 #include "topology/id_periodic_information.h"
 #include "topology_node.h"
 #include "user_specifications/compile_time_constants.h"
+#include <cstdint>
 #include <mpi.h>
 #include <unordered_map>
 #include <vector>
@@ -45,6 +46,15 @@ class TopologyManager {
   unsigned int const maximum_level_;
   unsigned int const active_periodic_locations_;
   std::array<unsigned int, 3> const number_of_nodes_on_level_zero_;
+  bool const cost_weighted_load_balancing_;
+  bool const subtree_affine_load_balancing_;
+
+  // Cost of a multi-phase leaf relative to a single-phase leaf, used in the
+  // cost-weighted load balancing
+  double multi_phase_leaf_cost_;
+  // Local single-phase leaf updates, multi-phase leaf updates and the compute
+  // time spent on them since the last calibration of the leaf costs
+  std::array<double, 3> leaf_cost_sample_;
 
   std::vector<nid_t> local_refine_list_;
 
@@ -63,13 +73,17 @@ class TopologyManager {
 
   unsigned int coarsenings_since_load_balance_;
   unsigned int refinements_since_load_balance_;
+  std::uint64_t revision_;
 
   void SetCurrentRanksAccordingToTargetRanks();
   std::vector<std::tuple<nid_t const, int const, int const>> NodesToBalance();
 
-  void AssignTargetRanksToLeavesInList(std::vector<nid_t> const &leaves,
-                                       int const number_of_ranks);
+  void AssignTargetRanksToLeavesInList(
+      std::vector<nid_t> const &leaves,
+      std::vector<std::size_t> const &elements_per_rank);
   void AssignTargetRankToLeaves(int const number_of_ranks);
+  void AssignCostWeightedTargetRankToLeaves(int const number_of_ranks);
+  double LeafCost(nid_t const id, TopologyNode const &node) const;
 
   void AssignTargetRankToParents();
 
@@ -78,7 +92,11 @@ public:
                                                                             1,
                                                                             1},
                            unsigned int const maximum_level = 0,
-                           unsigned int active_periodic_locations = 0);
+                           unsigned int active_periodic_locations = 0,
+                           bool const cost_weighted_load_balancing =
+                               CC::CostWeightedLoadBalancingActive(),
+                           bool const subtree_affine_load_balancing =
+                               CC::SubtreeAffineLoadBalancingActive());
   ~TopologyManager() = default;
   TopologyManager(TopologyManager const &) = delete;
   TopologyManager &operator=(TopologyManager const &) = delete;
@@ -138,6 +156,8 @@ public:
   std::array<unsigned int, 3> GetNumberOfNodesOnLevelZero() const;
   unsigned int GetCurrentMaximumLevel() const;
   bool IsLoadBalancingNecessary();
+  double GetMultiPhaseLeafCost() const;
+  std::uint64_t GetRevision() const;
 
   // Node listings:
   std::vector<nid_t> LocalLeafIds() const;
@@ -157,6 +177,9 @@ public:
   void RemoveMaterialFromNode(nid_t const id, MaterialName const material);
 
   bool UpdateTopology();
+  void AccumulateLeafCostSample(std::vector<unsigned int> const &levels,
+                                double const local_compute_time);
+  void CalibrateLeafCosts();
   std::vector<std::tuple<nid_t const, int const, int const>>
   PrepareLoadBalancedTopology(int const number_of_ranks);
   std::vector<unsigned int>
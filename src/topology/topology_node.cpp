@@ -23,11 +23,22 @@
 
 #include "topology/id_information.h"
 #include "user_specifications/compile_time_constants.h"
-#include "utilities/container_operations.h"
-#include <algorithm>
+#include <bit>
 
 namespace TNC = TopologyNodeConstants;
 
+namespace {
+/**
+ * @brief Gives the bit representing the given material in the material bit set
+ * of a topology node.
+ * @param material The material.
+ * @return The bit mask.
+ */
+constexpr std::uint8_t MaterialBit(MaterialName const material) {
+  return static_cast<std::uint8_t>(1u << MTI(material));
+}
+} // namespace
+
 /**
  * @brief Constructs a topology node as leaf without children, without assigning
  * a future rank and without materials.
@@ -35,7 +46,7 @@ namespace TNC = TopologyNodeConstants;
  */
 TopologyNode::TopologyNode(int const rank)
     : current_rank_(rank), target_rank_(TNC::unassigned_rank), is_leaf_(true),
-      materials_() {}
+      materials_(0) {}
 
 /**
  * @brief Constructs a topology node as leaf with the given materials, but
@@ -46,18 +57,19 @@ TopologyNode::TopologyNode(int const rank)
 TopologyNode::TopologyNode(std::vector<MaterialName> const &materials,
                            int const rank)
     : current_rank_(rank), target_rank_(TNC::unassigned_rank), is_leaf_(true),
-      materials_(ContainerOperations::SortedCopy(materials)) {}
+      materials_(0) {
+  for (MaterialName const material : materials) {
+    AddMaterial(material);
+  }
+}
 
 /**
  * @brief Adds the given material to the node.
  * @param material The material to be added to the node.
- * @note Does not perform checks if the material is already present. Inserting
- * the same material twice will lead to undefined behavior.
+ * @note Adding an already present material has no effect.
  */
 void TopologyNode::AddMaterial(MaterialName const material) {
-  materials_.insert(
-      std::upper_bound(std::begin(materials_), std::end(materials_), material),
-      material);
+  materials_ |= MaterialBit(material);
 }
 
 /**
@@ -65,30 +77,38 @@ void TopologyNode::AddMaterial(MaterialName const material) {
  * @param material The material to be removed from the node.
  */
 void TopologyNode::RemoveMaterial(MaterialName const material) {
-  materials_.erase(
-      std::remove(std::begin(materials_), std::end(materials_), material),
-      std::end(materials_));
+  materials_ &= static_cast<std::uint8_t>(~MaterialBit(material));
 }
 
 /**
  * @brief Gives the  materials present in the node.
- * @return The materials.
- */
-std::vector<MaterialName> TopologyNode::Materials() const { return materials_; }
+ * @return The materials in ascending order.
+ */
+std::vector<MaterialName> TopologyNode::Materials() const {
+  std::vector<MaterialName> materials;
+  materials.reserve(NumberOfMaterials());
+  for (std::uint8_t bits = materials_; bits != 0; bits &= bits - 1) {
+    materials.push_back(static_cast<MaterialName>(std::countr_zero(bits)));
+  }
+  return materials;
+}
 
 /**
  * @brief Gives the material of a single phase node.
  * @return The material.
- * @note If called on a multi-phase node result is undefined.
+ * @note If called on a multi-phase node the material with the lowest index is
+ * returned.
  */
-MaterialName TopologyNode::SingleMaterial() const { return materials_.front(); }
+MaterialName TopologyNode::SingleMaterial() const {
+  return static_cast<MaterialName>(std::countr_zero(materials_));
+}
 
 /**
  * @brief Gives the number of materials present in the node.
  * @return The number of materials.
  */
 std::size_t TopologyNode::NumberOfMaterials() const {
-  return materials_.size();
+  return std::popcount(materials_);
 }
 
 /**
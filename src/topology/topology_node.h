@@ -24,6 +24,7 @@
 
 #include "materials/material_definitions.h"
 #include "topology/node_id_type.h"
+#include <cstdint>
 #include <tuple>
 #include <vector>
 
@@ -35,13 +36,18 @@ constexpr int unassigned_rank = -1;
  * @brief The TopologyNode class organizes the light weight global ( over MPI
  * ranks ) node information in a tree structure. Allowing the TopologyManager
  * efficient searches.
+ * @note As every rank holds a topology node for each global node, its footprint
+ * is kept minimal. The materials are therefore stored as bit set ( bit i set
+ * <=> material with index i present ) instead of a dynamically allocated list.
  */
 class TopologyNode {
 
   int current_rank_;
   int target_rank_;
   bool is_leaf_;
-  std::vector<MaterialName> materials_;
+  std::uint8_t materials_;
+  static_assert(MTI(MaterialName::MaterialOutOfBounds) <= 8,
+                "Material bit set of topology nodes is too small");
 
 public:
   explicit TopologyNode(
@@ -21,7 +21,9 @@
 //===----------------------------------------------------------------------===//
 #include "tree.h"
 
+#include "communication/mpi_utilities.h"
 #include "topology/id_information.h"
+#include "topology/space_filling_curve_order.h"
 #include <stdexcept>
 
 /**
@@ -35,8 +37,9 @@
 Tree::Tree(TopologyManager const &topology, unsigned int const maximum_level,
            double const node_size_on_level_zero)
     : topology_(topology), node_size_on_level_zero_(node_size_on_level_zero),
-      nodes_(maximum_level + 1) // Level 0 + #Levels
-{
+      nodes_(maximum_level + 1), // Level 0 + #Levels
+      leaf_ids_on_level_(maximum_level + 1), interface_leaf_ids_{},
+      leaf_ids_valid_(false), leaf_ids_topology_revision_(0) {
   /** Empty besides initializer list */
 }
 
@@ -50,6 +53,7 @@ Tree::Tree(TopologyManager const &topology, unsigned int const maximum_level,
  */
 void Tree::InsertNode(nid_t const id, std::vector<MaterialName> const materials,
                       std::int8_t const interface_tag) {
+  leaf_ids_valid_ = false;
   nodes_[LevelOfNode(id)].emplace(
       std::piecewise_construct, std::forward_as_tuple(id),
       std::forward_as_tuple(id, node_size_on_level_zero_, materials,
@@ -69,6 +73,7 @@ Node &Tree::CreateNode(
     std::int8_t const (&interface_tags)[CC::TCX()][CC::TCY()][CC::TCZ()],
     std::unique_ptr<InterfaceBlock> interface_block) {
 
+  leaf_ids_valid_ = false;
   unsigned int const level = LevelOfNode(id);
   auto entry_and_decision = nodes_[level].emplace(
       std::piecewise_construct, std::forward_as_tuple(id),
@@ -93,6 +98,7 @@ Node &Tree::CreateNode(
 Node &Tree::CreateNode(nid_t const id,
                        std::vector<MaterialName> const &materials) {
 
+  leaf_ids_valid_ = false;
   unsigned int const level = LevelOfNode(id);
   auto entry_and_decision = nodes_[level].emplace(
       std::piecewise_construct, std::forward_as_tuple(id),
@@ -146,23 +152,65 @@ std::vector<nid_t> Tree::RefineNode(nid_t const id) {
  * undefiend behavior or exceptions will hunt you.
  */
 void Tree::RemoveNodeWithId(nid_t const id) {
+  leaf_ids_valid_ = false;
   unsigned int level = LevelOfNode(id);
   nodes_[level].erase(id);
 }
 
 /**
- * @brief Returns a list of all leaf nodes on this rank. $List is in arbitrary
- * order$.
+ * @brief Rebuilds the cached lists of local leaf and interface leaf ids if the
+ * tree or the topology changed since they were built. Only the local nodes are
+ * checked against the topology, no scan of the global topology is needed.
+ */
+void Tree::UpdateLeafIds() const {
+  if (leaf_ids_valid_ &&
+      leaf_ids_topology_revision_ == topology_.GetRevision()) {
+    return;
+  }
+
+  int const rank = MpiUtilities::MyRankId();
+  interface_leaf_ids_.clear();
+  for (unsigned int level = 0; level < nodes_.size(); ++level) {
+    std::vector<nid_t> &leaf_ids = leaf_ids_on_level_[level];
+    leaf_ids.clear();
+    for (auto const &id_node : nodes_[level]) {
+      nid_t const id = std::get<0>(id_node);
+      if (topology_.NodeExists(id) && topology_.NodeIsLeaf(id) &&
+          topology_.NodeIsOnRank(id, rank)) {
+        leaf_ids.push_back(id);
+      }
+    }
+    OrderNodeIdsBySpaceFillingCurve(leaf_ids);
+    for (nid_t const id : leaf_ids) {
+      if (topology_.IsNodeMultiPhase(id)) {
+        interface_leaf_ids_.push_back(id);
+      }
+    }
+  }
+
+  leaf_ids_valid_ = true;
+  leaf_ids_topology_revision_ = topology_.GetRevision();
+}
+
+/**
+ * @brief Returns a list of all leaf nodes on this rank. The leaves are ordered
+ * by level and along the space-filling curve within each level.
  * @return List of pointers to the leaves in this tree instance.
  */
 std::vector<std::reference_wrapper<Node>> Tree::Leaves() {
 
-  std::vector<nid_t> leaf_ids = topology_.LocalLeafIds();
+  UpdateLeafIds();
+  std::size_t number_of_leaves = 0;
+  for (auto const &leaf_ids : leaf_ids_on_level_) {
+    number_of_leaves += leaf_ids.size();
+  }
   std::vector<std::reference_wrapper<Node>> leaves;
-  leaves.reserve(leaf_ids.size());
+  leaves.reserve(number_of_leaves);
 
-  for (auto const &id : leaf_ids) {
-    leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
+  for (auto const &leaf_ids : leaf_ids_on_level_) {
+    for (auto const &id : leaf_ids) {
+      leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
+    }
   }
   return leaves;
 }
@@ -172,26 +220,33 @@ std::vector<std::reference_wrapper<Node>> Tree::Leaves() {
  */
 std::vector<std::reference_wrapper<Node const>> Tree::Leaves() const {
 
-  std::vector<nid_t> leaf_ids = topology_.LocalLeafIds();
+  UpdateLeafIds();
+  std::size_t number_of_leaves = 0;
+  for (auto const &leaf_ids : leaf_ids_on_level_) {
+    number_of_leaves += leaf_ids.size();
+  }
   std::vector<std::reference_wrapper<Node const>> leaves;
-  leaves.reserve(leaf_ids.size());
+  leaves.reserve(number_of_leaves);
 
-  for (auto const &id : leaf_ids) {
-    leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
+  for (auto const &leaf_ids : leaf_ids_on_level_) {
+    for (auto const &id : leaf_ids) {
+      leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
+    }
   }
   return leaves;
 }
 
 /**
- * @brief Gives a list of all leaves on the specified level. $List is in
- * arbitrary order$.
+ * @brief Gives a list of all leaves on the specified level. The leaves are
+ * ordered along the space-filling curve.
  * @param level The level of interest.
  * @return List of leaves.
  */
 std::vector<std::reference_wrapper<Node>>
 Tree::LeavesOnLevel(unsigned int const level) {
 
-  std::vector<nid_t> leaf_ids_on_level = topology_.LocalLeafIdsOnLevel(level);
+  UpdateLeafIds();
+  std::vector<nid_t> const &leaf_ids_on_level = leaf_ids_on_level_[level];
   std::vector<std::reference_wrapper<Node>> leaves;
   leaves.reserve(leaf_ids_on_level.size());
 
@@ -207,7 +262,8 @@ Tree::LeavesOnLevel(unsigned int const level) {
 std::vector<std::reference_wrapper<Node const>>
 Tree::LeavesOnLevel(unsigned int const level) const {
 
-  std::vector<nid_t> leaf_ids_on_level = topology_.LocalLeafIdsOnLevel(level);
+  UpdateLeafIds();
+  std::vector<nid_t> const &leaf_ids_on_level = leaf_ids_on_level_[level];
   std::vector<std::reference_wrapper<Node const>> leaves;
   leaves.reserve(leaf_ids_on_level.size());
 
@@ -225,8 +281,8 @@ Tree::LeavesOnLevel(unsigned int const level) const {
  */
 std::vector<std::reference_wrapper<Node>>
 Tree::NonLevelsetLeaves(unsigned int const level) {
-  std::vector<nid_t> const leaf_ids_on_level =
-      topology_.LocalLeafIdsOnLevel(level);
+  UpdateLeafIds();
+  std::vector<nid_t> const &leaf_ids_on_level = leaf_ids_on_level_[level];
   std::vector<std::reference_wrapper<Node>> non_levelset_leaves;
   non_levelset_leaves.reserve(leaf_ids_on_level.size());
 
@@ -245,8 +301,8 @@ Tree::NonLevelsetLeaves(unsigned int const level) {
  */
 std::vector<std::reference_wrapper<Node const>>
 Tree::NonLevelsetLeaves(unsigned int const level) const {
-  std::vector<nid_t> const leaf_ids_on_level =
-      topology_.LocalLeafIdsOnLevel(level);
+  UpdateLeafIds();
+  std::vector<nid_t> const &leaf_ids_on_level = leaf_ids_on_level_[level];
   std::vector<std::reference_wrapper<Node const>> non_levelset_leaves;
   non_levelset_leaves.reserve(leaf_ids_on_level.size());
 
@@ -267,11 +323,11 @@ Tree::NonLevelsetLeaves(unsigned int const level) const {
  */
 std::vector<std::reference_wrapper<Node const>> Tree::InterfaceLeaves() const {
 
-  std::vector<nid_t> interface_leaf_ids = topology_.LocalInterfaceLeafIds();
+  UpdateLeafIds();
   std::vector<std::reference_wrapper<Node const>> interface_leaves;
-  interface_leaves.reserve(interface_leaf_ids.size());
+  interface_leaves.reserve(interface_leaf_ids_.size());
 
-  for (auto const &id : interface_leaf_ids) {
+  for (auto const &id : interface_leaf_ids_) {
     interface_leaves.emplace_back(GetNodeWithId(id)); // We add this leaf
   }
   return interface_leaves;
@@ -25,6 +25,7 @@
 #include "block_definitions/interface_block.h"
 #include "node.h"
 #include "topology_manager.h"
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -47,8 +48,17 @@ class Tree {
   // all nodes contained in this tree ( current rank )
   std::vector<std::unordered_map<nid_t, Node>> nodes_;
 
+  // Cached ids of the local leaves on each level and of the local interface
+  // leaves in space-filling curve order. Rebuilt from the local nodes on the
+  // first request after a change of the tree or of the topology
+  mutable std::vector<std::vector<nid_t>> leaf_ids_on_level_;
+  mutable std::vector<nid_t> interface_leaf_ids_;
+  mutable bool leaf_ids_valid_;
+  mutable std::uint64_t leaf_ids_topology_revision_;
+
   void InsertNode(nid_t const id, std::vector<MaterialName> const materials,
                   std::int8_t const interface_tag);
+  void UpdateLeafIds() const;
 
 public:
   Tree() = delete;
@@ -21,6 +21,7 @@
 //===----------------------------------------------------------------------===//
 #include "user_expression.h"
 
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -77,3 +78,26 @@ double UserExpression::GetValue(std::string const variable) const {
   expression_.value();
   return symbol_table_.get_variable(variable)->value();
 }
+
+/**
+ * @brief Evaluates the expression once. The results can afterwards be read
+ * from all output variables without further evaluations.
+ */
+void UserExpression::Evaluate() const { expression_.value(); }
+
+/**
+ * @brief Gives a reference to the storage of the specified variable. It holds
+ * the value of the most recent evaluation and stays valid for the lifetime of
+ * the expression.
+ * @param variable The name of the variable whose storage should be returned.
+ * @return Reference to the value of the specified variable.
+ */
+double const &
+UserExpression::GetVariableReference(std::string const variable) const {
+  auto const variable_node = symbol_table_.get_variable(variable);
+  if (variable_node == nullptr) {
+    throw std::logic_error("Error in expression. Unknown variable: " +
+                           variable);
+  }
+  return variable_node->ref();
+}
@@ -68,6 +68,8 @@ public:
   UserExpression &operator=(UserExpression &&) = delete;
 
   double GetValue(std::string const variable) const;
+  void Evaluate() const;
+  double const &GetVariableReference(std::string const variable) const;
 };
 
 #endif // USER_EXPRESSION_H
@@ -136,6 +136,73 @@ class CompileTimeConstants {
   // doubled placed vertices
   static constexpr VertexFilterType output_vertex_filter_ =
       VertexFilterType::Mpi;
+  // Flag to write the mesh topology of an output only if the topology changed
+  // since the previous output of the same type. Otherwise, the hdf5 file links
+  // to the mesh topology of the previous file
+  static constexpr bool mesh_topology_reuse_active_ = false;
+  // Flag to write the standard and interface output block-structured, i.e. each
+  // block as a uniform patch given by its origin and cell spacing (instead of
+  // unstructured hexahedra given by vertex IDs and coordinates)
+  static constexpr bool block_structured_output_active_ = false;
+
+  // Flag to aggregate all no-jump halos exchanged with the same partner rank
+  // into a single message per halo update (instead of one message per node,
+  // location and material)
+  static constexpr bool aggregated_halo_exchange_active_ = false;
+
+  // Flag to bind the aggregated halo messages to persistent MPI requests which
+  // are reused until the halo relations are invalidated (requires aggregated
+  // halo exchange)
+  static constexpr bool persistent_halo_requests_active_ = false;
+
+  // Flag to compute the right-hand side of the next Runge-Kutta stage on leaves
+  // with rank-local halos while the mpi halo messages are in flight
+  static constexpr bool halo_update_overlap_active_ = false;
+
+  // Flag to write output and restart files on a background thread while the
+  // simulation continues (requires MPI_THREAD_MULTIPLE support)
+  static constexpr bool asynchronous_output_active_ = false;
+  // Maximum number of staged output and restart snapshots waiting to be written
+  // in the asynchronous mode. Bounds the additional memory.
+  static constexpr unsigned int asynchronous_output_queue_length_ = 2;
+
+  // Wall-clock seconds between two polls of the control file (CONTROLFILE and
+  // ABORTFILE in the output folder). Only rank zero polls, the commands are
+  // distributed with the time-step size reduction
+  static constexpr unsigned int control_file_poll_interval_ = 10;
+
+  // Flag to distribute the leaves of all levels in a single cut of the
+  // space-filling curve into chunks of equal cost (instead of equal leaf counts
+  // per level). A leaf costs its number of time steps per level-zero time step,
+  // multiplied by the relative cost below for multi-phase leaves
+  static constexpr bool cost_weighted_load_balancing_active_ = false;
+  // Modeled cost of a multi-phase leaf relative to a single-phase leaf
+  static constexpr double multi_phase_leaf_cost_ = 4.0;
+  // Flag to recalibrate the relative multi-phase leaf cost from the compute
+  // times measured on each rank since the previous load balancing (only takes
+  // effect in the cost-weighted or subtree-affine load balancing)
+  static constexpr bool measured_leaf_costs_active_ = false;
+  // Flag to distribute the leaves of all levels along the composite curve of the
+  // cost-weighted load balancing, but to move each cut onto the boundary of the
+  // coarsest possible subtree, such that parents and their children reside on
+  // the same rank. A cut may deviate from the balanced cut by the given fraction
+  // of the average cost per rank
+  static constexpr bool subtree_affine_load_balancing_active_ = false;
+  static constexpr double subtree_affine_cut_tolerance_ = 0.1;
+
+  // Flag to place blocks and interface blocks in slots of pooled slabs that
+  // are recycled after remeshing (instead of individual heap allocations). The
+  // slots of the children of one parent are placed contiguously
+  static constexpr bool pooled_block_storage_active_ = false;
+  // Flag to request transparent huge pages for the slabs of the block pools
+  // (Linux only, requires pooled block storage)
+  static constexpr bool huge_page_block_pools_active_ = false;
+
+  // Flag to store the initial buffer of the Runge-Kutta stages without halo
+  // cells. Only the average buffer is combined with it in the halos, where the
+  // values are either overwritten by the next halo update or stay constant
+  // over the stages (jump halos on the coarsest integrated level)
+  static constexpr bool halo_free_initial_buffer_active_ = false;
 
   /*** DEDUCED OR FIXED VALUES - MUST NOT BE CHANGED ***/
 
@@ -255,6 +322,16 @@ class CompileTimeConstants {
                   dimension_of_simulation_ == Dimension::Two) ||
                  axisymmetric_ == false),
                 "Axisymmetric case can only be run with DIM=2");
+  static_assert(asynchronous_output_queue_length_ > 0,
+                "The asynchronous output queue must hold at least one snapshot");
+  static_assert(!persistent_halo_requests_active_ ||
+                    aggregated_halo_exchange_active_,
+                "Persistent halo requests require the aggregated halo exchange");
+  static_assert(multi_phase_leaf_cost_ > 0.0,
+                "Multi-phase leaves must have a positive cost");
+  static_assert(subtree_affine_cut_tolerance_ >= 0.0 &&
+                    subtree_affine_cut_tolerance_ < 1.0,
+                "Subtree-affine cut tolerance must be in [0, 1)");
 
 public:
   CompileTimeConstants() = delete;
@@ -380,6 +457,39 @@ public:
                : 0;
   }
 
+  /**
+   * @brief Gives the number of cells per dimension in the initial buffer "IBC =
+   * Initial Buffer Cells", i.e. the internal cells if the initial buffer is
+   * stored halo-free and the total cells otherwise.
+   * @return Number of cells in the initial buffer. 1 if dimension does not
+   * exist.
+   */
+  static constexpr unsigned int IBCX() {
+    return halo_free_initial_buffer_active_ ? ICX() : TCX();
+  }
+  static constexpr unsigned int IBCY() {
+    return halo_free_initial_buffer_active_ ? ICY() : TCY();
+  }
+  static constexpr unsigned int IBCZ() {
+    return halo_free_initial_buffer_active_ ? ICZ() : TCZ();
+  }
+
+  /**
+   * @brief Gives the block index of the first cell in the initial buffer "IBO =
+   * Initial Buffer Offset", i.e. the first internal cell if the initial buffer
+   * is stored halo-free and zero otherwise.
+   * @return Block index of the first cell in the initial buffer.
+   */
+  static constexpr unsigned int IBOX() {
+    return halo_free_initial_buffer_active_ ? FICX() : 0;
+  }
+  static constexpr unsigned int IBOY() {
+    return halo_free_initial_buffer_active_ ? FICY() : 0;
+  }
+  static constexpr unsigned int IBOZ() {
+    return halo_free_initial_buffer_active_ ? FICZ() : 0;
+  }
+
   /**
    * @brief Indicates whether inviscid exchange processes are considered.
    * @return True if Euler equations are solved. False otherwise
@@ -754,6 +864,153 @@ public:
     return output_vertex_filter_;
   }
 
+  /**
+   * @brief Indicates whether outputs link to the mesh topology of the previous
+   * output of the same type if the topology did not change in between.
+   * @return Mesh topology reuse decision.
+   */
+  static constexpr bool MeshTopologyReuseActive() {
+    return mesh_topology_reuse_active_;
+  }
+
+  /**
+   * @brief Indicates whether the standard and interface output are written as
+   * uniform block patches instead of unstructured hexahedra.
+   * @return Block-structured output decision.
+   */
+  static constexpr bool BlockStructuredOutputActive() {
+    return block_structured_output_active_;
+  }
+
+  /**
+   * @brief Indicates whether the no-jump halos of all nodes are packed into a
+   * single message per partner rank during internal halo updates.
+   * @return Aggregated halo exchange decision.
+   */
+  static constexpr bool AggregatedHaloExchangeActive() {
+    return aggregated_halo_exchange_active_;
+  }
+
+  /**
+   * @brief Indicates whether the aggregated halo messages are sent via
+   * persistent MPI requests that are reused until the halo relations change.
+   * @return Persistent halo request decision.
+   */
+  static constexpr bool PersistentHaloRequestsActive() {
+    return persistent_halo_requests_active_;
+  }
+
+  /**
+   * @brief Indicates whether the halo update of intermediate Runge-Kutta stages
+   * is overlapped with the right-hand side computation of the next stage.
+   * @return Halo update overlap decision.
+   */
+  static constexpr bool HaloUpdateOverlapActive() {
+    return halo_update_overlap_active_;
+  }
+
+  /**
+   * @brief Indicates whether output and restart files are written on a
+   * background thread while the simulation continues.
+   * @return Asynchronous output decision.
+   */
+  static constexpr bool AsynchronousOutputActive() {
+    return asynchronous_output_active_;
+  }
+
+  /**
+   * @brief Gives the maximum number of staged snapshots waiting to be written
+   * in the asynchronous output mode.
+   * @return Length of the output queue.
+   */
+  static constexpr unsigned int AsynchronousOutputQueueLength() {
+    return asynchronous_output_queue_length_;
+  }
+
+  /**
+   * @brief Gives the wall-clock interval in which rank zero polls the control
+   * file.
+   * @return Poll interval in seconds.
+   */
+  static constexpr unsigned int ControlFilePollInterval() {
+    return control_file_poll_interval_;
+  }
+
+  /**
+   * @brief Indicates whether the leaves are distributed onto the ranks in
+   * chunks of equal cost along the space-filling curve.
+   * @return Cost-weighted load balancing decision.
+   */
+  static constexpr bool CostWeightedLoadBalancingActive() {
+    return cost_weighted_load_balancing_active_;
+  }
+
+  /**
+   * @brief Gives the modeled cost of a multi-phase leaf relative to a
+   * single-phase leaf.
+   * @return Relative multi-phase leaf cost.
+   */
+  static constexpr double MultiPhaseLeafCost() {
+    return multi_phase_leaf_cost_;
+  }
+
+  /**
+   * @brief Indicates whether the relative multi-phase leaf cost is recalibrated
+   * from measured compute times in cost-weighted or subtree-affine load
+   * balancing.
+   * @return Measured leaf cost decision.
+   */
+  static constexpr bool MeasuredLeafCostsActive() {
+    return (cost_weighted_load_balancing_active_ ||
+            subtree_affine_load_balancing_active_) &&
+           measured_leaf_costs_active_;
+  }
+
+  /**
+   * @brief Indicates whether the cuts of the cost-weighted load balancing are
+   * moved onto subtree boundaries.
+   * @return Subtree-affine load balancing decision.
+   */
+  static constexpr bool SubtreeAffineLoadBalancingActive() {
+    return subtree_affine_load_balancing_active_;
+  }
+
+  /**
+   * @brief Gives the allowed deviation of a subtree-affine cut from the
+   * balanced cut relative to the average cost per rank.
+   * @return Subtree-affine cut tolerance.
+   */
+  static constexpr double SubtreeAffineCutTolerance() {
+    return subtree_affine_cut_tolerance_;
+  }
+
+  /**
+   * @brief Indicates whether blocks and interface blocks are stored in pooled
+   * slabs.
+   * @return Pooled block storage decision.
+   */
+  static constexpr bool PooledBlockStorageActive() {
+    return pooled_block_storage_active_;
+  }
+
+  /**
+   * @brief Indicates whether the slabs of the block pools are backed by
+   * transparent huge pages.
+   * @return Huge page decision.
+   */
+  static constexpr bool HugePageBlockPoolsActive() {
+    return pooled_block_storage_active_ && huge_page_block_pools_active_;
+  }
+
+  /**
+   * @brief Indicates whether the initial buffer of the Runge-Kutta stages is
+   * stored without halo cells.
+   * @return Halo-free initial buffer decision.
+   */
+  static constexpr bool HaloFreeInitialBufferActive() {
+    return halo_free_initial_buffer_active_;
+  }
+
   /**
    * @brief Gives the number of topology changes that are allowed on each rank
    * (refinements, coarsenings) before load load balancing
@@ -41,7 +41,7 @@ constexpr LevelsetAdvectors levelset_advector =
     LevelsetAdvectors::HjReconstructionStencil;
 
 // LEVELSET_REINITIALIZER
-enum class LevelsetReinitializers { Min, Weno, Explicit };
+enum class LevelsetReinitializers { Min, Weno, FastSweeping, Explicit };
 constexpr LevelsetReinitializers levelset_reinitializer =
     LevelsetReinitializers::Weno;
 
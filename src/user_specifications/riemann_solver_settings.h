@@ -25,7 +25,16 @@
 #include "enums/flux_splitting.h"
 #include "enums/signal_speed.h"
 
-enum class ConvectiveTermSolvers { FluxSplitting, FiniteVolume };
+/* FiniteVolumePencil is a vectorizable variant of FiniteVolume that processes
+ * whole lines of cells at once. It supports the Euler/Navier-Stokes equations
+ * with Conservative or Primitive state reconstruction and the Hllc or Hll
+ * Riemann solver.
+ */
+enum class ConvectiveTermSolvers {
+  FluxSplitting,
+  FiniteVolume,
+  FiniteVolumePencil
+};
 constexpr ConvectiveTermSolvers convective_term_solver =
     ConvectiveTermSolvers::FluxSplitting;
 
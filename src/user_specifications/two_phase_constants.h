@@ -80,6 +80,17 @@ constexpr bool TrackConvergence = true;
  */
 constexpr double MaximumResiduum = 1.0e-3;
 
+/**
+ * The maximum number of rounds of block-wise sweeps (each followed by a halo
+ * update) used by the fast-sweeping reinitialization. Information travels
+ * through the whole block in one round, hence the narrow band needs only a few
+ * rounds. If TrackConvergence is set, the rounds stop earlier once the
+ * MaximumResiduum is met. Information crosses at most one block boundary per
+ * round, so the limit bounds the number of blocks the reinitialization band
+ * may span.
+ */
+constexpr unsigned int NumberOfFastSweepingRounds = 3;
+
 /**
  * Decision whether also cut cells are reinitialized.
  */
@@ -119,6 +130,27 @@ constexpr bool TrackConvergence = true;
  * The maximum residuum allowed if a convergence criteria is applied.
  */
 constexpr double MaximumResiduum = 1.0e-3;
+
+/**
+ * The number of iterations between two convergence checks (global reductions)
+ * if a convergence criteria is applied. 1 checks in every iteration. Larger
+ * values save global synchronizations at the cost of up to (interval - 1)
+ * additional iterations.
+ */
+constexpr unsigned int ConvergenceCheckInterval = 1;
+
+/**
+ * The number of iterations between two halo updates. The sweeps the halo size
+ * allows for between two halo updates are split among these iterations, i.e.
+ * the outdated halo layer never exceeds the halo size. 1 updates the halos in
+ * every iteration. Larger values check the convergence at a finer granularity,
+ * the maximum number of iterations is scaled by the interval. The extenders
+ * reject intervals larger than their sweeps per halo update at compile time.
+ */
+constexpr unsigned int HaloUpdateInterval = 1;
+
+static_assert(ConvergenceCheckInterval > 0 && HaloUpdateInterval > 0,
+              "Intervals must be positive");
 } // namespace ExtensionConstants
 
 namespace InterfaceStateTreatmentConstants {
@@ -151,6 +183,27 @@ constexpr bool TrackConvergence = true;
  * The maximum residuum allowed if a convergence criteria is applied.
  */
 constexpr double MaximumResiduum = 1.0e-3;
+
+/**
+ * The number of iterations between two convergence checks (global reductions)
+ * if a convergence criteria is applied. 1 checks in every iteration. Larger
+ * values save global synchronizations at the cost of up to (interval - 1)
+ * additional iterations.
+ */
+constexpr unsigned int ConvergenceCheckInterval = 1;
+
+/**
+ * The number of iterations between two halo updates. The sweeps the halo size
+ * allows for between two halo updates are split among these iterations, i.e.
+ * the outdated halo layer never exceeds the halo size. 1 updates the halos in
+ * every iteration. Larger values check the convergence at a finer granularity,
+ * the maximum number of iterations is scaled by the interval. The extenders
+ * reject intervals larger than their sweeps per halo update at compile time.
+ */
+constexpr unsigned int HaloUpdateInterval = 1;
+
+static_assert(ConvergenceCheckInterval > 0 && HaloUpdateInterval > 0,
+              "Intervals must be positive");
 } // namespace InterfaceStateExtensionConstants
 
 namespace IterativeInterfaceRiemannSolverConstants {
@@ -30,15 +30,16 @@ namespace BufferOperations {
 /**
  * @brief Sets all values of a single buffer to a certain given value.
  * @tparam T type of the cell values.
+ * @tparam SX, SY, SZ Number of cells per dimension of the buffer.
  * @param cells The buffer cells that are set to the value.
  * @param value The value that is set in all cells.
  */
-template <typename T>
-inline void SetSingleBuffer(T (&cells)[CC::TCX()][CC::TCY()][CC::TCZ()],
-                            T const value) {
-  for (unsigned int i = 0; i < CC::TCX(); ++i) {
-    for (unsigned int j = 0; j < CC::TCY(); ++j) {
-      for (unsigned int k = 0; k < CC::TCZ(); ++k) {
+template <typename T, unsigned int SX = CC::TCX(), unsigned int SY = CC::TCY(),
+          unsigned int SZ = CC::TCZ()>
+inline void SetSingleBuffer(T (&cells)[SX][SY][SZ], T const value) {
+  for (unsigned int i = 0; i < SX; ++i) {
+    for (unsigned int j = 0; j < SY; ++j) {
+      for (unsigned int k = 0; k < SZ; ++k) {
         cells[i][j][k] = value;
       }
     }
@@ -125,9 +126,7 @@ template <typename BufferType, typename T>
 inline void SetFieldBuffer(BufferType &buffer, T const value) {
   for (size_t field_index = 0; field_index < BufferType::GetNumberOfFields();
        ++field_index) {
-    T(&cells)
-    [CC::TCX()][CC::TCY()][CC::TCZ()] = buffer[field_index];
-    SetSingleBuffer(cells, value);
+    SetSingleBuffer(buffer[field_index], value);
   }
 }
 
@@ -147,9 +146,7 @@ SetFieldBuffer(BufferType &buffer,
                std::array<T, BufferType::GetNumberOfFields()> const &values) {
   for (size_t field_index = 0; field_index < BufferType::GetNumberOfFields();
        ++field_index) {
-    T(&cells)
-    [CC::TCX()][CC::TCY()][CC::TCZ()] = buffer[field_index];
-    SetSingleBuffer(cells, values[field_index]);
+    SetSingleBuffer(buffer[field_index], values[field_index]);
   }
 }
 
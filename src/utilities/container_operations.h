@@ -23,6 +23,7 @@
 #define CONTAINER_OPERATIONS_H
 
 #include <algorithm>
+#include <cstddef>
 #include <unordered_map>
 #include <utility>
 
@@ -116,6 +117,28 @@ template <typename Container> Container SortedCopy(Container const &unsorted) {
   return copy;
 }
 
+/**
+ * @brief Applies a function to all elements of the given container. If compiled
+ * with OpenMP, the elements are distributed among the threads of the rank,
+ * otherwise they are processed in order.
+ * @param c The container holding the elements.
+ * @param function The function to be applied to each element.
+ * @tparam RandomAccess Container type. Must provide random access via [].
+ * @tparam Function Callable taking a single element of the container.
+ * @note The function must only modify data belonging to the given element.
+ * Then the result does not depend on the number of threads. Exceptions must not
+ * leave the function if threads are used.
+ */
+template <typename RandomAccess, typename Function>
+void ForEachInParallel(RandomAccess const &c, Function const &function) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (std::size_t index = 0; index < c.size(); ++index) {
+    function(c[index]);
+  }
+}
+
 } // namespace ContainerOperations
 
 #endif // CONTAINER_OPERATIONS_H
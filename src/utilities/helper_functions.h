@@ -23,6 +23,7 @@
 #define HELPER_FUNCTIONS_H
 
 #include <array>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 
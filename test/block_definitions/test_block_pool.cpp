@@ -0,0 +1,165 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "block_definitions/block_pool.h"
+#include "block_definitions/interface_block.h"
+
+SCENARIO( "Slots of a slab pool are placed contiguously and recycled", "[1rank]" ) {
+   GIVEN( "A pool for objects of one kilobyte" ) {
+      SlabPool pool( 1024, alignof( double ) );
+      WHEN( "The slots for the children of one node are allocated" ) {
+         std::vector<char*> slots;
+         for( unsigned int child = 0; child < CC::NOC(); ++child ) {
+            slots.push_back( static_cast<char*>( pool.Allocate() ) );
+         }
+         THEN( "The slots are placed one after another in a single slab" ) {
+            REQUIRE( pool.NumberOfSlabs() == 1 );
+            REQUIRE( pool.SlotsInUse() == CC::NOC() );
+            REQUIRE( pool.SlotsPerSlab() % CC::NOC() == 0 );
+            for( unsigned int child = 1; child < CC::NOC(); ++child ) {
+               REQUIRE( slots[child] - slots[child - 1] == static_cast<std::ptrdiff_t>( pool.SlotSize() ) );
+            }
+         }
+         THEN( "Freed slots are recycled without a new slab" ) {
+            for( auto const slot : slots ) {
+               pool.Deallocate( slot );
+            }
+            REQUIRE( pool.SlotsInUse() == 0 );
+            std::vector<char*> recycled_slots;
+            for( unsigned int child = 0; child < CC::NOC(); ++child ) {
+               recycled_slots.push_back( static_cast<char*>( pool.Allocate() ) );
+            }
+            REQUIRE( recycled_slots == slots );
+            REQUIRE( pool.NumberOfSlabs() == 1 );
+         }
+      }
+   }
+}
+
+SCENARIO( "Slabs of a slab pool are returned when all their slots are free", "[1rank]" ) {
+   GIVEN( "A pool with all slots of three slabs in use" ) {
+      SlabPool pool( 1024, alignof( double ) );
+      std::vector<char*> slots;
+      for( std::size_t slot = 0; slot < 3 * pool.SlotsPerSlab(); ++slot ) {
+         slots.push_back( static_cast<char*>( pool.Allocate() ) );
+      }
+      REQUIRE( pool.NumberOfSlabs() == 3 );
+      WHEN( "The slots of the last slab are freed" ) {
+         for( std::size_t slot = 2 * pool.SlotsPerSlab(); slot < slots.size(); ++slot ) {
+            pool.Deallocate( slots[slot] );
+         }
+         THEN( "The free slab is kept" ) {
+            REQUIRE( pool.NumberOfSlabs() == 3 );
+         }
+         WHEN( "Also the slots of the first slab are freed" ) {
+            for( std::size_t slot = 0; slot < pool.SlotsPerSlab(); ++slot ) {
+               pool.Deallocate( slots[slot] );
+            }
+            THEN( "Only one free slab is kept" ) {
+               REQUIRE( pool.NumberOfSlabs() == 2 );
+               REQUIRE( pool.SlotsInUse() == pool.SlotsPerSlab() );
+            }
+            THEN( "Subsequent allocations reuse the kept slab" ) {
+               for( std::size_t slot = 0; slot < pool.SlotsPerSlab(); ++slot ) {
+                  pool.Allocate();
+               }
+               REQUIRE( pool.NumberOfSlabs() == 2 );
+            }
+         }
+      }
+      WHEN( "All slots are freed" ) {
+         for( auto const slot : slots ) {
+            pool.Deallocate( slot );
+         }
+         THEN( "A single slab is kept" ) {
+            REQUIRE( pool.NumberOfSlabs() == 1 );
+            REQUIRE( pool.SlotsInUse() == 0 );
+         }
+      }
+   }
+}
+
+SCENARIO( "Interface blocks are stored in their pool", "[1rank]" ) {
+   GIVEN( "The pool of interface blocks" ) {
+      SlabPool& pool                 = PoolOf<InterfaceBlock>();
+      std::size_t const slots_in_use = pool.SlotsInUse();
+      WHEN( "An interface block is created" ) {
+         std::unique_ptr<InterfaceBlock> interface_block = std::make_unique<InterfaceBlock>( 1.0 );
+         THEN( "It occupies a slot of the pool until it is destroyed" ) {
+            REQUIRE( pool.SlotsInUse() == slots_in_use + ( CC::PooledBlockStorageActive() ? 1 : 0 ) );
+            interface_block.reset();
+            REQUIRE( pool.SlotsInUse() == slots_in_use );
+         }
+      }
+   }
+}
@@ -71,6 +71,7 @@
 #include <vector>
 #include <algorithm>
 
+#include "block_definitions/block.h"
 #include "solvers/convective_term_contributions/convective_term_solver.h"
 
 SCENARIO( "Non-momentum equation indexing", "[1rank]" ) {
@@ -97,3 +98,34 @@ SCENARIO( "Non-momentum equation indexing", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Initial buffer layout", "[1rank]" ) {
+
+   GIVEN( "A freshly created block" ) {
+      Block const block;
+
+      WHEN( "The extents of the initial buffer are compared to the block" ) {
+         THEN( "The initial buffer holds the internal cells and, unless stored halo-free, the halo cells" ) {
+            REQUIRE( sizeof( block.GetInitialBuffer() ) == MF::ANOE() * CC::IBCX() * CC::IBCY() * CC::IBCZ() * sizeof( double ) );
+            REQUIRE( CC::IBOX() + CC::IBCX() <= CC::TCX() );
+            REQUIRE( CC::IBOX() <= CC::FICX() );
+            REQUIRE( CC::IBOX() + CC::IBCX() > CC::LICX() );
+         }
+      }
+
+      WHEN( "The values of the initial buffer are read" ) {
+         THEN( "All cells are zero" ) {
+            for( Equation const eq : MF::ASOE() ) {
+               double const ( &u_initial )[CC::IBCX()][CC::IBCY()][CC::IBCZ()] = block.GetInitialBuffer( eq );
+               for( unsigned int i = 0; i < CC::IBCX(); ++i ) {
+                  for( unsigned int j = 0; j < CC::IBCY(); ++j ) {
+                     for( unsigned int k = 0; k < CC::IBCZ(); ++k ) {
+                        REQUIRE( u_initial[i][j][k] == 0.0 );
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
@@ -67,12 +67,115 @@
 *                                                                                        *
 *****************************************************************************************/
 #include <catch2/catch.hpp>
+#include <array>
 #include "topology/topology_manager.h"
 #include "topology/tree.h"
 #include "communication/mpi_utilities.h"
 #include "topology/id_information.h"
 #include "communication/internal_halo_manager.h"
 
+namespace {
+   constexpr unsigned int number_of_nodes_in_x = 4;
+
+   /**
+    * @brief Gives the value a cell holds in a field of a material on level zero. The value is unique per global cell (periodic in x-direction),
+    *        material and field and exact in binary representation, such that a halo cell holds the value of the same global cell in the neighbor node.
+    * @param id Id of the level-zero node.
+    * @param material The material.
+    * @param field_index Index of the field.
+    * @param i,j,k Indices of the cell in the node including the halo cells.
+    * @return The cell value.
+    */
+   double GlobalCellValue( nid_t const id, MaterialName const material, unsigned int const field_index, int const i, int const j, int const k ) {
+      std::array<double, 3> const block_coordinates = DomainCoordinatesOfId( id, 1.0 );
+      int const cells_in_x = number_of_nodes_in_x * CC::ICX();
+      int const x          = ( ( static_cast<int>( block_coordinates[0] ) * CC::ICX() + i - static_cast<int>( CC::FICX() ) ) % cells_in_x + cells_in_x ) % cells_in_x;
+      double const y       = block_coordinates[1] * CC::ICY() + j;
+      double const z       = block_coordinates[2] * CC::ICZ() + k;
+      return ( ( ( x * 256.0 + y ) * 256.0 + z ) * 4.0 + static_cast<double>( MTI( material ) ) ) * 8.0 + static_cast<double>( field_index );
+   }
+
+   /**
+    * @brief Fills all cells of all fields of all materials present in the local level-zero nodes with their global cell value.
+    * @param tree The tree holding the nodes.
+    * @param field_type The field type to be filled.
+    * @param value_offset Offset added to all cell values.
+    */
+   void FillWithGlobalCellValues( Tree& tree, MaterialFieldType const field_type, double const value_offset = 0.0 ) {
+      for( auto& [id, node] : tree.FullNodeList().at( 0 ) ) {
+         for( auto& [material, block] : node.GetPhases() ) {
+            for( unsigned int f = 0; f < MF::ANOF( field_type ); ++f ) {
+               auto& cells = block.GetFieldBuffer( field_type, f );
+               for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+                  for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                     for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                        cells[i][j][k] = GlobalCellValue( id, material, f, i, j, k ) + value_offset;
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   /**
+    * @brief Counts the halo cells of the local level-zero nodes that do not hold the value of the same global cell in the neighbor node. Only halos
+    *        of materials present in both nodes are considered.
+    * @param tree The tree holding the nodes.
+    * @param topology The topology of the nodes.
+    * @param communication The communication manager giving the halo extents.
+    * @param field_type The field type to be checked.
+    * @param value_offset Offset added to all cell values when the domain cells were filled.
+    * @return Number of wrong halo cells.
+    */
+   unsigned int NumberOfWrongHaloCells( Tree const& tree, TopologyManager const& topology, CommunicationManager& communication,
+                                        MaterialFieldType const field_type, double const value_offset ) {
+      unsigned int wrong_cells = 0;
+      for( auto const& [id, node] : tree.FullNodeList().at( 0 ) ) {
+         for( BoundaryLocation const location : CC::HBS() ) {
+            nid_t const neighbor_id = topology.GetTopologyNeighborId( id, location );
+            if( !topology.NodeExists( neighbor_id ) ) continue;
+            auto const recv_indices = communication.GetStartIndicesHaloRecv( location );
+            auto const size         = communication.GetHaloSize( location );
+            for( auto const& [material, block] : node.GetPhases() ) {
+               if( !topology.NodeContainsMaterial( neighbor_id, material ) ) continue;
+               for( unsigned int f = 0; f < MF::ANOF( field_type ); ++f ) {
+                  auto const& cells = block.GetFieldBuffer( field_type, f );
+                  for( int i = recv_indices[0]; i < size[0] + recv_indices[0]; ++i ) {
+                     for( int j = recv_indices[1]; j < size[1] + recv_indices[1]; ++j ) {
+                        for( int k = recv_indices[2]; k < size[2] + recv_indices[2]; ++k ) {
+                           wrong_cells += cells[i][j][k] != GlobalCellValue( id, material, f, i, j, k ) + value_offset;
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+      return wrong_cells;
+   }
+
+   /**
+    * @brief Prepares a load-balanced single-level topology with several neighboring nodes in each dimension. All nodes contain the first material,
+    *        every second node in x-direction also the second one, such that the halo messages between two ranks mix nodes with one and two phases.
+    * @param topology The single-level topology.
+    * @param tree The tree for the local nodes.
+    */
+   void CreateMixedPhaseNodes( TopologyManager& topology, Tree& tree ) {
+      for( auto const id : topology.LocalLeafIds() ) {
+         topology.AddMaterialToNode( id, MaterialName::MaterialOne );
+         if( static_cast<unsigned int>( DomainCoordinatesOfId( id, 1.0 )[0] ) % 2 == 0 ) {
+            topology.AddMaterialToNode( id, MaterialName::MaterialTwo );
+         }
+      }
+      topology.UpdateTopology();
+      topology.PrepareLoadBalancedTopology( MpiUtilities::NumberOfRanks() );
+      for( auto const id : topology.LocalLeafIds() ) {
+         tree.CreateNode( id, topology.GetMaterialsOfNode( id ) );
+      }
+   }
+}// namespace
+
 SCENARIO( "Internal Halos can be updated correctly", "[1rank],[2rank]" ) {
    constexpr MaterialName material_one = MaterialName::MaterialOne;
    constexpr MaterialName material_two = MaterialName::MaterialTwo;
@@ -138,6 +241,42 @@ SCENARIO( "Internal Halos can be updated correctly", "[1rank],[2rank]" ) {
             }
          }
       }
+
+      WHEN( "Material values are set and halo-updated in split phases" ) {
+         for( auto& [id, node] : tree.FullNodeList().at( maximum_level ) ) {
+            auto& cells = node.GetPhaseByMaterial( material_one ).GetRightHandSideBuffer( Equation::Mass );
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     cells[i][j][k] = static_cast<double>( id );
+                  }
+               }
+            }
+         }
+
+         CommunicationManager communication = CommunicationManager( two_nodes_level_zero_topo, maximum_level );
+         InternalHaloManager internal_halos = InternalHaloManager( tree, two_nodes_level_zero_topo, communication, 1 );
+         internal_halos.BeginMaterialNoJumpHaloUpdate( { maximum_level }, MaterialFieldType::Conservatives );
+         internal_halos.EndMaterialNoJumpHaloUpdate( { maximum_level }, MaterialFieldType::Conservatives );
+
+         THEN( "All halo values contain the proper values from the neighbor node" ) {
+            for( auto& [id, node] : tree.FullNodeList().at( maximum_level ) ) {
+               auto const& cells = node.GetPhaseByMaterial( material_one ).GetRightHandSideBuffer( Equation::Mass );
+               for( auto const& side : { BoundaryLocation::East, BoundaryLocation::West, BoundaryLocation::North, BoundaryLocation::South } ) {
+                  if( !two_nodes_level_zero_topo.NodeExists( GetNeighborId( id, side ) ) ) continue;
+                  auto const recv_indices = communication.GetStartIndicesHaloRecv( side );
+                  auto const size         = communication.GetHaloSize( side );
+                  for( int i = recv_indices[0]; i < size[0] + recv_indices[0]; ++i ) {
+                     for( int j = recv_indices[1]; j < size[1] + recv_indices[1]; ++j ) {
+                        for( int k = recv_indices[2]; k < size[2] + recv_indices[2]; ++k ) {
+                           REQUIRE( cells[i][j][k] == static_cast<double>( GetNeighborId( id, side ) ) );
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
    }
 
    GIVEN( "The simplest all two-phase single-jump topology" ) {
@@ -222,3 +361,100 @@ SCENARIO( "Internal Halos can be updated correctly", "[1rank],[2rank]" ) {
       }
    }
 }
+
+SCENARIO( "Halos of several nodes and materials are exchanged correctly with the partner ranks", "[1rank],[2rank]" ) {
+   GIVEN( "A load-balanced single-level topology of mixed single- and two-phase nodes, periodic in x-direction" ) {
+      constexpr unsigned int maximum_level = 0;
+      TopologyManager topology             = TopologyManager( { number_of_nodes_in_x, CC::DIM() != Dimension::One ? 2u : 1u, CC::DIM() == Dimension::Three ? 2u : 1u },
+                                                              maximum_level, PeriodicBoundariesLocations::EastWest );
+      Tree tree                            = Tree( topology, maximum_level, 1.0 );
+      CreateMixedPhaseNodes( topology, tree );
+
+      if( MpiUtilities::NumberOfRanks() > 1 ) {
+         unsigned int remote_neighbors = 0;
+         for( auto const id : topology.LocalLeafIds() ) {
+            for( BoundaryLocation const location : CC::HBS() ) {
+               nid_t const neighbor_id = topology.GetTopologyNeighborId( id, location );
+               remote_neighbors += topology.NodeExists( neighbor_id ) && !topology.NodeIsOnRank( neighbor_id, MpiUtilities::MyRankId() );
+            }
+         }
+         REQUIRE( remote_neighbors > 1 );
+      }
+
+      WHEN( "The conservatives and the prime states are halo-updated" ) {
+         FillWithGlobalCellValues( tree, MaterialFieldType::Conservatives );
+         FillWithGlobalCellValues( tree, MaterialFieldType::PrimeStates );
+         CommunicationManager communication = CommunicationManager( topology, maximum_level );
+         InternalHaloManager internal_halos = InternalHaloManager( tree, topology, communication, 2 );
+         internal_halos.MaterialHaloUpdateOnLevel( maximum_level, MaterialFieldType::Conservatives, false );
+         internal_halos.MaterialHaloUpdateOnLevel( maximum_level, MaterialFieldType::PrimeStates, false );
+
+         THEN( "All halo cells of all materials and fields hold the values of the neighbor nodes" ) {
+            REQUIRE( NumberOfWrongHaloCells( tree, topology, communication, MaterialFieldType::Conservatives, 0.0 ) == 0 );
+            REQUIRE( NumberOfWrongHaloCells( tree, topology, communication, MaterialFieldType::PrimeStates, 0.0 ) == 0 );
+         }
+      }
+   }
+}
+
+SCENARIO( "Repeated halo updates stay correct when materials change or halo relations are invalidated between them", "[1rank],[2rank]" ) {
+   GIVEN( "A load-balanced single-level topology of mixed single- and two-phase nodes, periodic in x-direction" ) {
+      constexpr unsigned int maximum_level = 0;
+      TopologyManager topology             = TopologyManager( { number_of_nodes_in_x, CC::DIM() != Dimension::One ? 2u : 1u, CC::DIM() == Dimension::Three ? 2u : 1u },
+                                                              maximum_level, PeriodicBoundariesLocations::EastWest );
+      Tree tree                            = Tree( topology, maximum_level, 1.0 );
+      CreateMixedPhaseNodes( topology, tree );
+      CommunicationManager communication = CommunicationManager( topology, maximum_level );
+      InternalHaloManager internal_halos = InternalHaloManager( tree, topology, communication, 2 );
+
+      WHEN( "The conservatives are halo-updated several times with changing values" ) {
+         unsigned int wrong_cells = 0;
+         for( double const value_offset : { 0.0, 1.0e9, 2.0e9 } ) {
+            FillWithGlobalCellValues( tree, MaterialFieldType::Conservatives, value_offset );
+            internal_halos.MaterialHaloUpdateOnLevel( maximum_level, MaterialFieldType::Conservatives, false );
+            wrong_cells += NumberOfWrongHaloCells( tree, topology, communication, MaterialFieldType::Conservatives, value_offset );
+         }
+
+         THEN( "Each update provides the current values of the neighbor nodes" ) {
+            REQUIRE( wrong_cells == 0 );
+         }
+      }
+
+      WHEN( "The second material is added to all single-phase nodes between two halo updates" ) {
+         FillWithGlobalCellValues( tree, MaterialFieldType::Conservatives );
+         internal_halos.MaterialHaloUpdateOnLevel( maximum_level, MaterialFieldType::Conservatives, false );
+         unsigned int wrong_cells = NumberOfWrongHaloCells( tree, topology, communication, MaterialFieldType::Conservatives, 0.0 );
+
+         for( auto const id : topology.LocalLeafIds() ) {
+            if( !topology.NodeContainsMaterial( id, MaterialName::MaterialTwo ) ) {
+               topology.AddMaterialToNode( id, MaterialName::MaterialTwo );
+               tree.GetNodeWithId( id ).AddPhase( MaterialName::MaterialTwo );
+            }
+         }
+         // Changes in the materials leave the halo relations valid, only the message sizes grow
+         REQUIRE_FALSE( topology.UpdateTopology() );
+         FillWithGlobalCellValues( tree, MaterialFieldType::Conservatives, 1.0e9 );
+         internal_halos.MaterialHaloUpdateOnLevel( maximum_level, MaterialFieldType::Conservatives, false );
+         wrong_cells += NumberOfWrongHaloCells( tree, topology, communication, MaterialFieldType::Conservatives, 1.0e9 );
+
+         THEN( "The updates before and after the change provide the values of the neighbor nodes" ) {
+            REQUIRE( wrong_cells == 0 );
+         }
+      }
+
+      WHEN( "The halo relations are invalidated between two halo updates" ) {
+         FillWithGlobalCellValues( tree, MaterialFieldType::Conservatives );
+         internal_halos.MaterialHaloUpdateOnLevel( maximum_level, MaterialFieldType::Conservatives, false );
+         unsigned int wrong_cells = NumberOfWrongHaloCells( tree, topology, communication, MaterialFieldType::Conservatives, 0.0 );
+
+         communication.InvalidateCache();
+         FillWithGlobalCellValues( tree, MaterialFieldType::Conservatives, 1.0e9 );
+         internal_halos.MaterialHaloUpdateOnLevel( maximum_level, MaterialFieldType::Conservatives, false );
+         wrong_cells += NumberOfWrongHaloCells( tree, topology, communication, MaterialFieldType::Conservatives, 1.0e9 );
+
+         THEN( "The updates before and after the invalidation provide the values of the neighbor nodes" ) {
+            REQUIRE( wrong_cells == 0 );
+         }
+      }
+   }
+}
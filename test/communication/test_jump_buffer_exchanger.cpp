@@ -0,0 +1,214 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "communication/communication_types.h"
+#include "communication/jump_buffer_exchanger.h"
+#include "communication/mpi_utilities.h"
+#include "multiresolution/multiresolution.h"
+#include "topology/id_information.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+
+namespace {
+   /**
+    * @brief Gives the jump buffer a node holds before the adjustment. All values are exact in binary representation, such that averaging is exact as well.
+    * @param id Id of the node.
+    * @return The jump buffer.
+    */
+   SurfaceBuffer InitialJumpBuffer( nid_t const id ) {
+      SurfaceBuffer buffer;
+      for( BoundaryLocation const location : CC::ANBS() ) {
+         auto face = GetBoundaryJump( buffer, location );
+         for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+            for( unsigned int j = 0; j < CC::ICY(); ++j ) {
+               for( unsigned int k = 0; k < CC::ICZ(); ++k ) {
+                  face[e][j][k] = static_cast<double>( ( id % 61 ) * 64 + LTI( location ) * 8 + e + j + k ) / 8.0;
+               }
+            }
+         }
+      }
+      return buffer;
+   }
+
+   /**
+    * @brief Gives the jump buffer of a node after averaging the children on the given levels into it, using the complete buffers of all children as the
+    *        former per-node exchange did.
+    * @param topology Topology of the nodes.
+    * @param id Id of the node.
+    * @param finest_level The finest level of the averaged children.
+    * @return The averaged jump buffer.
+    */
+   SurfaceBuffer AveragedJumpBuffer( TopologyManager const& topology, nid_t const id, unsigned int const finest_level ) {
+      SurfaceBuffer buffer = InitialJumpBuffer( id );
+      if( !topology.NodeIsLeaf( id ) && LevelOfNode( id ) < finest_level ) {
+         for( nid_t const child_id : IdsOfChildren( id ) ) {
+            Multiresolution::AverageJumpBuffer( AveragedJumpBuffer( topology, child_id, finest_level ), buffer, child_id );
+         }
+      }
+      return buffer;
+   }
+
+   /**
+    * @brief Indicates whether two jump faces are identical.
+    * @param face The first face.
+    * @param other_face The second face given as contiguous values.
+    * @return True if all values are identical, false otherwise.
+    */
+   bool FacesAreIdentical( double const ( &face )[MF::ANOE()][CC::ICY()][CC::ICZ()], double const* other_face ) {
+      return std::equal( &face[0][0][0], &face[0][0][0] + JumpBufferSendingSize(), other_face );
+   }
+}// namespace
+
+SCENARIO( "Aggregated jump buffer exchange matches the exchange of complete jump buffers per node", "[1rank],[2rank]" ) {
+   GIVEN( "A load-balanced topology with resolution jumps from level two to one and from one to zero" ) {
+      constexpr MaterialName material      = MaterialName::MaterialOne;
+      constexpr unsigned int maximum_level = 2;
+      TopologyManager topology             = TopologyManager( { 2, 1, 1 }, maximum_level, 0 );
+      Tree tree                            = Tree( topology, maximum_level, 1.0 );
+      topology.RefineNodeWithId( 0x1400000 );
+      topology.UpdateTopology();
+      // The refined first child borders coarser siblings on the other rank when load-balanced on two ranks
+      topology.RefineNodeWithId( 0xA000000 );
+      topology.UpdateTopology();
+      for( auto const id : topology.LocalIds() ) {
+         topology.AddMaterialToNode( id, material );
+      }
+      topology.UpdateTopology();
+      topology.PrepareLoadBalancedTopology( MpiUtilities::NumberOfRanks() );
+      for( auto const id : topology.LocalIds() ) {
+         Node& node = tree.CreateNode( id, { material } );
+         node.GetPhaseByMaterial( material ).GetBoundaryJumpConservatives() = InitialJumpBuffer( id );
+      }
+
+      if( MpiUtilities::NumberOfRanks() > 1 ) {
+         std::vector<nid_t> const ids = topology.IdsOnLevel( 2 );
+         std::vector<nid_t> const level_one_ids = topology.IdsOnLevel( 1 );
+         bool remote_child_exists = false;
+         for( auto const& level_ids : { ids, level_one_ids } ) {
+            for( nid_t const id : level_ids ) {
+               remote_child_exists |= topology.GetRankOfNode( id ) != topology.GetRankOfNode( ParentIdOfNode( id ) );
+            }
+         }
+         REQUIRE( remote_child_exists );
+      }
+
+      WHEN( "The jump buffers of levels two and one are averaged down and the faces adjacent to the coarser leaves are exchanged" ) {
+         JumpBufferExchanger exchanger( topology, tree );
+         exchanger.AverageJumpBuffersDown( { 2, 1 } );
+
+         std::vector<std::vector<nid_t>> leaf_ids_on_levels = { topology.LeafIdsOnLevel( 1 ), topology.LeafIdsOnLevel( 0 ) };
+         for( auto& leaf_ids : leaf_ids_on_levels ) {
+            std::sort( leaf_ids.begin(), leaf_ids.end() );
+         }
+         std::vector<std::vector<double>> const received_faces = exchanger.ExchangeCoarseNeighborFaces( leaf_ids_on_levels );
+
+         THEN( "All local parents hold the average of the complete jump buffers of their children" ) {
+            for( auto const id : topology.LocalIds() ) {
+               if( topology.NodeIsLeaf( id ) ) continue;
+               SurfaceBuffer const expected = AveragedJumpBuffer( topology, id, maximum_level );
+               SurfaceBuffer const& averaged = tree.GetNodeWithId( id ).GetPhaseByMaterial( material ).GetBoundaryJumpConservatives();
+               for( BoundaryLocation const location : CC::ANBS() ) {
+                  REQUIRE( FacesAreIdentical( GetBoundaryJump( expected, location ), &GetBoundaryJump( averaged, location )[0][0][0] ) );
+               }
+            }
+         }
+
+         THEN( "Each local leaf receives the averaged face of each remote parent neighbor in leaf, material and location order" ) {
+            std::vector<std::size_t> read_positions( received_faces.size(), 0 );
+            std::size_t number_of_received_faces = 0;
+            for( auto const& leaf_ids : leaf_ids_on_levels ) {
+               for( nid_t const leaf_id : leaf_ids ) {
+                  if( !topology.NodeIsOnRank( leaf_id, MpiUtilities::MyRankId() ) ) continue;
+                  for( BoundaryLocation const location : CC::ANBS() ) {
+                     nid_t const neighbor_id = topology.GetTopologyNeighborId( leaf_id, location );
+                     if( !exchanger.NeighborIsParent( neighbor_id ) || topology.NodeIsOnRank( neighbor_id, MpiUtilities::MyRankId() ) ) continue;
+                     int const rank = topology.GetRankOfNode( neighbor_id );
+                     REQUIRE( read_positions[rank] + JumpBufferSendingSize() <= received_faces[rank].size() );
+                     SurfaceBuffer const expected = AveragedJumpBuffer( topology, neighbor_id, maximum_level );
+                     REQUIRE( FacesAreIdentical( GetBoundaryJump( expected, OppositeDirection( location ) ), received_faces[rank].data() + read_positions[rank] ) );
+                     read_positions[rank] += JumpBufferSendingSize();
+                     number_of_received_faces++;
+                  }
+               }
+            }
+            for( std::size_t rank = 0; rank < received_faces.size(); ++rank ) {
+               REQUIRE( read_positions[rank] == received_faces[rank].size() );
+            }
+            if( MpiUtilities::NumberOfRanks() == 1 ) {
+               REQUIRE( number_of_received_faces == 0 );
+            }
+         }
+      }
+   }
+}
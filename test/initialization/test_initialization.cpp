@@ -538,6 +538,8 @@ namespace Mocking {
       When( Method( output_reader, ReadOutputTimesType ).Using( OutputType::Interface ) ).Return( OutputTimesType::Off );
       When( Method( output_reader, ReadOutputInterval ).Using( OutputType::Standard ) ).Return( 0.000001 );
       When( Method( output_reader, ReadTimeNamingFactor ) ).AlwaysReturn( 1.e0 );
+      When( Method( output_reader, ReadOutputCompression ) ).AlwaysReturn( DatasetCompression() );
+      When( Method( output_reader, ReadRestartCompression ) ).AlwaysReturn( DatasetCompression() );
       return output_reader;
    }
 
@@ -573,7 +575,7 @@ namespace Mocking {
       When( Method( input_reader, GetMultiResolutionReader ) ).AlwaysReturn( multiresolution_reader.get() );
       When( Method( input_reader, GetTimeControlReader ) ).Return( time_control_reader.get() );
       When( Method( input_reader, GetRestartReader ) ).Return( restart_reader.get() );
-      When( Method( input_reader, GetOutputReader ) ).Return( output_reader.get() );
+      When( Method( input_reader, GetOutputReader ) ).AlwaysReturn( output_reader.get() );
       When( Method( input_reader, GetInputType ) ).Return( InputType::Xml );
       When( Method( input_reader, GetInputFile ) ).Return( VaryingAttributes::InputfileString( scenario ) );
       When( Method( input_reader, GetInitialConditionReader ) ).AlwaysReturn( initial_condition_reader.get() );
@@ -620,8 +622,8 @@ namespace ScenarioTest {
             ExternalHaloManager const external_halo_manager( Instantiation::InstantiateExternalHaloManager( input_reader.get(), unit_handler, material_manager ) );
             InternalHaloManager internal_halo_manager( Instantiation::InstantiateInternalHaloManager( topology_manager, tree, communication_manager, material_manager ) );
             HaloManager halo_manager( Instantiation::InstantiateHaloManager( topology_manager, tree, external_halo_manager, internal_halo_manager, communication_manager ) );
-            OutputWriter const output_writer( Instantiation::InstantiateOutputWriter( topology_manager, tree, material_manager, unit_handler ) );
-            RestartManager const restart_manager( Instantiation::InstantiateRestartManager( topology_manager, tree, unit_handler ) );
+            OutputWriter const output_writer( Instantiation::InstantiateOutputWriter( input_reader.get(), topology_manager, tree, material_manager, unit_handler ) );
+            RestartManager const restart_manager( Instantiation::InstantiateRestartManager( input_reader.get(), topology_manager, tree, unit_handler ) );
             InputOutputManager input_output_manager( Instantiation::InstantiateInputOutputManager( input_reader.get(), output_writer, restart_manager, unit_handler, case_base_folder ) );
             ModularAlgorithmAssembler modular_assembler( Instantiation::InstantiateModularAlgorithmAssembler( input_reader.get(), topology_manager, tree, communication_manager, halo_manager, multiresolution,
                                                                                                               material_manager, input_output_manager, unit_handler ) );
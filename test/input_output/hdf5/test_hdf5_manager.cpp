@@ -0,0 +1,221 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "communication/mpi_utilities.h"
+#include "input_output/hdf5/hdf5_manager.h"
+
+namespace {
+   constexpr hsize_t values_per_element = 3;
+
+   /**
+    * @brief Gives the value stored in the file for a component of an element.
+    * @param element Global index of the element.
+    * @param component Index of the component within the element.
+    * @return The value.
+    */
+   double ElementValue( hsize_t const element, hsize_t const component ) {
+      return static_cast<double>( element * values_per_element + component ) + 0.5;
+   }
+
+   /**
+    * @brief Writes the elements of all ranks into a single dataset, each rank its own consecutive elements in one collective call.
+    * @param filename Name of the file.
+    * @param elements_per_rank Number of elements written by each rank.
+    * @return Total number of elements in the dataset.
+    */
+   hsize_t WriteElementsCollectively( std::string const& filename, std::vector<hsize_t> const& elements_per_rank ) {
+      int const my_rank         = MpiUtilities::MyRankId();
+      hsize_t total_elements    = 0;
+      hsize_t local_start_index = 0;
+      for( int rank = 0; rank < MpiUtilities::NumberOfRanks(); ++rank ) {
+         if( rank == my_rank ) local_start_index = total_elements;
+         total_elements += elements_per_rank[rank];
+      }
+      std::vector<double> values;
+      for( hsize_t element = local_start_index; element < local_start_index + elements_per_rank[my_rank]; ++element ) {
+         for( hsize_t component = 0; component < values_per_element; ++component ) {
+            values.push_back( ElementValue( element, component ) );
+         }
+      }
+
+      Hdf5Manager& hdf5_manager = Hdf5Manager::Instance();
+      hdf5_manager.OpenFile( filename, Hdf5Access::Write );
+      hdf5_manager.OpenGroup( "elements" );
+      hdf5_manager.OpenDatasetForWriting( "Values", { total_elements, values_per_element }, { 1, values_per_element }, local_start_index );
+      hdf5_manager.WriteDatasetCollectively( "Values", values.data(), elements_per_rank[my_rank] );
+      hdf5_manager.CloseFile();
+      return total_elements;
+   }
+
+   /**
+    * @brief Reads the given ranges of elements of the dataset in one collective call.
+    * @param filename Name of the file.
+    * @param ranges Start index and number of elements of each range.
+    * @return The read values.
+    */
+   std::vector<double> ReadElementsCollectively( std::string const& filename, std::vector<std::pair<hsize_t, hsize_t>> const& ranges ) {
+      hsize_t number_of_elements = 0;
+      for( auto const& [start, count] : ranges ) {
+         number_of_elements += count;
+      }
+      std::vector<double> values( number_of_elements * values_per_element, 0.0 );
+
+      Hdf5Manager& hdf5_manager = Hdf5Manager::Instance();
+      hdf5_manager.OpenFile( filename, Hdf5Access::Read );
+      hdf5_manager.OpenGroup( "elements" );
+      hdf5_manager.OpenDatasetForReading( "Values", { 1, values_per_element } );
+      hdf5_manager.ReadDatasetCollectively( "Values", values.data(), ranges );
+      hdf5_manager.CloseFile();
+      return values;
+   }
+}// namespace
+
+SCENARIO( "Datasets written and read collectively by all ranks round-trip", "[1rank],[2rank]" ) {
+   GIVEN( "A dataset written collectively with a different number of consecutive elements per rank" ) {
+      std::string const filename = "test_hdf5_manager_collective.h5";
+      std::vector<hsize_t> elements_per_rank;
+      for( int rank = 0; rank < MpiUtilities::NumberOfRanks(); ++rank ) {
+         elements_per_rank.push_back( static_cast<hsize_t>( rank ) + 4 );
+      }
+      hsize_t const total_elements = WriteElementsCollectively( filename, elements_per_rank );
+
+      WHEN( "Each rank reads two separate ranges of elements in one collective call" ) {
+         // The first two and the last element of the dataset, i.e. elements written by different ranks
+         std::vector<std::pair<hsize_t, hsize_t>> const ranges = { { 0, 2 }, { total_elements - 1, 1 } };
+         std::vector<double> const values                      = ReadElementsCollectively( filename, ranges );
+
+         THEN( "The read values are the ones of the elements in the ranges, stored contiguously in range order" ) {
+            std::vector<double> expected_values;
+            for( auto const& [start, count] : ranges ) {
+               for( hsize_t element = start; element < start + count; ++element ) {
+                  for( hsize_t component = 0; component < values_per_element; ++component ) {
+                     expected_values.push_back( ElementValue( element, component ) );
+                  }
+               }
+            }
+            REQUIRE( values == expected_values );
+         }
+      }
+
+      WHEN( "Only the first rank reads all elements while the other ranks read none" ) {
+         std::vector<std::pair<hsize_t, hsize_t>> ranges;
+         if( MpiUtilities::MyRankId() == 0 ) {
+            ranges.emplace_back( 0, total_elements );
+         }
+         std::vector<double> const values = ReadElementsCollectively( filename, ranges );
+
+         THEN( "The first rank holds the elements of all ranks in file order" ) {
+            std::vector<double> expected_values;
+            for( hsize_t element = 0; element < ( MpiUtilities::MyRankId() == 0 ? total_elements : 0 ); ++element ) {
+               for( hsize_t component = 0; component < values_per_element; ++component ) {
+                  expected_values.push_back( ElementValue( element, component ) );
+               }
+            }
+            REQUIRE( values == expected_values );
+         }
+      }
+
+      MPI_Barrier( MPI_COMM_WORLD );
+      if( MpiUtilities::MyRankId() == 0 ) {
+         std::remove( filename.c_str() );
+      }
+   }
+
+   GIVEN( "A dataset written collectively by the first rank only" ) {
+      std::string const filename = "test_hdf5_manager_collective.h5";
+      std::vector<hsize_t> elements_per_rank( MpiUtilities::NumberOfRanks(), 0 );
+      elements_per_rank.front()    = 4;
+      hsize_t const total_elements = WriteElementsCollectively( filename, elements_per_rank );
+
+      WHEN( "All ranks read all elements in one collective call" ) {
+         std::vector<double> const values = ReadElementsCollectively( filename, { { 0, total_elements } } );
+
+         THEN( "All ranks hold the elements written by the first rank" ) {
+            std::vector<double> expected_values;
+            for( hsize_t element = 0; element < 4; ++element ) {
+               for( hsize_t component = 0; component < values_per_element; ++component ) {
+                  expected_values.push_back( ElementValue( element, component ) );
+               }
+            }
+            REQUIRE( values == expected_values );
+         }
+      }
+
+      MPI_Barrier( MPI_COMM_WORLD );
+      if( MpiUtilities::MyRankId() == 0 ) {
+         std::remove( filename.c_str() );
+      }
+   }
+}
@@ -98,6 +98,11 @@ SCENARIO( "Check that the xml output reader works properly", "[1rank]" ) {
                                   "          <ts5> 5.6 </ts5>"
                                   "       </stamps>"
                                   "     </interfaceOutput>"
+                                  "     <compression>"
+                                  "       <output> Lossy </output>"
+                                  "       <restart> Lossless </restart>"
+                                  "       <decimalDigits> 4 </decimalDigits>"
+                                  "     </compression>"
                                   "  </output>"
                                   "</configuration>" );
       // Create the xml document
@@ -105,6 +110,14 @@ SCENARIO( "Check that the xml output reader works properly", "[1rank]" ) {
       xml_tree->Parse( xml_data.c_str() );
       // Create the xml reader
       std::unique_ptr<OutputReader const> const reader( std::make_unique<XmlOutputReader const>( xml_tree ) );
+      WHEN( "The compression is read." ) {
+         THEN( "The output should be compressed lossy with 4 decimal digits and the restart lossless." ) {
+            DatasetCompression const output_compression( reader->ReadOutputCompression() );
+            REQUIRE( output_compression.type_ == CompressionType::Lossy );
+            REQUIRE( output_compression.decimal_digits_ == 4 );
+            REQUIRE( reader->ReadRestartCompression().type_ == CompressionType::Lossless );
+         }
+      }
       WHEN( "The time naming factor is read." ) {
          THEN( "The time naming factor should be 0.001" ) {
             REQUIRE( reader->ReadTimeNamingFactor() == 0.001 );
@@ -168,6 +181,10 @@ SCENARIO( "Check that the xml output reader works properly", "[1rank]" ) {
                                   "          <ts5> 5.6 </ts5>"
                                   "       </stamps>"
                                   "     </interfaceOutput>"
+                                  "     <compression>"
+                                  "       <output> Lossles </output>"
+                                  "       <restart> Lossy </restart>"
+                                  "     </compression>"
                                   "  </output>"
                                   "</configuration>" );
       // Create the xml document
@@ -198,6 +215,12 @@ SCENARIO( "Check that the xml output reader works properly", "[1rank]" ) {
             REQUIRE_THROWS_AS( reader->ReadOutputTimeStamps( OutputType::Interface ), std::invalid_argument );
          }
       }
+      WHEN( "The compression is read." ) {
+         THEN( "The unknown output compression should throw a logic error and the lossy restart compression an invalid argument exception" ) {
+            REQUIRE_THROWS_AS( reader->ReadOutputCompression(), std::logic_error );
+            REQUIRE_THROWS_AS( reader->ReadRestartCompression(), std::invalid_argument );
+         }
+      }
    }
 
    GIVEN( "A xml document with non-existing tags to read the output data." ) {
@@ -232,5 +255,11 @@ SCENARIO( "Check that the xml output reader works properly", "[1rank]" ) {
             REQUIRE_THROWS_AS( reader->ReadOutputTimeStamps( OutputType::Interface ), std::logic_error );
          }
       }
+      WHEN( "The compression is read." ) {
+         THEN( "The compression should be off for output and restart files." ) {
+            REQUIRE( reader->ReadOutputCompression().type_ == CompressionType::Off );
+            REQUIRE( reader->ReadRestartCompression().type_ == CompressionType::Off );
+         }
+      }
    }
 }
@@ -678,3 +678,33 @@ SCENARIO( "Standard mesh generator with mpi-filtering: Check that vertex IDs and
       }
    }
 }
+
+/***********************************/
+/* 4. Topology revision check      */
+/***********************************/
+SCENARIO( "Standard mesh generator with mpi-filtering: The topology revision changes only with the mesh", "[1rank]" ) {
+
+   GIVEN( "Underlying topology with Lmax being one" ) {
+      // Parameter for the creation of the mesh geenrator
+      TopologyManager topology = TopologyManager( { 1, 1, 1 }, 1, 0 );
+      Tree tree( topology, 1, 1.0 );
+      std::unique_ptr<MeshGenerator const> mesh_generator = std::make_unique<StandardMpiMeshGenerator const>( topology, tree, 1.0, true );
+      std::uint64_t const initial_revision = mesh_generator->GetTopologyRevision();
+
+      WHEN( "The topology is updated without any change" ) {
+         topology.UpdateTopology();
+
+         THEN( "The topology revision is unchanged" ) {
+            REQUIRE( mesh_generator->GetTopologyRevision() == initial_revision );
+         }
+      }
+
+      WHEN( "The node in the topology is refined" ) {
+         TestUtilities::RefineFirstNodeInTopology( topology );
+
+         THEN( "The topology revision differs" ) {
+            REQUIRE( mesh_generator->GetTopologyRevision() != initial_revision );
+         }
+      }
+   }
+}
@@ -0,0 +1,247 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "input_output/output_writer/mesh_generator/mesh_generator_utilities.h"
+#include "input_output/output_writer/mesh_generator/standard_finest_level_mesh_generator.h"
+#include "input_output/output_writer/output_quantity.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/material_manager.h"
+#include "topology/id_information.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+#include "unit_handler.h"
+
+namespace {
+   /**
+    * @brief Refines the single level-zero node and its first child, and creates all resulting leaves in the tree.
+    * @param topology Topology that is refined (indirect return).
+    * @param tree Tree in which the leaves are created (indirect return).
+    */
+   void CreateTwiceRefinedLeaves( TopologyManager& topology, Tree& tree ) {
+      REQUIRE( topology.NodeAndLeafCount() == std::pair<unsigned int, unsigned int>( 1, 1 ) );
+      topology.RefineNodeWithId( 0x1400000 );
+      topology.UpdateTopology();
+      topology.RefineNodeWithId( 0xA000000 );
+      topology.UpdateTopology();
+      for( auto const id : topology.LocalLeafIds() ) {
+         topology.AddMaterialToNode( id, MaterialName::MaterialOne );
+         tree.CreateNode( id, { MaterialName::MaterialOne } );
+      }
+      topology.UpdateTopology();
+   }
+
+   /**
+    * @brief Scalar output quantity that writes the position of each node in the given node list into all its internal cells.
+    */
+   class NodePositionQuantity : public OutputQuantity {
+      std::vector<std::reference_wrapper<Node const>> const& nodes_;
+
+      void DoComputeCellData( Node const& node, std::vector<double>& cell_data, unsigned long long int& cell_data_counter ) const override {
+         double position = -1.0;
+         for( std::size_t n = 0; n < nodes_.size(); ++n ) {
+            if( &nodes_[n].get() == &node ) position = double( n );
+         }
+         for( unsigned int cell = 0; cell < MeshGeneratorUtilities::NumberOfInternalCellsPerBlock(); ++cell ) {
+            cell_data[cell_data_counter++] = position;
+         }
+      }
+
+      void DoComputeDebugCellData( Node const&, std::vector<double>&, unsigned long long int&, MaterialName const ) const override {}
+
+   public:
+      NodePositionQuantity( UnitHandler const& unit_handler, MaterialManager const& material_manager, std::vector<std::reference_wrapper<Node const>> const& nodes ) : OutputQuantity( unit_handler, material_manager, "position", { true, false, false }, { 1, 1 } ),
+                                                                                                                                                                        nodes_( nodes ) {}
+   };
+
+   /**
+    * @brief Reads the start and count of the first hyperslab dimension from a hyperslab data item string.
+    * @param data_item The data item containing the hyperslab.
+    * @return Start and count of the first dimension.
+    */
+   std::pair<unsigned long long int, unsigned long long int> FirstHyperSlabRange( std::string const& data_item ) {
+      std::string const selection_tag = "Format=\"XML\">";
+      std::size_t const selection_begin = data_item.find( selection_tag );
+      REQUIRE( selection_begin != std::string::npos );
+      std::istringstream selection( data_item.substr( selection_begin + selection_tag.size() ) );
+      // Start, stride and count for each of the three dataset dimensions
+      std::array<unsigned long long int, 9> values;
+      for( auto& value : values ) {
+         selection >> value;
+      }
+      REQUIRE( values[3] == 1 );
+      return { values[0], values[6] };
+   }
+}// namespace
+
+SCENARIO( "Block geometry gives the origins and spacings of all leaves in z, y, x order", "[1rank]" ) {
+   GIVEN( "A twice refined topology with dimensionalized node size two and a non-dimensional node size one" ) {
+      TopologyManager topology = TopologyManager( { 1, 1, 1 }, 2, 0 );
+      Tree tree( topology, 2, 1.0 );
+      CreateTwiceRefinedLeaves( topology, tree );
+      StandardFinestLevelMeshGenerator const mesh_generator( topology, tree, 2.0, { 1, 1, 1 } );
+
+      WHEN( "The block geometry is computed" ) {
+         std::vector<double> origins;
+         std::vector<double> spacings;
+         mesh_generator.ComputeBlockGeometry( origins, spacings );
+         std::vector<std::reference_wrapper<Node const>> const leaves = std::as_const( tree ).Leaves();
+
+         THEN( "There is one origin and one spacing triple per leaf" ) {
+            REQUIRE( leaves.size() == topology.LocalLeafIds().size() );
+            REQUIRE( origins.size() == 3 * leaves.size() );
+            REQUIRE( spacings.size() == 3 * leaves.size() );
+         }
+         THEN( "Each triple holds the dimensionalized corner of the leaf in z, y, x order and its cell size in all directions" ) {
+            for( std::size_t n = 0; n < leaves.size(); ++n ) {
+               auto const [x, y, z] = leaves[n].get().GetBlockCoordinates();
+               REQUIRE( origins[3 * n] == Approx( 2.0 * z ) );
+               REQUIRE( origins[3 * n + 1] == Approx( 2.0 * y ) );
+               REQUIRE( origins[3 * n + 2] == Approx( 2.0 * x ) );
+               for( unsigned int d = 0; d < 3; ++d ) {
+                  REQUIRE( spacings[3 * n + d] == Approx( 2.0 * leaves[n].get().GetCellSize() ) );
+               }
+            }
+         }
+         THEN( "The leaves shifted in x-direction on level one and two lie at x = 1 and x = 0.5 with halved spacing on the finer level" ) {
+            unsigned int found_leaves = 0;
+            for( std::size_t n = 0; n < leaves.size(); ++n ) {
+               auto const [x, y, z]                    = leaves[n].get().GetBlockCoordinates();
+               std::array<double, 3> const coordinates = { x, y, z };
+               if( coordinates == DomainCoordinatesOfId( 0xA000001, DomainSizeOfId( 0xA000001, 1.0 ) ) ) {
+                  REQUIRE( origins[3 * n] == Approx( 0.0 ) );
+                  REQUIRE( origins[3 * n + 1] == Approx( 0.0 ) );
+                  REQUIRE( origins[3 * n + 2] == Approx( 1.0 ) );
+                  REQUIRE( spacings[3 * n] == Approx( 1.0 / CC::ICX() ) );
+                  found_leaves++;
+               }
+               if( coordinates == DomainCoordinatesOfId( 0x50000001, DomainSizeOfId( 0x50000001, 1.0 ) ) ) {
+                  REQUIRE( origins[3 * n] == Approx( 0.0 ) );
+                  REQUIRE( origins[3 * n + 1] == Approx( 0.0 ) );
+                  REQUIRE( origins[3 * n + 2] == Approx( 0.5 ) );
+                  REQUIRE( spacings[3 * n] == Approx( 0.5 / CC::ICX() ) );
+                  found_leaves++;
+               }
+            }
+            REQUIRE( found_leaves == 2 );
+         }
+      }
+   }
+}
+
+SCENARIO( "The block attribute of block n selects the cells of the n-th leaf from the cell data", "[1rank]" ) {
+   GIVEN( "The cell data of a scalar quantity holding the leaf position in all cells of a twice refined topology" ) {
+      TopologyManager topology = TopologyManager( { 1, 1, 1 }, 2, 0 );
+      Tree tree( topology, 2, 1.0 );
+      CreateTwiceRefinedLeaves( topology, tree );
+      std::vector<std::reference_wrapper<Node const>> const leaves = std::as_const( tree ).Leaves();
+
+      UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+      std::unordered_map<std::string, double> const eos_data = { { "gamma", 1.4 }, { "backgroundPressure", 0.0 } };
+      std::vector<std::tuple<MaterialType, Material>> materials;
+      materials.emplace_back( std::make_tuple( MaterialType::Fluid, Material( std::make_unique<StiffenedGas const>( eos_data, unit_handler ), 0.0, 0.0, 0.0, 0.0, nullptr, nullptr, unit_handler ) ) );
+      MaterialManager const material_manager = MaterialManager( std::move( materials ), {} );
+      NodePositionQuantity const quantity( unit_handler, material_manager, leaves );
+
+      hsize_t const cells_per_block = CC::ICX() * CC::ICY() * CC::ICZ();
+      hsize_t const global_number_of_cells = leaves.size() * cells_per_block;
+      std::vector<double> cell_data( global_number_of_cells );
+      quantity.ComputeCellData( leaves, cell_data );
+
+      WHEN( "The block attribute string of each block is created" ) {
+         THEN( "The hyperslab of block n starts at n * ICX * ICY * ICZ, spans ICX * ICY * ICZ cells and only covers cells of the n-th leaf" ) {
+            for( hsize_t block = 0; block < leaves.size(); ++block ) {
+               std::string const attribute = quantity.GetXdmfBlockAttributeString( "data.h5", "cell_data", global_number_of_cells, block );
+               REQUIRE( attribute.find( "data.h5:/cell_data/position" ) != std::string::npos );
+               REQUIRE( attribute.find( "Dimensions=\"" + std::to_string( global_number_of_cells ) + " 1 1\"" ) != std::string::npos );
+               auto const [start, count] = FirstHyperSlabRange( attribute );
+               REQUIRE( start == block * cells_per_block );
+               REQUIRE( count == cells_per_block );
+               for( hsize_t cell = start; cell < start + count; ++cell ) {
+                  REQUIRE( cell_data[cell] == double( block ) );
+               }
+               if( start > 0 ) {
+                  REQUIRE( cell_data[start - 1] != double( block ) );
+               }
+               if( start + count < global_number_of_cells ) {
+                  REQUIRE( cell_data[start + count] != double( block ) );
+               }
+            }
+         }
+      }
+   }
+}
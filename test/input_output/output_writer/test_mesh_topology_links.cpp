@@ -0,0 +1,113 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include "input_output/output_writer/mesh_topology_links.h"
+
+SCENARIO( "Outputs of an unchanged topology link the mesh topology of the previous output", "[1rank]" ) {
+   GIVEN( "Mesh topology links with active reuse and a first standard output" ) {
+      MeshTopologyLinks links( true );
+      REQUIRE( links.LinkableFilename( OutputType::Standard, 3, "data_1.h5" ).empty() );
+      WHEN( "A second output with the same topology revision is written" ) {
+         std::string const linked_file = links.LinkableFilename( OutputType::Standard, 3, "data_2.h5" );
+         THEN( "It links the mesh topology of the first output" ) {
+            REQUIRE( linked_file == "data_1.h5" );
+         }
+         THEN( "A third output with the same revision still links the first output" ) {
+            REQUIRE( links.LinkableFilename( OutputType::Standard, 3, "data_3.h5" ) == "data_1.h5" );
+         }
+      }
+      WHEN( "A second output with a changed topology revision is written" ) {
+         std::string const linked_file = links.LinkableFilename( OutputType::Standard, 4, "data_2.h5" );
+         THEN( "It gets the full mesh topology" ) {
+            REQUIRE( linked_file.empty() );
+         }
+         THEN( "A third output with the new revision links the second output" ) {
+            REQUIRE( links.LinkableFilename( OutputType::Standard, 4, "data_3.h5" ) == "data_2.h5" );
+         }
+      }
+      WHEN( "The first output is rewritten under the same name" ) {
+         THEN( "It gets the full mesh topology" ) {
+            REQUIRE( links.LinkableFilename( OutputType::Standard, 3, "data_1.h5" ).empty() );
+         }
+      }
+      WHEN( "The first interface output with the same revision is written" ) {
+         THEN( "It gets the full mesh topology, since output types are linked separately" ) {
+            REQUIRE( links.LinkableFilename( OutputType::Interface, 3, "interface_1.h5" ).empty() );
+         }
+      }
+   }
+   GIVEN( "Mesh topology links with inactive reuse" ) {
+      MeshTopologyLinks links( false );
+      links.LinkableFilename( OutputType::Standard, 3, "data_1.h5" );
+      THEN( "A second output with the same revision gets the full mesh topology" ) {
+         REQUIRE( links.LinkableFilename( OutputType::Standard, 3, "data_2.h5" ).empty() );
+      }
+   }
+}
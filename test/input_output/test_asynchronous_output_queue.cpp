@@ -0,0 +1,119 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <cfenv>
+#include <stdexcept>
+#include <vector>
+
+#include "input_output/asynchronous_output_queue.h"
+
+SCENARIO( "Jobs of the asynchronous output queue are executed in order", "[1rank]" ) {
+   GIVEN( "A queue that holds at most two pending jobs" ) {
+      AsynchronousOutputQueue queue( 2 );
+      WHEN( "Several jobs are added" ) {
+         std::vector<int> executed_jobs;
+         for( int job_index = 0; job_index < 5; ++job_index ) {
+            queue.Enqueue( [&executed_jobs, job_index]() { executed_jobs.push_back( job_index ); } );
+         }
+         queue.WaitUntilEmpty();
+         THEN( "All jobs are executed in the order they were added" ) {
+            REQUIRE( executed_jobs == std::vector<int>( { 0, 1, 2, 3, 4 } ) );
+         }
+      }
+   }
+}
+
+SCENARIO( "Failures of asynchronous output jobs are reported", "[1rank]" ) {
+   GIVEN( "A queue with a job that throws" ) {
+      AsynchronousOutputQueue queue( 1 );
+      queue.Enqueue( []() { throw std::runtime_error( "Writing failed" ); } );
+      THEN( "Waiting for the queue rethrows the failure once" ) {
+         REQUIRE_THROWS_AS( queue.WaitUntilEmpty(), std::runtime_error );
+         REQUIRE_NOTHROW( queue.WaitUntilEmpty() );
+      }
+   }
+}
+
+SCENARIO( "Jobs of the asynchronous output queue run in the floating-point environment of its creator", "[1rank]" ) {
+   GIVEN( "A queue created while rounding downwards" ) {
+      int const default_rounding = std::fegetround();
+      std::fesetround( FE_DOWNWARD );
+      AsynchronousOutputQueue queue( 1 );
+      std::fesetround( default_rounding );
+      WHEN( "A job reads the rounding mode" ) {
+         int job_rounding = default_rounding;
+         queue.Enqueue( [&job_rounding]() { job_rounding = std::fegetround(); } );
+         queue.WaitUntilEmpty();
+         THEN( "The job rounds downwards" ) {
+            REQUIRE( job_rounding == FE_DOWNWARD );
+         }
+      }
+   }
+}
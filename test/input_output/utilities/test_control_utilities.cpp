@@ -0,0 +1,171 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "input_output/utilities/control_utilities.h"
+
+SCENARIO( "Control file commands are parsed properly", "[1rank]" ) {
+   GIVEN( "A control file with all commands in mixed case and empty lines" ) {
+      std::istringstream control_stream( "restart\n\n  OUTPUT  \nOutput_Interval 0.25\nabort\n" );
+      std::vector<std::string> ignored_lines;
+      ControlCommands const commands = ControlUtilities::ParseControlCommands( control_stream, ignored_lines );
+      THEN( "All commands are set and no line is ignored" ) {
+         REQUIRE( commands.abort_ );
+         REQUIRE( commands.write_restart_ );
+         REQUIRE( commands.write_output_ );
+         REQUIRE( commands.output_interval_ == 0.25 );
+         REQUIRE( ignored_lines.empty() );
+      }
+   }
+   GIVEN( "A control file with a single output command" ) {
+      std::istringstream control_stream( "output" );
+      std::vector<std::string> ignored_lines;
+      ControlCommands const commands = ControlUtilities::ParseControlCommands( control_stream, ignored_lines );
+      THEN( "Only the output is requested" ) {
+         REQUIRE_FALSE( commands.abort_ );
+         REQUIRE_FALSE( commands.write_restart_ );
+         REQUIRE( commands.write_output_ );
+         REQUIRE( commands.output_interval_ == 0.0 );
+      }
+   }
+   GIVEN( "A control file with unknown commands and invalid intervals" ) {
+      std::istringstream control_stream( "stop\noutput_interval\noutput_interval -1.0\noutput_interval 0\noutput_interval nan\noutput_interval inf\n"
+                                         "output_interval 1.0e-3 2.0e-3\noutput_interval 1.0s\nabort now\n" );
+      std::vector<std::string> ignored_lines;
+      ControlCommands const commands = ControlUtilities::ParseControlCommands( control_stream, ignored_lines );
+      THEN( "No command is set and all lines are ignored" ) {
+         REQUIRE_FALSE( commands.abort_ );
+         REQUIRE_FALSE( commands.write_restart_ );
+         REQUIRE_FALSE( commands.write_output_ );
+         REQUIRE( commands.output_interval_ == 0.0 );
+         REQUIRE( ignored_lines.size() == 9 );
+         REQUIRE( ignored_lines.front() == "stop" );
+         REQUIRE( ignored_lines.back() == "abort now" );
+      }
+   }
+   GIVEN( "A control file with a valid interval following an invalid one" ) {
+      std::istringstream control_stream( "output_interval -0.5\noutput_interval 0.5\n" );
+      std::vector<std::string> ignored_lines;
+      ControlCommands const commands = ControlUtilities::ParseControlCommands( control_stream, ignored_lines );
+      THEN( "The valid interval is used" ) {
+         REQUIRE( commands.output_interval_ == 0.5 );
+         REQUIRE( ignored_lines.size() == 1 );
+      }
+   }
+}
+
+SCENARIO( "Output time stamps are replaced by a new interval", "[1rank]" ) {
+   GIVEN( "Remaining time stamps up to the end time 1.0" ) {
+      std::vector<double> time_stamps = { 0.3, 0.6, 0.9, 1.0 };
+      WHEN( "The interval is changed to 0.25 at time 0.2" ) {
+         bool const replaced = ControlUtilities::ReplaceTimeStampInterval( time_stamps, 0.2, 0.25, 0.01 );
+         THEN( "The new time stamps start after the current time and end with the end time" ) {
+            REQUIRE( replaced );
+            REQUIRE( time_stamps.size() == 4 );
+            REQUIRE( time_stamps[0] == Approx( 0.45 ) );
+            REQUIRE( time_stamps[1] == Approx( 0.7 ) );
+            REQUIRE( time_stamps[2] == Approx( 0.95 ) );
+            REQUIRE( time_stamps[3] == 1.0 );
+         }
+      }
+      WHEN( "The interval is changed to a value larger than the remaining time" ) {
+         bool const replaced = ControlUtilities::ReplaceTimeStampInterval( time_stamps, 0.2, 5.0, 0.01 );
+         THEN( "Only the end time remains" ) {
+            REQUIRE( replaced );
+            REQUIRE( time_stamps == std::vector<double>( { 1.0 } ) );
+         }
+      }
+      WHEN( "The interval is below the minimum interval" ) {
+         bool const replaced = ControlUtilities::ReplaceTimeStampInterval( time_stamps, 0.2, 1.0e-12, 1.0e-3 );
+         THEN( "The interval is rejected and the time stamps are kept" ) {
+            REQUIRE_FALSE( replaced );
+            REQUIRE( time_stamps == std::vector<double>( { 0.3, 0.6, 0.9, 1.0 } ) );
+         }
+      }
+      WHEN( "The interval is zero" ) {
+         bool const replaced = ControlUtilities::ReplaceTimeStampInterval( time_stamps, 0.2, 0.0, 0.0 );
+         THEN( "The interval is rejected and the time stamps are kept" ) {
+            REQUIRE_FALSE( replaced );
+            REQUIRE( time_stamps.size() == 4 );
+         }
+      }
+   }
+   GIVEN( "No remaining time stamps" ) {
+      std::vector<double> time_stamps;
+      bool const replaced = ControlUtilities::ReplaceTimeStampInterval( time_stamps, 0.2, 0.25, 0.01 );
+      THEN( "No time stamps are added" ) {
+         REQUIRE( replaced );
+         REQUIRE( time_stamps.empty() );
+      }
+   }
+}
@@ -69,7 +69,9 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <limits>
 #include <tinyxml2.h>
+#include <vector>
 
 #include "input_output/utilities/stl_utilities.h"
 #include "utilities/vector_utilities.h"
@@ -182,3 +184,98 @@ SCENARIO( "The distance to a triangle is computed properly", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "The bounding volume hierarchy gives the same distances as a loop over all triangles", "[1rank]" ) {
+   GIVEN( "A plane of 10 x 10 squares, each split into two counter-clockwise triangles with normal in positive z-direction." ) {
+      auto const create_triangles = []() {
+         std::vector<StlUtilities::Triangle> triangles;
+         constexpr std::array<double, 3> normal = { 0.0, 0.0, 1.0 };
+         for( unsigned int i = 0; i < 10; ++i ) {
+            for( unsigned int j = 0; j < 10; ++j ) {
+               double const x = double( i );
+               double const y = double( j );
+               triangles.emplace_back( normal, std::array<double, 3>( { x, y, 0.0 } ), std::array<double, 3>( { x + 1.0, y, 0.0 } ), std::array<double, 3>( { x, y + 1.0, 0.0 } ) );
+               triangles.emplace_back( normal, std::array<double, 3>( { x + 1.0, y, 0.0 } ), std::array<double, 3>( { x + 1.0, y + 1.0, 0.0 } ), std::array<double, 3>( { x, y + 1.0, 0.0 } ) );
+            }
+         }
+         return triangles;
+      };
+      std::vector<StlUtilities::Triangle> const triangles = create_triangles();
+      StlUtilities::BoundingVolumeHierarchy const hierarchy( create_triangles() );
+      REQUIRE( hierarchy.NumberOfTriangles() == 200 );
+      WHEN( "The distances of points above, below and beside the plane are computed." ) {
+         THEN( "All distances agree with the loop over all triangles." ) {
+            for( double x = -1.3; x < 11.0; x += 0.77 ) {
+               for( double y = -0.9; y < 11.0; y += 0.61 ) {
+                  for( double z = -3.1; z < 3.0; z += 0.53 ) {
+                     std::array<double, 3> const point = { x, y, z };
+                     double distance                   = std::numeric_limits<double>::max();
+                     for( auto const& triangle : triangles ) {
+                        StlUtilities::Voxelization( triangle, point, distance );
+                     }
+                     REQUIRE( hierarchy.SignedDistance( point ) == distance );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+SCENARIO( "The bounding volume hierarchy resolves equally distant triangles like a loop over all triangles", "[1rank]" ) {
+   GIVEN( "A closed box whose faces are split into 4 x 4 squares of two counter-clockwise triangles with outward normal. The inner corners of the top face are moved up and down alternately, which gives triangles with shared edges and corners on both sides of each other." ) {
+      auto const create_triangles = []() {
+         // Origin and both spanning edges of each face. The cross product of the edges gives the outward normal
+         std::array<std::array<std::array<double, 3>, 3>, 6> const faces = { { { { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 2.0 }, { 0.0, 2.0, 0.0 } } },
+                                                                                { { { 2.0, 0.0, 0.0 }, { 0.0, 2.0, 0.0 }, { 0.0, 0.0, 2.0 } } },
+                                                                                { { { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 0.0, 0.0, 2.0 } } },
+                                                                                { { { 0.0, 2.0, 0.0 }, { 0.0, 0.0, 2.0 }, { 2.0, 0.0, 0.0 } } },
+                                                                                { { { 0.0, 0.0, 0.0 }, { 0.0, 2.0, 0.0 }, { 2.0, 0.0, 0.0 } } },
+                                                                                { { { 0.0, 0.0, 2.0 }, { 2.0, 0.0, 0.0 }, { 0.0, 2.0, 0.0 } } } } };
+         constexpr unsigned int squares_per_edge = 4;
+         auto const corner                       = []( std::array<std::array<double, 3>, 3> const& face, unsigned int const a, unsigned int const b, bool const is_top ) {
+            double const s              = double( a ) / double( squares_per_edge );
+            double const t              = double( b ) / double( squares_per_edge );
+            std::array<double, 3> point = { face[0][0] + s * face[1][0] + t * face[2][0], face[0][1] + s * face[1][1] + t * face[2][1], face[0][2] + s * face[1][2] + t * face[2][2] };
+            if( is_top && a > 0 && a < squares_per_edge && b > 0 && b < squares_per_edge ) {
+               point[2] += ( a + b ) % 2 == 0 ? -0.5 : 0.5;
+            }
+            return point;
+         };
+         std::vector<StlUtilities::Triangle> triangles;
+         for( unsigned int f = 0; f < faces.size(); ++f ) {
+            bool const is_top = f == faces.size() - 1;
+            for( unsigned int a = 0; a < squares_per_edge; ++a ) {
+               for( unsigned int b = 0; b < squares_per_edge; ++b ) {
+                  std::array<double, 3> const p1 = corner( faces[f], a, b, is_top );
+                  std::array<double, 3> const p2 = corner( faces[f], a + 1, b, is_top );
+                  std::array<double, 3> const p3 = corner( faces[f], a, b + 1, is_top );
+                  std::array<double, 3> const p4 = corner( faces[f], a + 1, b + 1, is_top );
+                  triangles.emplace_back( VU::CrossProduct( VU::Difference( p2, p1 ), VU::Difference( p3, p1 ) ), p1, p2, p3 );
+                  triangles.emplace_back( VU::CrossProduct( VU::Difference( p4, p2 ), VU::Difference( p3, p2 ) ), p2, p4, p3 );
+               }
+            }
+         }
+         return triangles;
+      };
+      std::vector<StlUtilities::Triangle> const triangles = create_triangles();
+      StlUtilities::BoundingVolumeHierarchy const hierarchy( create_triangles() );
+      REQUIRE( hierarchy.NumberOfTriangles() == 192 );
+      WHEN( "The distances of points on a grid aligned with the shared edges of the triangles are computed." ) {
+         THEN( "All distances agree bit by bit with the loop over all triangles." ) {
+            for( double x = -0.75; x < 2.8; x += 0.25 ) {
+               for( double y = -0.75; y < 2.8; y += 0.25 ) {
+                  for( double z = -0.625; z < 3.3; z += 0.25 ) {
+                     std::array<double, 3> const point = { x, y, z };
+                     double distance                   = std::numeric_limits<double>::max();
+                     for( auto const& triangle : triangles ) {
+                        StlUtilities::Voxelization( triangle, point, distance );
+                     }
+                     REQUIRE( hierarchy.SignedDistance( point ) == distance );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
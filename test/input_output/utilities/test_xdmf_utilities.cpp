@@ -236,3 +236,21 @@ SCENARIO( "Footer string can be properly created", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Hyperslab data item string can be properly created", "[1rank]" ) {
+   GIVEN( "A dataset of 4 blocks with 3 entries each" ) {
+      WHEN( "The entries of the second block are selected" ) {
+         REQUIRE( XdmfUtilities::HyperSlabDataItemString( "file.h5", "group/origins", { 4, 3 }, { 1, 0 }, { 1, 3 }, "3" )
+                  == "<DataItem ItemType=\"HyperSlab\" Dimensions=\"3\"> <DataItem Dimensions=\"3 2\" Format=\"XML\"> 1 0 1 1 1 3 </DataItem> "
+                     "<DataItem Format=\"HDF\" NumberType=\"Float\" Precision=\"8\" Dimensions=\"4 3\"> file.h5:/group/origins </DataItem> </DataItem>\n" );
+      }
+   }
+}
+
+SCENARIO( "Block topology string can be properly created", "[1rank]" ) {
+   GIVEN( "A block with 4, 2 and 1 cells in x, y and z-direction" ) {
+      WHEN( "Created with these cells" ) {
+         REQUIRE( XdmfUtilities::BlockTopologyString( { 4, 2, 1 } ) == "      <Topology TopologyType=\"3DCoRectMesh\" Dimensions=\"2 3 5\"/>\n" );
+      }
+   }
+}
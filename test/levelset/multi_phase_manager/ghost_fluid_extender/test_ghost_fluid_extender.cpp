@@ -0,0 +1,256 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "communication/communication_manager.h"
+#include "communication/internal_halo_manager.h"
+#include "enums/interface_tag_definition.h"
+#include "halo_manager.h"
+#include "levelset/multi_phase_manager/ghost_fluid_extender/fedkiw_iterative_ghost_fluid_extender.h"
+#include "levelset/multi_phase_manager/material_sign_capsule.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/material_manager.h"
+#include "topology/id_information.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+
+namespace {
+   /**
+    * @brief The level-set gradient in the extension. It is shallow enough that the extension does not converge within the maximum number of iterations. Hence,
+    *        the extensions with different halo update intervals carry out the same sweeps and have to agree bit for bit.
+    */
+   constexpr double levelset_gradient = 0.01;
+
+   /**
+    * @brief Gives the level-set value ( in cell sizes ) of the given global cell in x-direction. The domain of two blocks is periodic. The negative material fills
+    *        a slab in the second block whose east interface lies beyond the halos of the first block. Hence, the extension from this interface runs through the
+    *        halos of the first block into its internal cells.
+    */
+   double LevelsetOfCell( int const global_i ) {
+      double const domain_length = 2.0 * CC::ICX();
+      double const slab_center   = domain_length - 7.0;
+      double const x             = std::fmod( static_cast<double>( global_i ) + 0.5 + domain_length, domain_length );
+      double const distance      = std::min( std::abs( x - slab_center ), domain_length - std::abs( x - slab_center ) );
+      return distance - 2.25;
+   }
+
+   /**
+    * @brief Gives the real-material value of the given prime state in the given global cell in x-direction.
+    */
+   double PrimeStateOfCell( int const global_i, unsigned int const prime_state_index ) {
+      double const x = static_cast<double>( global_i ) + 0.5;
+      return 1.0 + 0.1 * static_cast<double>( prime_state_index + 1 ) * std::sin( M_PI * x / CC::ICX() );
+   }
+
+   /**
+    * @brief Sets level set, volume fraction, interface tags and prime states in all cells ( including halos ) of the node. The ghost material is zero. The bands
+    *        are wide enough for the extension to reach the internal cells of the first block.
+    */
+   void SetFields( nid_t const id, Node& node ) {
+      int const first_global_i = static_cast<int>( DomainCoordinatesOfId( id, static_cast<double>( CC::ICX() ) )[0] ) - static_cast<int>( CC::FICX() );
+      double( &levelset )[CC::TCX()][CC::TCY()][CC::TCZ()]        = node.GetInterfaceBlock().GetReinitializedBuffer( InterfaceDescription::Levelset );
+      double( &volume_fraction )[CC::TCX()][CC::TCY()][CC::TCZ()] = node.GetInterfaceBlock().GetReinitializedBuffer( InterfaceDescription::VolumeFraction );
+      std::int8_t( &interface_tags )[CC::TCX()][CC::TCY()][CC::TCZ()] = node.GetInterfaceTags<InterfaceDescriptionBufferType::Reinitialized>();
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         int const global_i = first_global_i + static_cast<int>( i );
+         double const phi   = LevelsetOfCell( global_i );
+         std::int8_t const tag = std::abs( phi ) < 0.5   ? ITTI( IT::OldCutCell )
+                                 : std::abs( phi ) <= 1.5 ? ITTI( IT::CutCellNeighbor )
+                                 : std::abs( phi ) <= 7.5 ? ITTI( IT::ExtensionBand )
+                                 : std::abs( phi ) <= 8.5 ? ITTI( IT::ReinitializationBand )
+                                                          : ITTI( IT::BulkPhase );
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               levelset[i][j][k]        = levelset_gradient * phi;
+               volume_fraction[i][j][k] = std::clamp( 0.5 + phi, 0.0, 1.0 );
+               interface_tags[i][j][k]  = phi < 0.0 ? -tag : tag;
+            }
+         }
+         for( auto& [material, block] : node.GetPhases() ) {
+            bool const is_real = MaterialSignCapsule::SignOfMaterial( material ) * phi > 0.0;
+            for( unsigned int p = 0; p < MF::ANOP(); ++p ) {
+               double( &prime_state )[CC::TCX()][CC::TCY()][CC::TCZ()] = block.GetFieldBuffer( MaterialFieldType::PrimeStates, p );
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     prime_state[i][j][k] = is_real ? PrimeStateOfCell( global_i, p ) : 0.0;
+                  }
+               }
+            }
+         }
+      }
+   }
+}// namespace
+
+SCENARIO( "Ghost-fluid extension with several iterations between two halo updates agrees with a halo update in every iteration", "[1rank],[2rank]" ) {
+   constexpr MaterialName material_one = MaterialName::MaterialOne;
+   constexpr MaterialName material_two = MaterialName::MaterialTwo;
+
+   GIVEN( "Two periodic multi-phase nodes with an interface beyond the halos of one node" ) {
+      constexpr unsigned int maximum_level = 0;
+      TopologyManager topology             = TopologyManager( { 2, 1, 1 }, maximum_level, 7 );
+      Tree tree                            = Tree( topology, maximum_level, 1.0 );
+      for( auto const id : topology.LocalLeafIds() ) {
+         topology.AddMaterialToNode( id, material_one );
+         topology.AddMaterialToNode( id, material_two );
+         tree.CreateNode( id, { material_one, material_two } );
+         tree.GetNodeWithId( id ).SetInterfaceBlock( std::make_unique<InterfaceBlock>( 0.0 ) );
+      }
+      topology.UpdateTopology();
+
+      CommunicationManager communication         = CommunicationManager( topology, maximum_level );
+      InternalHaloManager internal_halos         = InternalHaloManager( tree, topology, communication, 2 );
+      ExternalHaloManager const external_halos   = ExternalHaloManager( {}, {} );
+      HaloManager halo_manager                   = HaloManager( tree, external_halos, internal_halos, communication, maximum_level );
+
+      // The extension does not use the material properties, but the material signs of both materials
+      UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+      std::unordered_map<std::string, double> const eos_data = { { "gamma", 1.4 }, { "backgroundPressure", 0.0 } };
+      std::vector<std::tuple<MaterialType, Material>> materials;
+      materials.emplace_back( std::make_tuple( MaterialType::Fluid, Material( std::make_unique<StiffenedGas const>( eos_data, unit_handler ), 0.0, 0.0, 0.0, 0.0, nullptr, nullptr, unit_handler ) ) );
+      MaterialManager const material_manager = MaterialManager( std::move( materials ), {} );
+      MaterialSignCapsule( material_one, material_two );
+      FedkiwGhostFluidExtender<MaterialFieldType::PrimeStates> const extender( material_manager, halo_manager );
+
+      std::vector<std::reference_wrapper<Node>> nodes;
+      for( auto const id : topology.LocalLeafIds() ) {
+         nodes.push_back( tree.GetNodeWithId( id ) );
+      }
+
+      auto const reset_fields = [&]() {
+         for( auto const id : topology.LocalLeafIds() ) {
+            SetFields( id, tree.GetNodeWithId( id ) );
+         }
+      };
+      // Gives the prime states of both materials in all internal cells of the local nodes
+      auto const internal_prime_states = [&]() {
+         std::vector<double> values;
+         for( auto const id : topology.LocalLeafIds() ) {
+            for( auto const material : { material_one, material_two } ) {
+               Block const& block = tree.GetNodeWithId( id ).GetPhaseByMaterial( material );
+               for( unsigned int p = 0; p < MF::ANOP(); ++p ) {
+                  double const( &prime_state )[CC::TCX()][CC::TCY()][CC::TCZ()] = block.GetFieldBuffer( MaterialFieldType::PrimeStates, p );
+                  for( unsigned int i = CC::FICX(); i <= CC::LICX(); ++i ) {
+                     for( unsigned int j = CC::FICY(); j <= CC::LICY(); ++j ) {
+                        for( unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k ) {
+                           values.push_back( prime_state[i][j][k] );
+                        }
+                     }
+                  }
+               }
+            }
+         }
+         return values;
+      };
+
+      reset_fields();
+      std::vector<double> const initial_values = internal_prime_states();
+      extender.Extend<1>( nodes );
+      std::vector<double> const reference_values = internal_prime_states();
+
+      THEN( "The extension fills the ghost material" ) {
+         double maximum_change = 0.0;
+         for( std::size_t index = 0; index < reference_values.size(); ++index ) {
+            maximum_change = std::max( maximum_change, std::abs( reference_values[index] - initial_values[index] ) );
+         }
+         MPI_Allreduce( MPI_IN_PLACE, &maximum_change, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+         REQUIRE( maximum_change > 0.1 );
+      }
+
+      WHEN( "The extension with the configured halo update interval is carried out" ) {
+         reset_fields();
+         extender.Extend( nodes );
+         std::vector<double> const values = internal_prime_states();
+
+         THEN( "The result is bit-identical to a halo update in every iteration" ) {
+            REQUIRE( values == reference_values );
+         }
+      }
+
+      WHEN( "The halos are updated every second and every fourth iteration only" ) {
+         reset_fields();
+         extender.Extend<2>( nodes );
+         std::vector<double> const values_two = internal_prime_states();
+         reset_fields();
+         extender.Extend<4>( nodes );
+         std::vector<double> const values_four = internal_prime_states();
+
+         THEN( "The results are bit-identical to a halo update in every iteration" ) {
+            REQUIRE( values_two == reference_values );
+            REQUIRE( values_four == reference_values );
+         }
+      }
+   }
+}
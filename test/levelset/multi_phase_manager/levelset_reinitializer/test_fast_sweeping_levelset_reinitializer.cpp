@@ -0,0 +1,249 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "enums/interface_tag_definition.h"
+#include "levelset/multi_phase_manager/levelset_reinitializer/fast_sweeping_levelset_reinitializer.h"
+#include "user_specifications/compile_time_constants.h"
+#include "utilities/mathematical_functions.h"
+
+namespace {
+   constexpr unsigned int number_of_dimensions = DTI( CC::DIM() );
+
+   /**
+    * @brief Gives the neighbor values of the Eikonal update with the given number of upwind directions. The other directions are far downwind.
+    */
+   std::array<double, number_of_dimensions> Neighbors( std::array<double, 3> const upwind_values, unsigned int const number_of_upwind_directions ) {
+      std::array<double, number_of_dimensions> neighbors;
+      neighbors.fill( 100.0 );
+      std::copy_n( std::cbegin( upwind_values ), std::min( number_of_upwind_directions, number_of_dimensions ), std::begin( neighbors ) );
+      return neighbors;
+   }
+
+   /**
+    * @brief Level-set field and interface tags of a single block.
+    */
+   struct LevelsetBlock {
+      double levelset_[CC::TCX()][CC::TCY()][CC::TCZ()];
+      std::int8_t interface_tags_[CC::TCX()][CC::TCY()][CC::TCZ()];
+   };
+
+   /**
+    * @brief Gives the signed distance ( in cell sizes ) of a cell to a plane through the block center whose normal points along the diagonal.
+    */
+   double PlaneDistance( unsigned int const i, unsigned int const j, unsigned int const k ) {
+      double const x = static_cast<double>( i ) - 0.5 * ( CC::TCX() - 1 );
+      double const y = CC::DIM() != Dimension::One ? static_cast<double>( j ) - 0.5 * ( CC::TCY() - 1 ) : 0.0;
+      double const z = CC::DIM() == Dimension::Three ? static_cast<double>( k ) - 0.5 * ( CC::TCZ() - 1 ) : 0.0;
+      return ( x + y + z ) / std::sqrt( static_cast<double>( number_of_dimensions ) );
+   }
+
+   /**
+    * @brief Creates a block with the given multiple of the plane distance in all cells ( including halos ) and tags cells within one cell size of the plane as cut cells.
+    */
+   std::unique_ptr<LevelsetBlock> PlaneBlock( double const scale ) {
+      auto block = std::make_unique<LevelsetBlock>();
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               double const distance            = PlaneDistance( i, j, k );
+               block->levelset_[i][j][k]       = scale * distance;
+               block->interface_tags_[i][j][k] = std::abs( distance ) <= 1.0 ? ITTI( IT::OldCutCell ) : std::abs( distance ) <= 4.0 ? ITTI( IT::ReinitializationBand ) : ITTI( IT::BulkPhase );
+            }
+         }
+      }
+      return block;
+   }
+
+   /**
+    * @brief Sets the halo cells of the block to the plane distance as a halo update from reinitialized neighbor blocks would do.
+    */
+   void SetHalosToPlaneDistance( LevelsetBlock& block ) {
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               bool const internal = i >= CC::FICX() && i <= CC::LICX() && j >= CC::FICY() && j <= CC::LICY() && k >= CC::FICZ() && k <= CC::LICZ();
+               if( !internal ) {
+                  block.levelset_[i][j][k] = PlaneDistance( i, j, k );
+               }
+            }
+         }
+      }
+   }
+
+   /**
+    * @brief Gives the largest deviation of the internal cells of the block from the plane distance limited by the cut-off value.
+    */
+   double MaximumDeviationFromPlaneDistance( LevelsetBlock const& block ) {
+      double deviation = 0.0;
+      for( unsigned int i = CC::FICX(); i <= CC::LICX(); ++i ) {
+         for( unsigned int j = CC::FICY(); j <= CC::LICY(); ++j ) {
+            for( unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k ) {
+               double const distance = PlaneDistance( i, j, k );
+               double const expected = Signum( distance ) * std::min( std::abs( distance ), CC::LSCOF() );
+               deviation             = std::max( deviation, std::abs( block.levelset_[i][j][k] - expected ) );
+            }
+         }
+      }
+      return deviation;
+   }
+}// namespace
+
+SCENARIO( "The local Eikonal update gives the distance from the upwind neighbors", "[1rank]" ) {
+   GIVEN( "One upwind direction" ) {
+      WHEN( "The upwind neighbor is half a cell away from the interface" ) {
+         THEN( "The cell is one cell size further away" ) {
+            REQUIRE( FastSweeping::SolveEikonal( Neighbors( { 0.5, 0.0, 0.0 }, 1 ) ) == Approx( 1.5 ) );
+         }
+      }
+      WHEN( "The other directions are only slightly downwind of the solution" ) {
+         std::array<double, number_of_dimensions> neighbors;
+         neighbors.fill( 1.0 );
+         neighbors[0] = 0.0;
+         THEN( "They are not taken into account" ) {
+            REQUIRE( FastSweeping::SolveEikonal( neighbors ) == Approx( 1.0 ) );
+         }
+      }
+   }
+   if constexpr( number_of_dimensions > 1 ) {
+      GIVEN( "Two upwind directions on the interface" ) {
+         WHEN( "The Eikonal update is solved" ) {
+            THEN( "The distance is the one of a diagonal interface" ) {
+               REQUIRE( FastSweeping::SolveEikonal( Neighbors( { 0.0, 0.0, 0.0 }, 2 ) ) == Approx( 1.0 / std::sqrt( 2.0 ) ) );
+            }
+         }
+      }
+   }
+   if constexpr( number_of_dimensions > 2 ) {
+      GIVEN( "Three upwind directions" ) {
+         WHEN( "All upwind neighbors lie on the interface" ) {
+            THEN( "The distance is the one of a space-diagonal interface" ) {
+               REQUIRE( FastSweeping::SolveEikonal( Neighbors( { 0.0, 0.0, 0.0 }, 3 ) ) == Approx( 1.0 / std::sqrt( 3.0 ) ) );
+            }
+         }
+         WHEN( "The upwind neighbors differ" ) {
+            double const distance = FastSweeping::SolveEikonal( Neighbors( { 0.2, 0.3, 0.4 }, 3 ) );
+            THEN( "The discrete Eikonal equation is satisfied" ) {
+               double const residual = ( distance - 0.2 ) * ( distance - 0.2 ) + ( distance - 0.3 ) * ( distance - 0.3 ) + ( distance - 0.4 ) * ( distance - 0.4 );
+               REQUIRE( residual == Approx( 1.0 ) );
+               REQUIRE( distance > 0.4 );
+            }
+         }
+      }
+   }
+}
+
+SCENARIO( "A single block is swept to the signed distance of a plane", "[1rank]" ) {
+   GIVEN( "A block holding the exact signed distance of a diagonal plane" ) {
+      std::unique_ptr<LevelsetBlock> block = PlaneBlock( 1.0 );
+      WHEN( "The block is initialized and swept once" ) {
+         FastSweeping::InitializeBlock( block->interface_tags_, block->levelset_, false );
+         FastSweeping::SweepBlock( block->interface_tags_, block->levelset_ );
+         THEN( "The signed distance is recovered up to the cut-off value" ) {
+            REQUIRE( MaximumDeviationFromPlaneDistance( *block ) < 1.0e-12 );
+         }
+         THEN( "A second sweep does not change the field any more" ) {
+            REQUIRE( FastSweeping::SweepBlock( block->interface_tags_, block->levelset_ ) == 0.0 );
+         }
+      }
+   }
+   GIVEN( "A block holding twice the signed distance of a diagonal plane" ) {
+      std::unique_ptr<LevelsetBlock> block = PlaneBlock( 2.0 );
+      WHEN( "The block is initialized with the reinitialization of cut cells and swept in two rounds with a halo update in between" ) {
+         FastSweeping::InitializeBlock( block->interface_tags_, block->levelset_, true );
+         FastSweeping::SweepBlock( block->interface_tags_, block->levelset_ );
+         SetHalosToPlaneDistance( *block );
+         FastSweeping::SweepBlock( block->interface_tags_, block->levelset_ );
+         THEN( "The signed distance is recovered up to the cut-off value" ) {
+            REQUIRE( MaximumDeviationFromPlaneDistance( *block ) < 1.0e-12 );
+         }
+      }
+      WHEN( "The block is initialized without the reinitialization of cut cells" ) {
+         FastSweeping::InitializeBlock( block->interface_tags_, block->levelset_, false );
+         THEN( "The cut cells keep their level-set value" ) {
+            for( unsigned int i = CC::FICX(); i <= CC::LICX(); ++i ) {
+               for( unsigned int j = CC::FICY(); j <= CC::LICY(); ++j ) {
+                  for( unsigned int k = CC::FICZ(); k <= CC::LICZ(); ++k ) {
+                     if( block->interface_tags_[i][j][k] == ITTI( IT::OldCutCell ) ) {
+                        REQUIRE( block->levelset_[i][j][k] == 2.0 * PlaneDistance( i, j, k ) );
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
@@ -66,6 +66,7 @@
 * Munich, February 10th, 2021                                                            *
 *                                                                                        *
 *****************************************************************************************/
+#include <array>
 #include <catch2/catch.hpp>
 #include <limits>
 
@@ -152,6 +153,50 @@ namespace TestEos {
    constexpr auto ArbitraryPrimes() {
       return std::make_tuple( 2.4, 3.75, 0.75, 1.9, 4.003 );
    }
+
+   /**
+    * @brief Tests that the batched computations give the same results as the computations for single cells.
+    * @param equation_of_state The equation of state under test.
+    * @note Values derived from the arbitrary conservatives and prime states are used for each cell of the batch.
+    */
+   void BatchedCalculations( std::unique_ptr<EquationOfState const> const& equation_of_state ) {
+      constexpr unsigned int number_of_cells                             = 5;
+      auto const [mass, energy, momentum_x, momentum_y, momentum_z]      = ArbitraryConservatives();
+      auto const [density, pressure, velocity_x, velocity_y, velocity_z] = ArbitraryPrimes();
+      std::array<double, number_of_cells> masses, energies, momenta_x, momenta_y, momenta_z;
+      std::array<double, number_of_cells> densities, pressures, velocities_x, velocities_y, velocities_z;
+      for( unsigned int c = 0; c < number_of_cells; ++c ) {
+         double const factor = 1.0 + 0.1 * c;
+         masses[c]           = mass * factor;
+         energies[c]         = energy * factor * factor;
+         momenta_x[c]        = momentum_x * factor;
+         momenta_y[c]        = momentum_y / factor;
+         momenta_z[c]        = momentum_z - factor;
+         densities[c]        = density * factor;
+         pressures[c]        = pressure * factor * factor;
+         velocities_x[c]     = velocity_x * factor;
+         velocities_y[c]     = velocity_y / factor;
+         velocities_z[c]     = velocity_z - factor;
+      }
+
+      std::array<double, number_of_cells> batched_pressures, batched_temperatures, batched_energies, batched_speeds_of_sound;
+      equation_of_state->PressureBatch( number_of_cells, masses.data(), momenta_x.data(), momenta_y.data(), momenta_z.data(), energies.data(), batched_pressures.data() );
+      equation_of_state->TemperatureBatch( number_of_cells, masses.data(), momenta_x.data(), momenta_y.data(), momenta_z.data(), energies.data(), batched_temperatures.data() );
+      equation_of_state->EnergyBatch( number_of_cells, densities.data(), velocities_x.data(), velocities_y.data(), velocities_z.data(), pressures.data(), batched_energies.data() );
+      equation_of_state->SpeedOfSoundBatch( number_of_cells, densities.data(), pressures.data(), batched_speeds_of_sound.data() );
+
+      for( unsigned int c = 0; c < number_of_cells; ++c ) {
+         // momenta and velocities of directions that are not part of the simulation are not considered in the batch
+         double const momentum_y_cell = CC::DIM() != Dimension::One ? momenta_y[c] : 0.0;
+         double const momentum_z_cell = CC::DIM() == Dimension::Three ? momenta_z[c] : 0.0;
+         double const velocity_y_cell = CC::DIM() != Dimension::One ? velocities_y[c] : 0.0;
+         double const velocity_z_cell = CC::DIM() == Dimension::Three ? velocities_z[c] : 0.0;
+         REQUIRE( batched_pressures[c] == equation_of_state->Pressure( masses[c], momenta_x[c], momentum_y_cell, momentum_z_cell, energies[c] ) );
+         REQUIRE( batched_temperatures[c] == equation_of_state->Temperature( masses[c], momenta_x[c], momentum_y_cell, momentum_z_cell, energies[c] ) );
+         REQUIRE( batched_energies[c] == equation_of_state->Energy( densities[c], velocities_x[c], velocity_y_cell, velocity_z_cell, pressures[c] ) );
+         REQUIRE( batched_speeds_of_sound[c] == equation_of_state->SpeedOfSound( densities[c], pressures[c] ) );
+      }
+   }
 }// namespace TestEos
 
 SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
@@ -180,6 +225,9 @@ SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
          THEN( "The quantities computed from primes" ) {
             TestEos::CalculationsFromPrimes( equation_of_state, 35.819144133333332, 1.957890020745122, 2.8958333333333335, density, pressure, velocity_x, velocity_y, velocity_z );
          }
+         THEN( "The batched computations equal the single cell computations" ) {
+            TestEos::BatchedCalculations( equation_of_state );
+         }
       }
    }
 
@@ -208,6 +256,9 @@ SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
          THEN( "The quantities computed from primes" ) {
             TestEos::CalculationsFromPrimes( equation_of_state, 776470615.39804602, 33166.248007198526, 1100000001.5625, density, pressure, velocity_x, velocity_y, velocity_z );
          }
+         THEN( "The batched computations equal the single cell computations" ) {
+            TestEos::BatchedCalculations( equation_of_state );
+         }
       }
    }
 
@@ -233,6 +284,9 @@ SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
          THEN( "The quantities computed from primes" ) {
             TestEos::CalculationsFromPrimes( equation_of_state, 44.185810800000006, 1.4053469322555197, 1.6625000000000001, density, pressure, velocity_x, velocity_y, velocity_z );
          }
+         THEN( "The batched computations equal the single cell computations" ) {
+            TestEos::BatchedCalculations( equation_of_state );
+         }
       }
    }
 
@@ -260,6 +314,9 @@ SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
          THEN( "The quantities computed from primes" ) {
             TestEos::CalculationsFromPrimes( equation_of_state, 27.147879765517239, 4.7758070871145257, 22.808333333333334, density, pressure, velocity_x, velocity_y, velocity_z );
          }
+         THEN( "The batched computations equal the single cell computations" ) {
+            TestEos::BatchedCalculations( equation_of_state );
+         }
       }
    }
 
@@ -289,6 +346,9 @@ SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
          THEN( "The quantities computed from primes" ) {
             TestEos::CalculationsFromPrimes( equation_of_state, 34.177700455172413, 5.0229928555731238, 15.205567846607668, density, pressure, velocity_x, velocity_y, velocity_z );
          }
+         THEN( "The batched computations equal the single cell computations" ) {
+            TestEos::BatchedCalculations( equation_of_state );
+         }
       }
    }
 
@@ -314,6 +374,9 @@ SCENARIO( "Equations of state getters and computation", "[1rank]" ) {
          THEN( "The quantities computed from primes" ) {
             TestEos::CalculationsFromPrimes( equation_of_state, -1.0, 2.2360679774997898, -1.0, density, pressure, velocity_x, velocity_y, velocity_z );
          }
+         THEN( "The batched computations equal the single cell computations" ) {
+            TestEos::BatchedCalculations( equation_of_state );
+         }
       }
    }
 }
@@ -349,7 +349,7 @@ SCENARIO( "Averaging material data yields correct results on a simple topology",
          }
 
          THEN( "The cut cells are propagated down into the parent on a (faked) multi-phase topology when averaged" ) {
-            AddMaterialToAllNodesInOneParentEightChildrenTopologyAndUpdate( topology, material );
+            AddMaterialToAllNodesInOneParentEightChildrenTopologyAndUpdate( topology, MaterialName::MaterialTwo );
             averager.AverageInterfaceTags( { maximum_level } );
             if( topology.NodeIsOnRank( root_id, my_rank ) ) { VerifyCornerTagsAveragedIntoParent( tree.GetNodeWithId( root_id ) ); }
          }
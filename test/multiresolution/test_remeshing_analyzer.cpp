@@ -0,0 +1,217 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "communication/communication_manager.h"
+#include "communication/mpi_utilities.h"
+#include "enums/remesh_identifier.h"
+#include "multiresolution/multiresolution.h"
+#include "multiresolution/remeshing_analyzer.h"
+#include "topology/id_information.h"
+#include "topology/topology_manager.h"
+#include "topology/tree.h"
+
+namespace {
+   /**
+    * @brief Indicates whether the values of a node deviate from a constant field, which triggers its refinement.
+    * @param id Id of the node.
+    * @return True if the node holds a peak, false otherwise.
+    */
+   bool NodeHasPeak( nid_t const id ) {
+      return LevelOfNode( id ) == 2 && PositionOfNodeAmongSiblings( id ) == 1;
+   }
+
+   /**
+    * @brief Fills the conservative buffers of a node, i.e. a field which is constant within each level-zero subtree, superimposed by a peak in the
+    *        first internal cell for some nodes.
+    * @param id Id of the node.
+    * @param conservatives The buffers to be filled.
+    */
+   void FillConservatives( nid_t const id, Conservatives& conservatives ) {
+      double const subtree_value = 1.0 + static_cast<double>( ( id >> ( 3 * LevelOfNode( id ) ) ) & 0x7 );
+      for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+         for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+            for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+               for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                  conservatives[e][i][j][k] = subtree_value;
+               }
+            }
+         }
+         if( NodeHasPeak( id ) ) {
+            conservatives[e][CC::FICX()][CC::FICY()][CC::FICZ()] = 10.0 * subtree_value;
+         }
+      }
+   }
+
+   /**
+    * @brief Gives the remeshing decision of a child computed from the buffers of the child and its parent without any communication.
+    * @param topology Topology of the nodes.
+    * @param multiresolution Multiresolution object performing the wavelet analysis.
+    * @param child_id Id of the child.
+    * @return The remeshing decision.
+    */
+   RemeshIdentifier ExpectedDecision( TopologyManager const& topology, Multiresolution const& multiresolution, nid_t const child_id ) {
+      if( topology.IsNodeMultiPhase( child_id ) || !topology.NodeIsLeaf( child_id ) ) {
+         return RemeshIdentifier::Neutral;
+      }
+      auto parent = std::make_unique<Conservatives>();
+      auto child  = std::make_unique<Conservatives>();
+      FillConservatives( ParentIdOfNode( child_id ), *parent );
+      FillConservatives( child_id, *child );
+      return multiresolution.ChildNeedsRemeshing<CC::NFWA()>( *parent, *child, child_id );
+   }
+}// namespace
+
+SCENARIO( "Remeshing decisions of children on other ranks than their parents are determined correctly", "[1rank],[2rank]" ) {
+   GIVEN( "A load-balanced topology with refined single- and multi-phase parents on levels zero and one" ) {
+      constexpr unsigned int maximum_level = 2;
+      TopologyManager topology             = TopologyManager( { 2, 1, 1 }, maximum_level, 0 );
+      Tree tree                            = Tree( topology, maximum_level, 1.0 );
+      topology.RefineNodeWithId( 0x1400000 );
+      topology.RefineNodeWithId( 0x1400001 );
+      topology.UpdateTopology();
+      topology.RefineNodeWithId( 0xA000000 );
+      topology.UpdateTopology();
+      for( auto const id : topology.LocalIds() ) {
+         topology.AddMaterialToNode( id, MaterialName::MaterialOne );
+      }
+      // A multi-phase leaf and its parent are locked against remeshing
+      if( MpiUtilities::MyRankId() == 0 ) {
+         topology.AddMaterialToNode( 0x1400000, MaterialName::MaterialTwo );
+         topology.AddMaterialToNode( 0xA000001, MaterialName::MaterialTwo );
+      }
+      topology.UpdateTopology();
+      topology.PrepareLoadBalancedTopology( MpiUtilities::NumberOfRanks() );
+      for( auto const id : topology.LocalIds() ) {
+         Node& node = tree.CreateNode( id, topology.GetMaterialsOfNode( id ) );
+         for( auto& [material, block] : node.GetPhases() ) {
+            FillConservatives( id, block.GetRightHandSideBuffer() );
+         }
+      }
+
+      if( MpiUtilities::NumberOfRanks() > 1 ) {
+         bool remote_child_exists = false;
+         for( unsigned int const level : { 1u, 2u } ) {
+            for( nid_t const id : topology.IdsOnLevel( level ) ) {
+               remote_child_exists |= topology.GetRankOfNode( id ) != topology.GetRankOfNode( ParentIdOfNode( id ) );
+            }
+         }
+         REQUIRE( remote_child_exists );
+      }
+
+      WHEN( "The nodes to be coarsened and refined are determined for the parents on levels zero and one" ) {
+         Multiresolution const multiresolution( Thresholder( maximum_level, maximum_level, 1.0e-2 ) );
+         CommunicationManager const communication( topology, maximum_level );
+         std::vector<nid_t> remove_list;
+         std::vector<nid_t> refine_list;
+         RemeshingAnalyzer( topology, tree, multiresolution, communication ).DetermineRemeshingNodes( { 0, 1 }, remove_list, refine_list );
+
+         THEN( "The lists of the local parents match the decisions computed without communication" ) {
+            std::vector<nid_t> expected_remove_list;
+            std::vector<nid_t> expected_refine_list;
+            for( unsigned int const level : { 0u, 1u } ) {
+               for( nid_t const parent_id : topology.IdsOnLevel( level ) ) {
+                  if( !topology.NodeIsOnRank( parent_id, MpiUtilities::MyRankId() ) ) continue;
+                  std::vector<nid_t> children;
+                  bool all_coarse = true;
+                  for( nid_t const child_id : IdsOfChildren( parent_id ) ) {
+                     if( !topology.NodeExists( child_id ) ) continue;
+                     children.push_back( child_id );
+                     RemeshIdentifier const decision = ExpectedDecision( topology, multiresolution, child_id );
+                     all_coarse &= decision == RemeshIdentifier::Coarse;
+                     if( decision == RemeshIdentifier::Refine ) {
+                        expected_refine_list.push_back( child_id );
+                     }
+                  }
+                  if( !children.empty() && all_coarse && !topology.IsNodeMultiPhase( parent_id ) ) {
+                     expected_remove_list.insert( expected_remove_list.end(), children.begin(), children.end() );
+                  }
+               }
+            }
+            std::sort( remove_list.begin(), remove_list.end() );
+            std::sort( refine_list.begin(), refine_list.end() );
+            std::sort( expected_remove_list.begin(), expected_remove_list.end() );
+            std::sort( expected_refine_list.begin(), expected_refine_list.end() );
+            REQUIRE( remove_list == expected_remove_list );
+            REQUIRE( refine_list == expected_refine_list );
+         }
+
+         THEN( "Children are both coarsened and refined across all ranks" ) {
+            unsigned long long list_sizes[2] = { remove_list.size(), refine_list.size() };
+            MPI_Allreduce( MPI_IN_PLACE, list_sizes, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+            REQUIRE( list_sizes[0] > 0 );
+            REQUIRE( list_sizes[1] > 0 );
+         }
+      }
+   }
+}
@@ -140,4 +140,47 @@ SCENARIO( "Conservative quantities and prime state values can be converted into
          }
       }
    }
+
+   GIVEN( "Full buffers of prime states" ) {
+      auto prime_states = std::make_unique<PrimeStates>();
+      for( unsigned int p = 0; p < MF::ANOP(); ++p ) {
+         for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+            for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+               for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                  ( *prime_states )[p][i][j][k] = double( p + 2 ) + 0.01 * i + 0.02 * j + 0.03 * k;
+               }
+            }
+         }
+      }
+
+      // Obtain the material name of the single initialized material
+      MaterialName const material_name = material_manager.GetMaterialNames().front();
+
+      WHEN( "The buffers are converted to conservatives and back to prime states" ) {
+         auto conservatives    = std::make_unique<Conservatives>();
+         auto prime_states_new = std::make_unique<PrimeStates>();
+         prime_state_handler.ConvertPrimeStatesToConservatives( material_name, *prime_states, *conservatives );
+         prime_state_handler.ConvertConservativesToPrimeStates( material_name, *conservatives, *prime_states_new );
+
+         THEN( "Each cell equals the conversion of the single cell" ) {
+            PrimeStates const& original_prime_states = *prime_states;
+            for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+               for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+                  for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+                     std::array<double, MF::ANOE()> conservatives_cell;
+                     std::array<double, MF::ANOP()> prime_states_cell;
+                     prime_state_handler.ConvertPrimeStatesToConservatives( material_name, original_prime_states.GetCellView( i, j, k ), conservatives_cell );
+                     prime_state_handler.ConvertConservativesToPrimeStates( material_name, conservatives_cell, prime_states_cell );
+                     for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+                        REQUIRE( ( *conservatives )[e][i][j][k] == conservatives_cell[e] );
+                     }
+                     for( unsigned int p = 0; p < MF::ANOP(); ++p ) {
+                        REQUIRE( ( *prime_states_new )[p][i][j][k] == prime_states_cell[p] );
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
 }
@@ -0,0 +1,151 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "solvers/convective_term_contributions/finite_volume_pencil_scheme.h"
+#include "solvers/convective_term_contributions/finite_volume_scheme.h"
+#include "solvers/test_solver_helper.h"
+
+namespace {
+   using FluxArray = double[MF::ANOE()][CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1];
+
+   /**
+    * @brief Fluxes and volume forces of a single convective term update.
+    */
+   struct ConvectiveUpdate {
+      FluxArray fluxes_x;
+      FluxArray fluxes_y;
+      FluxArray fluxes_z;
+      double volume_forces[MF::ANOE()][CC::ICX()][CC::ICY()][CC::ICZ()];
+   };
+
+   /**
+    * @brief Gives a smooth flow state with a shock-like jump in the given cell. The velocities change sign across the block, such that all wave configurations
+    *        of the Riemann solvers occur.
+    */
+   TestSolver::CellState FlowStateOfCell( unsigned int const i, unsigned int const j, unsigned int const k ) {
+      double const x    = double( i ) / CC::TCX();
+      double const y    = double( j ) / CC::TCY();
+      double const z    = double( k ) / CC::TCZ();
+      double const jump = x + y + z < 1.2 ? 1.0 : 0.25;
+      return { jump * ( 1.0 + 0.2 * std::sin( 6.0 * x + 4.0 * y + 2.0 * z ) ),
+               { 2.0 * std::sin( 7.0 * x + y ), 1.5 * std::cos( 3.0 * y - 2.0 * z ), 1.8 * std::sin( 4.0 * z + x ) },
+               jump * ( 1.0 + 0.3 * std::cos( 5.0 * x - 3.0 * y + z ) ) };
+   }
+
+   /**
+    * @brief Indicates whether two flux arrays are identical.
+    */
+   bool FluxesAreIdentical( FluxArray const& fluxes, FluxArray const& other_fluxes ) {
+      return std::equal( &fluxes[0][0][0][0], &fluxes[0][0][0][0] + sizeof( FluxArray ) / sizeof( double ), &other_fluxes[0][0][0][0] );
+   }
+}// namespace
+
+SCENARIO( "The finite-volume pencil scheme gives the same fluxes as the finite-volume scheme", "[1rank]" ) {
+   GIVEN( "A block of an ideal gas with a varying flow state in all cells" ) {
+      MaterialManager const material_manager = TestSolver::StiffenedGasMaterialManager();
+      EigenDecomposition const eigendecomposition( material_manager );
+      auto const mat_block = std::make_unique<std::pair<MaterialName const, Block>>( std::piecewise_construct, std::forward_as_tuple( MaterialName::MaterialOne ), std::forward_as_tuple() );
+      TestSolver::FillBlock( material_manager.GetMaterial( MaterialName::MaterialOne ).GetEquationOfState(), mat_block->second, FlowStateOfCell );
+      double const cell_size = 0.1;
+
+      WHEN( "The convective fluxes are computed with both schemes" ) {
+         auto const reference = std::make_unique<ConvectiveUpdate>();
+         auto const pencil    = std::make_unique<ConvectiveUpdate>();
+         FiniteVolumeScheme const reference_scheme( material_manager, eigendecomposition );
+         FiniteVolumePencilScheme const pencil_scheme( material_manager, eigendecomposition );
+         reference_scheme.UpdateConvectiveFluxes( *mat_block, cell_size, reference->fluxes_x, reference->fluxes_y, reference->fluxes_z, reference->volume_forces );
+         pencil_scheme.UpdateConvectiveFluxes( *mat_block, cell_size, pencil->fluxes_x, pencil->fluxes_y, pencil->fluxes_z, pencil->volume_forces );
+
+         // The pencil scheme only computes fluxes for the settings it is implemented for
+         if constexpr( FiniteVolumePencilScheme::IsApplicable() ) {
+            THEN( "The fluxes in all directions are bit-wise identical" ) {
+               REQUIRE( FluxesAreIdentical( pencil->fluxes_x, reference->fluxes_x ) );
+               REQUIRE( FluxesAreIdentical( pencil->fluxes_y, reference->fluxes_y ) );
+               REQUIRE( FluxesAreIdentical( pencil->fluxes_z, reference->fluxes_z ) );
+            }
+            THEN( "The fluxes are non-trivial" ) {
+               double const* const energy_fluxes = &reference->fluxes_x[ETI( Equation::Energy )][0][0][0];
+               REQUIRE( std::any_of( energy_fluxes, energy_fluxes + ( CC::ICX() + 1 ) * ( CC::ICY() + 1 ) * ( CC::ICZ() + 1 ), []( double const flux ) { return flux != 0.0; } ) );
+            }
+         } else {
+            THEN( "The comparison is reported as skipped" ) {
+               WARN( "Skipped: the finite-volume pencil scheme is not implemented for the compiled equations, state reconstruction and Riemann solver. "
+                     "Compile with conservative or primitive reconstruction and the HLLC or HLL Riemann solver to compare its fluxes." );
+            }
+         }
+      }
+   }
+}
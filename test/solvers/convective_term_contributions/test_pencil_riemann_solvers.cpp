@@ -0,0 +1,168 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include "solvers/convective_term_contributions/riemann_solvers/hll_riemann_solver.h"
+#include "solvers/convective_term_contributions/riemann_solvers/hllc_riemann_solver.h"
+#include "solvers/test_solver_helper.h"
+
+namespace {
+   constexpr unsigned int number_of_faces = 7;
+
+   /**
+    * @brief Fills the face states of a pencil with a varying flow state (supersonic to the left up to supersonic to the right).
+    */
+   void FillPencilFaceStates( EquationOfState const& eos, double const density_factor, PencilFaceStates<number_of_faces>& states,
+                              std::array<std::array<double, MF::ANOE()>, number_of_faces>& conservatives,
+                              std::array<std::array<double, MF::ANOP()>, number_of_faces>& prime_states, Direction const direction ) {
+      for( unsigned int f = 0; f < number_of_faces; ++f ) {
+         std::array<double, MF::ANOP()>& primes = prime_states[f];
+         primes.fill( 0.0 );
+         primes[PTI( PrimeState::Density )]  = density_factor * ( 1.0 + 0.1 * f );
+         primes[PTI( PrimeState::Pressure )] = 1.0 + 0.3 * f * density_factor;
+         for( unsigned int d = 0; d < DTI( CC::DIM() ); ++d ) {
+            primes[PTI( MF::AV()[d] )] = 0.2 * ( d + 1.0 ) * density_factor;
+         }
+         primes[PTI( MF::AV()[DTI( direction )] )] = -3.0 + f;
+         std::array<double, MF::ANOE()>& conservative = conservatives[f];
+         conservative.fill( 0.0 );
+         conservative[ETI( Equation::Mass )] = primes[PTI( PrimeState::Density )];
+         for( unsigned int d = 0; d < DTI( CC::DIM() ); ++d ) {
+            conservative[ETI( MF::AME()[d] )] = primes[PTI( PrimeState::Density )] * primes[PTI( MF::AV()[d] )];
+         }
+         conservative[ETI( Equation::Energy )] = eos.Energy( primes[PTI( PrimeState::Density )], primes[PTI( PrimeState::VelocityX )],
+                                                            CC::DIM() != Dimension::One ? primes[PTI( PrimeState::VelocityY )] : 0.0,
+                                                            CC::DIM() == Dimension::Three ? primes[PTI( PrimeState::VelocityZ )] : 0.0,
+                                                            primes[PTI( PrimeState::Pressure )] );
+         for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+            states.conservatives_[e][f] = conservatives[f][e];
+         }
+         states.velocity_[f]       = primes[PTI( MF::AV()[DTI( direction )] )];
+         states.pressure_[f]       = primes[PTI( PrimeState::Pressure )];
+         states.speed_of_sound_[f] = eos.SpeedOfSound( primes[PTI( PrimeState::Density )], primes[PTI( PrimeState::Pressure )] );
+      }
+   }
+
+   /**
+    * @brief Checks that the pencil solution of a Riemann solver equals the solution of the single face procedure.
+    */
+   template<typename RiemannSolverType, Direction DIR>
+   void CheckPencilAgainstSingleFaces( MaterialManager const& material_manager, RiemannSolverType const& riemann_solver ) {
+      EquationOfState const& eos = material_manager.GetMaterial( MaterialName::MaterialOne ).GetEquationOfState();
+      PencilFaceStates<number_of_faces> states_left;
+      PencilFaceStates<number_of_faces> states_right;
+      std::array<std::array<double, MF::ANOE()>, number_of_faces> conservatives_left;
+      std::array<std::array<double, MF::ANOE()>, number_of_faces> conservatives_right;
+      std::array<std::array<double, MF::ANOP()>, number_of_faces> primes_left;
+      std::array<std::array<double, MF::ANOP()>, number_of_faces> primes_right;
+      FillPencilFaceStates( eos, 1.0, states_left, conservatives_left, primes_left, DIR );
+      FillPencilFaceStates( eos, 0.5, states_right, conservatives_right, primes_right, DIR );
+
+      double fluxes[MF::ANOE()][number_of_faces];
+      riemann_solver.template SolveRiemannProblemPencil<DIR>( MaterialName::MaterialOne, states_left, states_right, fluxes );
+
+      for( unsigned int f = 0; f < number_of_faces; ++f ) {
+         std::array<double, MF::ANOE()> const face_fluxes = riemann_solver.template SolveRiemannProblem<DIR>( MaterialName::MaterialOne, conservatives_left[f], conservatives_right[f],
+                                                                                                              primes_left[f], primes_right[f] );
+         for( unsigned int e = 0; e < MF::ANOE(); ++e ) {
+            REQUIRE( fluxes[e][f] == Approx( face_fluxes[e] ) );
+         }
+      }
+   }
+}// namespace
+
+SCENARIO( "The pencil Riemann solvers give the same fluxes as the single face Riemann solvers", "[1rank]" ) {
+   GIVEN( "A material manager with an ideal gas" ) {
+      MaterialManager const material_manager = TestSolver::StiffenedGasMaterialManager();
+      EigenDecomposition const eigendecomposition( material_manager );
+      WHEN( "The HLLC Riemann solver is used" ) {
+         HllcRiemannSolver const riemann_solver( material_manager, eigendecomposition );
+         THEN( "The fluxes are identical in all directions" ) {
+            CheckPencilAgainstSingleFaces<HllcRiemannSolver, Direction::X>( material_manager, riemann_solver );
+            if constexpr( CC::DIM() != Dimension::One ) {
+               CheckPencilAgainstSingleFaces<HllcRiemannSolver, Direction::Y>( material_manager, riemann_solver );
+            }
+            if constexpr( CC::DIM() == Dimension::Three ) {
+               CheckPencilAgainstSingleFaces<HllcRiemannSolver, Direction::Z>( material_manager, riemann_solver );
+            }
+         }
+      }
+      WHEN( "The HLL Riemann solver is used" ) {
+         HllRiemannSolver const riemann_solver( material_manager, eigendecomposition );
+         THEN( "The fluxes are identical in all directions" ) {
+            CheckPencilAgainstSingleFaces<HllRiemannSolver, Direction::X>( material_manager, riemann_solver );
+            if constexpr( CC::DIM() != Dimension::One ) {
+               CheckPencilAgainstSingleFaces<HllRiemannSolver, Direction::Y>( material_manager, riemann_solver );
+            }
+            if constexpr( CC::DIM() == Dimension::Three ) {
+               CheckPencilAgainstSingleFaces<HllRiemannSolver, Direction::Z>( material_manager, riemann_solver );
+            }
+         }
+      }
+   }
+}
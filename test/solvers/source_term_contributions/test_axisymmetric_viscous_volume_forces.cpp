@@ -69,32 +69,13 @@
 #include <catch2/catch.hpp>
 #include "solvers/source_term_contributions/axisymmetric_viscous_volume_forces.h"
 #include "topology/node.h"
-#include "materials/equations_of_state/stiffened_gas.h"
+#include "solvers/test_solver_helper.h"
 
 namespace {
    MaterialManager ReturnMaterialManagerWithViscosities( double const shear_viscosity, double const bulk_viscosity ) {
-      // Initialize the unit handler class
-      UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
-
-      // Here the stiffened gas complete safe equation of state is used since it provides a temperature computation and the unit test does not depend on the
-      // activation of the temperature in the primestate struct
-      std::unordered_map<std::string, double> const eos_data = { { "gamma", 1.4 }, { "backgroundPressure", 0.0 } };
-      std::unique_ptr<EquationOfState const> equation_of_state( std::make_unique<StiffenedGas const>( eos_data, unit_handler ) );
-
-      // Define material properties and initialize material
-      MaterialType const material_type       = MaterialType::Fluid;
       double const specific_heat_capacity    = 3.0;
       double const thermal_heat_conductivity = 4.0;
-
-      // Instantiate material
-      std::vector<std::tuple<MaterialType, Material>> materials;
-      materials.emplace_back( std::make_tuple( material_type, Material( std::move( equation_of_state ), bulk_viscosity, shear_viscosity, thermal_heat_conductivity, specific_heat_capacity,
-                                                                        nullptr, nullptr, unit_handler ) ) );
-
-      // Instantiate material pairing
-      std::vector<MaterialPairing> material_pairings;
-
-      return MaterialManager( std::move( materials ), std::move( material_pairings ) );
+      return TestSolver::StiffenedGasMaterialManager( bulk_viscosity, shear_viscosity, thermal_heat_conductivity, specific_heat_capacity );
    }
 }// namespace
 
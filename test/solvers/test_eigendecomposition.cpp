@@ -0,0 +1,140 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <catch2/catch.hpp>
+#include "solvers/eigendecomposition.h"
+#include "solvers/test_solver_helper.h"
+
+namespace {
+   /**
+    * @brief Gives a smoothly varying flow state in the given cell. Cells with i >= ghost_start are ghost-material cells with zero density.
+    */
+   TestSolver::CellState FlowStateOfCell( unsigned int const i, unsigned int const j, unsigned int const k, unsigned int const ghost_start ) {
+      if( i >= ghost_start ) {
+         return { 0.0, { 0.0, 0.0, 0.0 }, 0.0 };
+      }
+      return { 1.0 + 0.01 * i + 0.02 * j + 0.03 * k, { 0.3 + 0.01 * j, -0.2, 0.1 * k }, 2.0 - 0.01 * i };
+   }
+}// namespace
+
+SCENARIO( "The Roe eigendecomposition can be computed for single cell faces", "[1rank]" ) {
+   GIVEN( "A block with valid states and ghost-material cells" ) {
+      MaterialManager const material_manager = TestSolver::StiffenedGasMaterialManager();
+      EigenDecomposition const eigendecomposition( material_manager );
+      auto mat_block = std::make_unique<std::pair<MaterialName const, Block>>( std::piecewise_construct, std::forward_as_tuple( MaterialName::MaterialOne ), std::forward_as_tuple() );
+      constexpr unsigned int ghost_start = CC::FICX() + 4;
+      TestSolver::FillBlock( material_manager.GetMaterial( MaterialName::MaterialOne ).GetEquationOfState(), mat_block->second,
+                             [ghost_start]( unsigned int const i, unsigned int const j, unsigned int const k ) { return FlowStateOfCell( i, j, k, ghost_start ); } );
+
+      double left_eigenvectors[MF::ANOE()][MF::ANOE()];
+      double right_eigenvectors[MF::ANOE()][MF::ANOE()];
+      double eigenvalues[MF::ANOE()];
+
+      WHEN( "The eigendecomposition is computed at a face between two valid cells" ) {
+         bool const valid = eigendecomposition.ComputeRoeEigendecompositionAtFace<Direction::X>( *mat_block, CC::FICX(), CC::FICY(), CC::FICZ(), left_eigenvectors,
+                                                                                               right_eigenvectors, eigenvalues );
+         THEN( "The face is valid and the left eigenvectors are the inverse of the right eigenvectors" ) {
+            REQUIRE( valid );
+            for( unsigned int m = 0; m < MF::ANOE(); ++m ) {
+               for( unsigned int n = 0; n < MF::ANOE(); ++n ) {
+                  double product = 0.0;
+                  for( unsigned int l = 0; l < MF::ANOE(); ++l ) {
+                     product += left_eigenvectors[m][l] * right_eigenvectors[l][n];
+                  }
+                  REQUIRE( product == Approx( m == n ? 1.0 : 0.0 ).margin( 1.0e-12 ) );
+               }
+            }
+         }
+         THEN( "The block-wide eigendecomposition gives the same eigenvectors at this face" ) {
+            using FaceBuffer       = double[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][MF::ANOE()][MF::ANOE()];
+            using EigenvalueBuffer = double[CC::ICX() + 1][CC::ICY() + 1][CC::ICZ() + 1][MF::ANOE()];
+            // static to keep the block-sized buffers off the stack
+            static FaceBuffer block_left_eigenvectors;
+            static FaceBuffer block_right_eigenvectors;
+            static EigenvalueBuffer block_eigenvalues;
+            eigendecomposition.ComputeRoeEigendecomposition<Direction::X>( *mat_block, block_left_eigenvectors, block_right_eigenvectors, block_eigenvalues );
+            // the block-wide buffers are shifted by one in every direction, also in the collapsed ones
+            for( unsigned int m = 0; m < MF::ANOE(); ++m ) {
+               for( unsigned int n = 0; n < MF::ANOE(); ++n ) {
+                  REQUIRE( block_left_eigenvectors[1][1][1][m][n] == left_eigenvectors[m][n] );
+                  REQUIRE( block_right_eigenvectors[1][1][1][m][n] == right_eigenvectors[m][n] );
+               }
+               REQUIRE( block_eigenvalues[1][1][1][m] == eigenvalues[m] );
+            }
+         }
+      }
+
+      WHEN( "The eigendecomposition is computed at a face next to a ghost-material cell" ) {
+         bool const valid = eigendecomposition.ComputeRoeEigendecompositionAtFace<Direction::X>( *mat_block, ghost_start - 1, CC::FICY(), CC::FICZ(), left_eigenvectors,
+                                                                                               right_eigenvectors, eigenvalues );
+         THEN( "The face is flagged as invalid" ) {
+            REQUIRE_FALSE( valid );
+         }
+      }
+   }
+}
@@ -0,0 +1,130 @@
+/*****************************************************************************************
+*                                                                                        *
+* This file is part of ALPACA                                                            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+*  \\                                                                                    *
+*  l '>                                                                                  *
+*  | |                                                                                   *
+*  | |                                                                                   *
+*  | alpaca~                                                                             *
+*  ||    ||                                                                              *
+*  ''    ''                                                                              *
+*                                                                                        *
+* ALPACA is a MPI-parallelized C++ code framework to simulate compressible multiphase    *
+* flow physics. It allows for advanced high-resolution sharp-interface modeling          *
+* empowered with efficient multiresolution compression. The modular code structure       *
+* offers a broad flexibility to select among many most-recent numerical methods covering *
+* WENO/T-ENO, Riemann solvers (complete/incomplete), strong-stability preserving Runge-  *
+* Kutta time integration schemes, level set methods and many more.                       *
+*                                                                                        *
+* This code is developed by the 'Nanoshock group' at the Chair of Aerodynamics and       *
+* Fluid Mechanics, Technical University of Munich.                                       *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* LICENSE                                                                                *
+*                                                                                        *
+* ALPACA - Adaptive Level-set PArallel Code Alpaca                                       *
+* Copyright (C) 2020 Nikolaus A. Adams and contributors (see AUTHORS list)               *
+*                                                                                        *
+* This program is free software: you can redistribute it and/or modify it under          *
+* the terms of the GNU General Public License as published by the Free Software          *
+* Foundation version 3.                                                                  *
+*                                                                                        *
+* This program is distributed in the hope that it will be useful, but WITHOUT ANY        *
+* WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A        *
+* PARTICULAR PURPOSE. See the GNU General Public License for more details.               *
+*                                                                                        *
+* You should have received a copy of the GNU General Public License along with           *
+* this program (gpl-3.0.txt).  If not, see <https://www.gnu.org/licenses/gpl-3.0.html>   *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* THIRD-PARTY tools                                                                      *
+*                                                                                        *
+* Please note, several third-party tools are used by ALPACA. These tools are not shipped *
+* with ALPACA but available as git submodule (directing to their own repositories).      *
+* All used third-party tools are released under open-source licences, see their own      *
+* license agreement in 3rdParty/ for further details.                                    *
+*                                                                                        *
+* 1. tiny_xml           : See LICENSE_TINY_XML.txt for more information.                 *
+* 2. expression_toolkit : See LICENSE_EXPRESSION_TOOLKIT.txt for more information.       *
+* 3. FakeIt             : See LICENSE_FAKEIT.txt for more information                    *
+* 4. Catch2             : See LICENSE_CATCH2.txt for more information                    *
+* 5. ApprovalTests.cpp  : See LICENSE_APPROVAL_TESTS.txt for more information            *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* CONTACT                                                                                *
+*                                                                                        *
+* nanoshock@aer.mw.tum.de                                                                *
+*                                                                                        *
+******************************************************************************************
+*                                                                                        *
+* Munich, February 10th, 2021                                                            *
+*                                                                                        *
+*****************************************************************************************/
+#include <array>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "block_definitions/block.h"
+#include "materials/equations_of_state/stiffened_gas.h"
+#include "materials/material_manager.h"
+
+namespace TestSolver {
+
+   /**
+    * @brief Flow state of a single cell.
+    */
+   struct CellState {
+      double density;
+      std::array<double, 3> velocity;
+      double pressure;
+   };
+
+   /**
+    * @brief Gives a material manager with a single stiffened-gas fluid ( ideal gas with gamma = 1.4 ). The stiffened gas provides a temperature computation,
+    *        hence the tests do not depend on the activation of the temperature in the prime-state struct.
+    */
+   inline MaterialManager StiffenedGasMaterialManager( double const bulk_viscosity = 0.0, double const shear_viscosity = 0.0, double const thermal_heat_conductivity = 0.0,
+                                                       double const specific_heat_capacity = 0.0 ) {
+      UnitHandler const unit_handler( 1.0, 1.0, 1.0, 1.0 );
+      std::unordered_map<std::string, double> const eos_data = { { "gamma", 1.4 }, { "backgroundPressure", 0.0 } };
+      std::unique_ptr<EquationOfState const> equation_of_state( std::make_unique<StiffenedGas const>( eos_data, unit_handler ) );
+      std::vector<std::tuple<MaterialType, Material>> materials;
+      materials.emplace_back( std::make_tuple( MaterialType::Fluid, Material( std::move( equation_of_state ), bulk_viscosity, shear_viscosity, thermal_heat_conductivity,
+                                                                              specific_heat_capacity, nullptr, nullptr, unit_handler ) ) );
+      return MaterialManager( std::move( materials ), std::vector<MaterialPairing>() );
+   }
+
+   /**
+    * @brief Fills all cells of the block ( including halos ) with consistent prime states and conservatives ( in the average buffer ) of the given flow state.
+    * @param flow_state Callable giving the CellState of the cell with the given indices i, j, k.
+    */
+   template<typename FlowState>
+   void FillBlock( EquationOfState const& eos, Block& block, FlowState const& flow_state ) {
+      for( unsigned int i = 0; i < CC::TCX(); ++i ) {
+         for( unsigned int j = 0; j < CC::TCY(); ++j ) {
+            for( unsigned int k = 0; k < CC::TCZ(); ++k ) {
+               CellState const state = flow_state( i, j, k );
+               block.GetPrimeStateBuffer( PrimeState::Density )[i][j][k]  = state.density;
+               block.GetPrimeStateBuffer( PrimeState::Pressure )[i][j][k] = state.pressure;
+               block.GetAverageBuffer( Equation::Mass )[i][j][k]          = state.density;
+               for( unsigned int d = 0; d < DTI( CC::DIM() ); ++d ) {
+                  block.GetPrimeStateBuffer( MF::AV()[d] )[i][j][k] = state.velocity[d];
+                  block.GetAverageBuffer( MF::AME()[d] )[i][j][k]   = state.density * state.velocity[d];
+               }
+               block.GetAverageBuffer( Equation::Energy )[i][j][k] = eos.Energy( state.density, state.velocity[0], CC::DIM() != Dimension::One ? state.velocity[1] : 0.0,
+                                                                                 CC::DIM() == Dimension::Three ? state.velocity[2] : 0.0, state.pressure );
+            }
+         }
+      }
+   }
+}// namespace TestSolver
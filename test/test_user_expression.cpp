@@ -215,3 +215,30 @@ SCENARIO( "User expression evaluation", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "User expression evaluation with result references", "[1rank]" ) {
+   GIVEN( "A user expression of type f=x+y, g=x*y with references to both results." ) {
+      std::vector<double> point( 2, 0.0 );
+      std::vector<std::string> const variables_out = { "f", "g" };
+      std::vector<std::string> const variables_in  = { "x", "y" };
+      std::string const expression                 = "f := x + y; g := x * y;";
+      UserExpression const user_expression         = UserExpression( expression, variables_out, variables_in, point );
+      double const& f                              = user_expression.GetVariableReference( "f" );
+      double const& g                              = user_expression.GetVariableReference( "g" );
+
+      WHEN( "The expression is evaluated once for the point {x,y} = {1.5, -2.0}" ) {
+         point[0] = 1.5;
+         point[1] = -2.0;
+         user_expression.Evaluate();
+         THEN( "Both references hold the results {f,g} = {-0.5, -3.0}" ) {
+            REQUIRE( f == Approx( -0.5 ) );
+            REQUIRE( g == Approx( -3.0 ) );
+         }
+      }
+      WHEN( "A reference to an unknown variable is requested." ) {
+         THEN( "An exception should be thrown." ) {
+            REQUIRE_THROWS( user_expression.GetVariableReference( "h" ) );
+         }
+      }
+   }
+}
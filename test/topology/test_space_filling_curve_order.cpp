@@ -118,3 +118,33 @@ SCENARIO( "Space-filling curves give the correct ordering of ids", "[1rank]" ) {
       }
    }
 }
+
+SCENARIO( "Space-filling curves give a consistent ordering of ids on different levels", "[1rank]" ) {
+   GIVEN( "The leaves of a tree whose first level-one node is refined once more" ) {
+      std::vector<nid_t> const level_one_nodes = IdsOfChildren( IdSeed() );
+      std::vector<nid_t> const level_two_nodes = IdsOfChildren( level_one_nodes.front() );
+      std::vector<nid_t> leaves( std::cbegin( level_one_nodes ) + 1, std::cend( level_one_nodes ) );
+      leaves.insert( std::end( leaves ), std::cbegin( level_two_nodes ), std::cend( level_two_nodes ) );
+      for( auto const index : { HilbertIndex, LebesgueIndex } ) {
+         WHEN( "We order the leaves of all levels" ) {
+            OrderNodeIdsOfAllLevelsBySpaceFillingCurve( leaves, 2, index );
+            THEN( "The leaves appear in the order of their descendants on level two and every leaf covers a contiguous section of the curve" ) {
+               std::vector<nid_t> all_level_two_nodes;
+               for( auto const id : level_one_nodes ) {
+                  auto const children = IdsOfChildren( id );
+                  all_level_two_nodes.insert( std::end( all_level_two_nodes ), std::cbegin( children ), std::cend( children ) );
+               }
+               OrderNodeIdsBySpaceFillingCurve( all_level_two_nodes, index );
+               std::vector<nid_t> expected_leaves;
+               for( auto const id : all_level_two_nodes ) {
+                  nid_t const leaf = ParentIdOfNode( id ) == level_one_nodes.front() ? id : ParentIdOfNode( id );
+                  if( expected_leaves.empty() || expected_leaves.back() != leaf ) {
+                     expected_leaves.push_back( leaf );
+                  }
+               }
+               REQUIRE( leaves == expected_leaves );
+            }
+         }
+      }
+   }
+}
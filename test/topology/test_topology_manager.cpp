@@ -72,6 +72,10 @@
 #include "topology/topology_manager.h"
 #include "materials/material_definitions.h"
 #include "communication/mpi_utilities.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
 
 namespace {
    nid_t const root_node_id = IdSeed();
@@ -123,6 +127,27 @@ namespace {
       }
       topology.UpdateTopology();
    }
+
+   /**
+    * @brief Counts the parents that reside on a different rank than at least one of their children.
+    * @param topology The topology whose parents are checked.
+    * @return The number of parents split from their children.
+    */
+   unsigned int ParentsSplitFromChildren( TopologyManager const& topology ) {
+      unsigned int split_parents = 0;
+      for( unsigned int level = 0; level < topology.GetMaximumLevel(); ++level ) {
+         for( auto const id : topology.IdsOnLevel( level ) ) {
+            if( topology.NodeIsLeaf( id ) ) continue;
+            auto const children = IdsOfChildren( id );
+            if( std::any_of( std::cbegin( children ), std::cend( children ), [&topology, id]( nid_t const child ) {
+                   return topology.GetRankOfNode( child ) != topology.GetRankOfNode( id );
+                } ) ) {
+               split_parents++;
+            }
+         }
+      }
+      return split_parents;
+   }
 }// namespace
 
 namespace SimplestJumpTopology {
@@ -650,3 +675,185 @@ SCENARIO( "Changes in the topology are correctly processed", "[2rank]" ) {
       }
    }
 }
+
+SCENARIO( "Changes of all ranks are exchanged and applied in a single topology update", "[2rank]" ) {
+   GIVEN( "A topology with two nodes on level zero and lmax one distributed on two ranks" ) {
+      TopologyManager topology( { 2, 1, 1 }, 1 );
+      int const my_rank        = MpiUtilities::MyRankId();
+      std::vector<nid_t> roots = topology.IdsOnLevel( 0 );
+      std::sort( std::begin( roots ), std::end( roots ) );
+      REQUIRE( roots.size() == 2 );
+      std::uint64_t const revision = topology.GetRevision();
+      WHEN( "Each rank refines its own root node and changes the materials of the other rank's root node with lists of differing lengths" ) {
+         topology.RefineNodeWithId( roots[my_rank] );
+         if( my_rank == 0 ) {
+            topology.AddMaterialToNode( roots[1], MaterialName::MaterialOne );
+            topology.AddMaterialToNode( roots[1], MaterialName::MaterialTwo );
+         } else {
+            topology.AddMaterialToNode( roots[0], MaterialName::MaterialTwo );
+            topology.RemoveMaterialFromNode( roots[1], MaterialName::MaterialOne );
+         }
+         bool const refined = topology.UpdateTopology();
+         THEN( "Both root nodes are refined on all ranks and their children stay on the rank of their parent" ) {
+            REQUIRE( refined );
+            std::size_t const number_of_children = IdsOfChildren( root_node_id ).size();
+            REQUIRE( topology.NodeAndLeafCount() == std::pair<unsigned int, unsigned int>( 2 + 2 * number_of_children, 2 * number_of_children ) );
+            for( auto const root : roots ) {
+               REQUIRE_FALSE( topology.NodeIsLeaf( root ) );
+               for( auto const child : IdsOfChildren( root ) ) {
+                  REQUIRE( topology.NodeIsLeaf( child ) );
+                  REQUIRE( topology.GetRankOfNode( child ) == topology.GetRankOfNode( root ) );
+               }
+            }
+         }
+         THEN( "All materials are added before any is removed, independent of the rank that recorded the change" ) {
+            REQUIRE( topology.GetMaterialsOfNode( roots[0] ) == std::vector<MaterialName>( { MaterialName::MaterialTwo } ) );
+            REQUIRE( topology.GetMaterialsOfNode( roots[1] ) == std::vector<MaterialName>( { MaterialName::MaterialTwo } ) );
+         }
+         THEN( "The revision is increased once" ) {
+            REQUIRE( topology.GetRevision() == revision + 1 );
+         }
+      }
+      WHEN( "Only one rank records a material change" ) {
+         if( my_rank == 1 ) {
+            topology.AddMaterialToNode( roots[0], MaterialName::MaterialOne );
+         }
+         bool const refined = topology.UpdateTopology();
+         THEN( "The change is applied on all ranks without a refinement" ) {
+            REQUIRE_FALSE( refined );
+            REQUIRE( topology.GetMaterialsOfNode( roots[0] ) == std::vector<MaterialName>( { MaterialName::MaterialOne } ) );
+            REQUIRE( topology.GetMaterialsOfNode( roots[1] ).empty() );
+            REQUIRE( topology.GetRevision() == revision + 1 );
+         }
+      }
+      WHEN( "No rank records a change" ) {
+         bool const refined = topology.UpdateTopology();
+         THEN( "Neither the topology nor its revision change" ) {
+            REQUIRE_FALSE( refined );
+            REQUIRE( topology.NodeAndLeafCount() == std::pair<unsigned int, unsigned int>( 2, 2 ) );
+            REQUIRE( topology.GetRevision() == revision );
+         }
+      }
+   }
+}
+
+SCENARIO( "Cost-weighted load balancing distributes leaves of equal cost onto the ranks", "[1rank]" ) {
+   GIVEN( "A cost-weighted topology with eight leaves on Lmax = 1 and one leaf on level zero" ) {
+      TopologyManager simplest_jump( { 2, 1, 1 }, 1, 0, true );
+      RefineZerothRootNode( simplest_jump );
+      AddMaterialToAllNodes( simplest_jump, MaterialName::MaterialOne );
+      WHEN( "We distribute the topology onto three ranks" ) {
+         constexpr int number_of_ranks = 3;
+         simplest_jump.PrepareLoadBalancedTopology( number_of_ranks );
+         THEN( "Every rank holds three leaves, as level-one leaves cost twice as much as the level-zero leaf" ) {
+            auto const nodes_and_leaves_per_rank = simplest_jump.NodesAndLeavesPerRank( number_of_ranks );
+            REQUIRE( nodes_and_leaves_per_rank.size() == 3 );
+            for( auto const& [nodes, leaves] : nodes_and_leaves_per_rank ) {
+               REQUIRE( leaves == 3 );
+            }
+         }
+      }
+      WHEN( "We add a second material to some nodes and distribute the topology onto two ranks" ) {
+         AddMaterialToWestmostNodesOnEveryLevel( simplest_jump, MaterialName::MaterialTwo );
+         constexpr int number_of_ranks = 2;
+         simplest_jump.PrepareLoadBalancedTopology( number_of_ranks );
+         THEN( "The costs of the ranks differ by less than the cost of the most expensive leaf" ) {
+            double const multi_phase_cost = simplest_jump.GetMultiPhaseLeafCost();
+            std::vector<double> cost_per_rank( number_of_ranks, 0.0 );
+            for( auto const id : simplest_jump.LeafIds() ) {
+               double const time_steps = static_cast<double>( 1u << LevelOfNode( id ) );
+               cost_per_rank[simplest_jump.GetRankOfNode( id )] += simplest_jump.IsNodeMultiPhase( id ) ? multi_phase_cost * time_steps : time_steps;
+            }
+            REQUIRE( std::abs( cost_per_rank[0] - cost_per_rank[1] ) < 2.0 * multi_phase_cost );
+         }
+      }
+      WHEN( "We calibrate the leaf costs with measurements of a single rank" ) {
+         simplest_jump.AccumulateLeafCostSample( { 0, 1, 2 }, 1.0 );
+         simplest_jump.CalibrateLeafCosts();
+         THEN( "The modeled multi-phase leaf cost is kept" ) {
+            REQUIRE( simplest_jump.GetMultiPhaseLeafCost() == CC::MultiPhaseLeafCost() );
+         }
+      }
+   }
+}
+
+SCENARIO( "Subtree-affine load balancing keeps parents and children on the same rank", "[1rank]" ) {
+   GIVEN( "A cost-weighted and a subtree-affine topology on Lmax = 2, in which three of the eight level-one nodes are refined" ) {
+      TopologyManager cost_weighted( { 1, 1, 1 }, 2, 0, true, false );
+      TopologyManager subtree_affine( { 1, 1, 1 }, 2, 0, true, true );
+      for( TopologyManager* topology : { &cost_weighted, &subtree_affine } ) {
+         RefineZerothRootNode( *topology );
+         auto const children = IdsOfChildren( root_node_id );
+         std::for_each( std::cbegin( children ), std::cbegin( children ) + 3, [topology]( nid_t const id ) { topology->RefineNodeWithId( id ); } );
+         topology->UpdateTopology();
+      }
+      WHEN( "We distribute both topologies onto three ranks" ) {
+         constexpr int number_of_ranks = 3;
+         cost_weighted.PrepareLoadBalancedTopology( number_of_ranks );
+         subtree_affine.PrepareLoadBalancedTopology( number_of_ranks );
+         THEN( "Fewer parents are split from their children in the subtree-affine topology" ) {
+            REQUIRE( ParentsSplitFromChildren( subtree_affine ) < ParentsSplitFromChildren( cost_weighted ) );
+         }
+         THEN( "The cost of every rank deviates from the average by at most the tolerance and the most expensive leaf at both of its cuts" ) {
+            std::vector<double> cost_per_rank( number_of_ranks, 0.0 );
+            for( auto const id : subtree_affine.LeafIds() ) {
+               cost_per_rank[subtree_affine.GetRankOfNode( id )] += static_cast<double>( 1u << LevelOfNode( id ) );
+            }
+            double const average_cost    = std::accumulate( std::cbegin( cost_per_rank ), std::cend( cost_per_rank ), 0.0 ) / number_of_ranks;
+            double const most_expensive  = static_cast<double>( 1u << subtree_affine.GetMaximumLevel() );
+            for( double const cost : cost_per_rank ) {
+               REQUIRE( std::abs( cost - average_cost ) <= 2.0 * ( CC::SubtreeAffineCutTolerance() * average_cost + most_expensive ) );
+            }
+         }
+      }
+   }
+}
+
+SCENARIO( "Leaf costs are calibrated from measured compute times", "[2rank]" ) {
+   constexpr int number_of_ranks = 2;
+   GIVEN( "A topology with eight leaves on Lmax = 1 of which one is multi-phase" ) {
+      TopologyManager topology( { 1, 1, 1 }, 1, 0, true );
+      int const my_rank = MpiUtilities::MyRankId();
+      RefineZerothRootNode( topology );
+      AddMaterialToAllNodes( topology, MaterialName::MaterialOne, my_rank );
+      if( my_rank == 0 ) {
+         topology.AddMaterialToNode( IdsOfChildren( root_node_id ).front(), MaterialName::MaterialTwo );
+      }
+      topology.UpdateTopology();
+      topology.PrepareLoadBalancedTopology( number_of_ranks );
+      constexpr double measured_multi_phase_cost = 3.0;
+      auto const measured_compute_time = [&topology]() {
+         double compute_time = 0.0;
+         for( auto const id : topology.LocalLeafIds() ) {
+            compute_time += topology.IsNodeMultiPhase( id ) ? measured_multi_phase_cost : 1.0;
+         }
+         return compute_time;
+      };
+      WHEN( "Each rank measures a compute time in which multi-phase leaves cost three times as much as single-phase leaves" ) {
+         topology.AccumulateLeafCostSample( { 1 }, measured_compute_time() );
+         topology.CalibrateLeafCosts();
+         THEN( "The calibrated multi-phase leaf cost matches the measurement" ) {
+            REQUIRE( topology.GetMultiPhaseLeafCost() == Approx( measured_multi_phase_cost ) );
+         }
+      }
+      WHEN( "A second leaf becomes multi-phase between two measured time steps" ) {
+         topology.AccumulateLeafCostSample( { 1 }, measured_compute_time() );
+         if( my_rank == 0 ) {
+            topology.AddMaterialToNode( IdsOfChildren( root_node_id ).back(), MaterialName::MaterialTwo );
+         }
+         topology.UpdateTopology();
+         topology.AccumulateLeafCostSample( { 1 }, measured_compute_time() );
+         topology.CalibrateLeafCosts();
+         THEN( "The calibrated multi-phase leaf cost matches the measurement of both time steps" ) {
+            REQUIRE( topology.GetMultiPhaseLeafCost() == Approx( measured_multi_phase_cost ) );
+         }
+      }
+      WHEN( "Only the leaves of a level without local leaves are sampled" ) {
+         topology.AccumulateLeafCostSample( { 0 }, measured_compute_time() );
+         topology.CalibrateLeafCosts();
+         THEN( "The modeled multi-phase leaf cost is kept" ) {
+            REQUIRE( topology.GetMultiPhaseLeafCost() == CC::MultiPhaseLeafCost() );
+         }
+      }
+   }
+}
@@ -160,3 +160,49 @@ SCENARIO( "Topology Nodes created with different parameters, materials are modif
       }
    }
 }
+
+SCENARIO( "The materials of topology nodes are kept as a set in ascending order", "[1rank]" ) {
+   GIVEN( "A topology node the materials are added to in descending order" ) {
+      TopologyNode node = TopologyNode();
+      node.AddMaterial( MaterialName::MaterialFour );
+      node.AddMaterial( MaterialName::MaterialTwo );
+      node.AddMaterial( MaterialName::MaterialOne );
+      THEN( "The materials are reported in ascending order" ) {
+         REQUIRE( node.Materials() == std::vector<MaterialName>( { MaterialName::MaterialOne, MaterialName::MaterialTwo, MaterialName::MaterialFour } ) );
+         REQUIRE( node.NumberOfMaterials() == 3 );
+      }
+      THEN( "The single material is the one with the lowest index" ) {
+         REQUIRE( node.SingleMaterial() == MaterialName::MaterialOne );
+      }
+      WHEN( "A present material is added again" ) {
+         node.AddMaterial( MaterialName::MaterialTwo );
+         THEN( "The materials are unchanged" ) {
+            REQUIRE( node.NumberOfMaterials() == 3 );
+            REQUIRE( node.Materials() == std::vector<MaterialName>( { MaterialName::MaterialOne, MaterialName::MaterialTwo, MaterialName::MaterialFour } ) );
+         }
+      }
+      WHEN( "A material in the middle and a material that is not present are removed" ) {
+         node.RemoveMaterial( MaterialName::MaterialTwo );
+         node.RemoveMaterial( MaterialName::MaterialThree );
+         THEN( "Only the present material is removed" ) {
+            REQUIRE( node.NumberOfMaterials() == 2 );
+            REQUIRE( node.Materials() == std::vector<MaterialName>( { MaterialName::MaterialOne, MaterialName::MaterialFour } ) );
+         }
+      }
+      WHEN( "All materials are removed" ) {
+         for( MaterialName const material : node.Materials() ) {
+            node.RemoveMaterial( material );
+         }
+         THEN( "The node holds no materials" ) {
+            REQUIRE( node.NumberOfMaterials() == 0 );
+            REQUIRE( node.Materials().empty() );
+         }
+      }
+   }
+   GIVEN( "A topology node constructed with unsorted materials" ) {
+      TopologyNode const node = TopologyNode( { MaterialName::MaterialThree, MaterialName::MaterialOne } );
+      THEN( "The materials are reported in ascending order" ) {
+         REQUIRE( node.Materials() == std::vector<MaterialName>( { MaterialName::MaterialOne, MaterialName::MaterialThree } ) );
+      }
+   }
+}
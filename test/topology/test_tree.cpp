@@ -70,6 +70,8 @@
 
 #include "topology/tree.h"
 #include "topology/topology_manager.h"
+#include "topology/id_information.h"
+#include "topology/space_filling_curve_order.h"
 
 SCENARIO( "Retriving nodes from a tree with a different number of nodes on two levels", "[1rank]" ) {
    GIVEN( "A topology, a geometric size and a maximum level" ) {
@@ -103,3 +105,58 @@ SCENARIO( "Retriving nodes from a tree with a different number of nodes on two l
       }
    }
 }
+
+SCENARIO( "Leaf lists of a tree follow changes of the tree and the topology", "[1rank]" ) {
+   GIVEN( "A tree holding a single root node in a topology with maximum level one" ) {
+      constexpr unsigned int maximum_level = 1;
+      nid_t const root_id                  = IdSeed();
+      TopologyManager topology( { 1, 1, 1 }, maximum_level );
+      Tree tree( topology, maximum_level, 1.0 );
+      tree.CreateNode( root_id, { MaterialName::MaterialOne } );
+      topology.AddMaterialToNode( root_id, MaterialName::MaterialOne );
+      topology.UpdateTopology();
+      THEN( "The root node is the only leaf" ) {
+         REQUIRE( tree.Leaves().size() == 1 );
+         REQUIRE( tree.LeavesOnLevel( 0 ).size() == 1 );
+         REQUIRE( tree.LeavesOnLevel( 1 ).empty() );
+         REQUIRE( tree.InterfaceLeaves().empty() );
+      }
+      WHEN( "The root node is refined" ) {
+         REQUIRE( tree.Leaves().size() == 1 );
+         topology.RefineNodeWithId( root_id );
+         topology.UpdateTopology();
+         std::vector<nid_t> const children_ids = tree.RefineNode( root_id );
+         THEN( "The children are the leaves and are ordered along the space-filling curve" ) {
+            std::vector<nid_t> ordered_children_ids( children_ids );
+            OrderNodeIdsBySpaceFillingCurve( ordered_children_ids );
+            auto const leaves = tree.Leaves();
+            REQUIRE( leaves.size() == children_ids.size() );
+            REQUIRE( tree.LeavesOnLevel( 0 ).empty() );
+            for( std::size_t i = 0; i < leaves.size(); ++i ) {
+               REQUIRE( &leaves[i].get() == &tree.GetNodeWithId( ordered_children_ids[i] ) );
+            }
+         }
+         WHEN( "A second material is added to a child in the topology" ) {
+            REQUIRE( tree.InterfaceLeaves().empty() );
+            topology.AddMaterialToNode( children_ids.front(), MaterialName::MaterialOne );
+            topology.AddMaterialToNode( children_ids.front(), MaterialName::MaterialTwo );
+            topology.UpdateTopology();
+            THEN( "The child becomes the only interface leaf" ) {
+               auto const interface_leaves = tree.InterfaceLeaves();
+               REQUIRE( interface_leaves.size() == 1 );
+               REQUIRE( &interface_leaves.front().get() == &tree.GetNodeWithId( children_ids.front() ) );
+            }
+         }
+         WHEN( "The children are coarsened again" ) {
+            topology.CoarseNodeWithId( root_id );
+            for( nid_t const child_id : children_ids ) {
+               tree.RemoveNodeWithId( child_id );
+            }
+            THEN( "The root node is the only leaf again" ) {
+               REQUIRE( tree.Leaves().size() == 1 );
+               REQUIRE( tree.LeavesOnLevel( 1 ).empty() );
+            }
+         }
+      }
+   }
+}
@@ -187,3 +187,17 @@ SCENARIO( "Transform-If transforms a container into another one if the condition
       }
    }
 }
+
+SCENARIO( "Each element of a container can be processed in parallel", "[1rank]" ) {
+   GIVEN( "A vector of integers and a vector to store results in" ) {
+      std::vector<int> const v = { 1, -2, 3, -4, 5, -6, 7 };
+      std::vector<int> result( v.size(), 0 );
+      WHEN( "We square each element in parallel" ) {
+         ContainerOperations::ForEachInParallel( v, [&v, &result]( int const& in ) { result[&in - v.data()] = in * in; } );
+         THEN( "Every element has been processed exactly once" ) {
+            std::vector<int> const expected = { 1, 4, 9, 16, 25, 36, 49 };
+            REQUIRE( result == expected );
+         }
+      }
+   }
+}